@@ -0,0 +1,122 @@
+/*
+ * Builds a tree of 10 x 100 x 1000 empty files (about one million entries)
+ * in a temporary directory and times fs_walk, fs_walk with FS_WALK_PARALLEL
+ * and nftw over it. A smaller file count per directory may be given as the
+ * first argument. Results go to stderr.
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <ftw.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lib/fs.h"
+
+static atomic_size_t seen;
+
+static int count(const struct fs_entry *entry, void *data)
+{
+	(void)entry;
+	(void)data;
+	atomic_fetch_add_explicit(&seen, 1, memory_order_relaxed);
+	return FS_WALK_CONTINUE;
+}
+
+static int count_ftw(const char *path, const struct stat *st, int type,
+		     struct FTW *ftw)
+{
+	(void)path;
+	(void)st;
+	(void)type;
+	(void)ftw;
+	atomic_fetch_add_explicit(&seen, 1, memory_order_relaxed);
+	return 0;
+}
+
+static int unlink_ftw(const char *path, const struct stat *st, int type,
+		      struct FTW *ftw)
+{
+	(void)st;
+	(void)ftw;
+	return type == FTW_DP ? rmdir(path) : unlink(path);
+}
+
+static int build(const char *root, int files)
+{
+	char path[4096];
+
+	for (int a = 0; a < 10; a++) {
+		for (int b = 0; b < 100; b++) {
+			int dirfd;
+
+			snprintf(path, sizeof path, "%s/%d", root, a);
+			if (b == 0 && mkdir(path, 0755) < 0)
+				return -1;
+			snprintf(path, sizeof path, "%s/%d/%d", root, a, b);
+			if (mkdir(path, 0755) < 0)
+				return -1;
+			dirfd = open(path, O_RDONLY | O_DIRECTORY);
+			if (dirfd < 0)
+				return -1;
+			for (int c = 0; c < files; c++) {
+				char name[16];
+				int fd;
+
+				snprintf(name, sizeof name, "%d", c);
+				fd = openat(dirfd, name, O_WRONLY | O_CREAT,
+					    0644);
+				if (fd < 0) {
+					close(dirfd);
+					return -1;
+				}
+				close(fd);
+			}
+			close(dirfd);
+		}
+	}
+	return 0;
+}
+
+static void timed(const char *what, const char *root, int how)
+{
+	struct timespec a, b;
+
+	atomic_store(&seen, 0);
+	clock_gettime(CLOCK_MONOTONIC, &a);
+	if (how < 0)
+		nftw(root, count_ftw, 64, FTW_PHYS);
+	else
+		fs_walk(root, count, NULL, how);
+	clock_gettime(CLOCK_MONOTONIC, &b);
+
+	fprintf(stderr, "%-20s %8.1f ms %10zu entries\n", what,
+		(double)(b.tv_sec - a.tv_sec) * 1e3 +
+			(double)(b.tv_nsec - a.tv_nsec) / 1e6,
+		atomic_load(&seen));
+}
+
+int main(int argc, char **argv)
+{
+	char root[] = "/tmp/fs_walk.XXXXXX";
+	int files = argc > 1 ? atoi(argv[1]) : 1000;
+
+	if (!mkdtemp(root) || build(root, files) < 0) {
+		perror("fs_walk");
+		return EXIT_FAILURE;
+	}
+
+	/* The first pass also fills the dentry and inode caches. */
+	timed("fs_walk (first)", root, 0);
+	timed("fs_walk", root, 0);
+	timed("fs_walk (parallel)", root, FS_WALK_PARALLEL);
+	timed("nftw(FTW_PHYS)", root, -1);
+
+	nftw(root, unlink_ftw, 64, FTW_PHYS | FTW_DEPTH);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+/*
+ * Times one million say_progress updates, once with stdout on a 100x40
+ * pseudo-terminal and once with stdout on /dev/null. Results go to stderr.
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lib/say.h"
+
+#define UPDATES 1000000
+
+static double run(const char *what, int fd)
+{
+	struct timespec a, b;
+	int saved = dup(STDOUT_FILENO);
+	double ms;
+
+	fflush(stdout);
+	dup2(fd, STDOUT_FILENO);
+	clock_gettime(CLOCK_MONOTONIC, &a);
+	for (size_t i = 1; i <= UPDATES; i++)
+		say_progress(i, UPDATES, "bench");
+	say_progress_end();
+	clock_gettime(CLOCK_MONOTONIC, &b);
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+
+	ms = (double)(b.tv_sec - a.tv_sec) * 1e3 +
+	     (double)(b.tv_nsec - a.tv_nsec) / 1e6;
+	fprintf(stderr, "say_progress %-6s %8.1f ms %6.1f ns/update\n", what, ms,
+		ms * 1e6 / UPDATES);
+	return ms;
+}
+
+int main(void)
+{
+	struct winsize w = { .ws_row = 40, .ws_col = 100 };
+	int master = posix_openpt(O_RDWR | O_NOCTTY), slave = -1, null;
+
+	if (master >= 0 && grantpt(master) == 0 && unlockpt(master) == 0)
+		slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	if (slave >= 0 && ioctl(slave, TIOCSWINSZ, &w) == 0)
+		run("tty", slave);
+	else
+		fprintf(stderr, "say_progress: no pseudo-terminal, skipped\n");
+
+	/* Make the next update query the window size again. */
+	raise(SIGWINCH);
+	null = open("/dev/null", O_WRONLY);
+	if (null < 0) {
+		perror("say_progress");
+		return EXIT_FAILURE;
+	}
+	run("null", null);
+	return EXIT_SUCCESS;
+}
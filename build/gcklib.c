@@ -0,0 +1,5697 @@
+/* Generated by build-aux/embed, do not edit. */
+
+#include "src/gcklib.h"
+
+static const char file0[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x65,
+	0x72,0x72,0x20,0x2d,0x20,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x63,0x6f,
+	0x6c,0x6f,0x72,0x20,0x70,0x72,0x69,0x6e,0x74,0x69,0x6e,0x67,0x20,0x66,0x75,0x6e,
+	0x63,0x74,0x69,0x6f,0x6e,0x73,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,
+	0x4f,0x4e,0x46,0x49,0x47,0x55,0x52,0x41,0x54,0x49,0x4f,0x4e,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4e,0x4f,
+	0x43,0x4f,0x4c,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x46,0x6f,0x72,0x63,0x65,0x20,0x6e,0x6f,0x20,0x63,0x6f,0x6c,0x6f,
+	0x72,0x20,0x77,0x68,0x65,0x6e,0x20,0x70,0x72,0x69,0x6e,0x74,0x69,0x6e,0x67,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x20,0x45,0x52,0x52,0x5f,0x42,0x55,0x46,0x53,0x49,0x5a,0x45,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x53,0x69,0x7a,0x65,0x20,0x6f,
+	0x66,0x20,0x74,0x68,0x65,0x20,0x70,0x65,0x72,0x2d,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,
+	0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x34,0x30,0x39,0x36,0x29,0x3b,0x20,
+	0x6c,0x6f,0x6e,0x67,0x65,0x72,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x73,0x20,0x61,0x72,0x65,
+	0x20,0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x64,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,
+	0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,
+	0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,
+	0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,
+	0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,
+	0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,
+	0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,
+	0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,
+	0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,
+	0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,
+	0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,
+	0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,
+	0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,
+	0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,
+	0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,
+	0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,
+	0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,
+	0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,
+	0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,
+	0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,
+	0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,
+	0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,
+	0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,
+	0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,
+	0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,
+	0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,
+	0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,
+	0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,
+	0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,
+	0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,
+	0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,
+	0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,
+	0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,
+	0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,
+	0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,
+	0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,
+	0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,
+	0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,
+	0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,
+	0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,
+	0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,
+	0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,
+	0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,
+	0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,
+	0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,
+	0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,
+	0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,
+	0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,
+	0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,
+	0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,
+	0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,
+	0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,
+	0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,
+	0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,
+	0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,
+	0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,
+	0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,
+	0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,
+	0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,
+	0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+	0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,
+	0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,
+	0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,
+	0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,
+	0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,
+	0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,
+	0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,
+	0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,
+	0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,
+	0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,
+	0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,
+	0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,
+	0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,
+	0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,
+	0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,
+	0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,
+	0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,
+	0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,
+	0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,
+	0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,
+	0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,
+	0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,
+	0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,
+	0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,
+	0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,
+	0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,
+	0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,
+	0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,
+	0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,
+	0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+	0x64,0x65,0x20,0x3c,0x65,0x72,0x72,0x6e,0x6f,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x61,0x72,0x67,0x2e,0x68,0x3e,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x62,0x6f,
+	0x6f,0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,
+	0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x75,0x6e,0x69,0x73,0x74,
+	0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,
+	0x65,0x72,0x72,0x2e,0x68,0x22,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+	0x52,0x45,0x53,0x45,0x54,0x20,0x22,0x5c,0x78,0x31,0x42,0x5b,0x30,0x6d,0x22,0x0a,
+	0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x45,0x52,0x52,0x4f,0x52,0x20,0x22,0x5c,
+	0x78,0x31,0x42,0x5b,0x31,0x3b,0x39,0x31,0x6d,0x22,0x0a,0x23,0x64,0x65,0x66,0x69,
+	0x6e,0x65,0x20,0x57,0x41,0x52,0x4e,0x20,0x22,0x5c,0x78,0x31,0x42,0x5b,0x31,0x3b,
+	0x39,0x35,0x6d,0x22,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4e,0x4f,0x54,
+	0x45,0x20,0x22,0x5c,0x78,0x31,0x42,0x5b,0x31,0x3b,0x39,0x34,0x6d,0x22,0x0a,0x23,
+	0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x48,0x49,0x4e,0x54,0x20,0x22,0x5c,0x78,0x31,
+	0x42,0x5b,0x33,0x38,0x3b,0x35,0x3b,0x31,0x36,0x36,0x6d,0x22,0x0a,0x0a,0x23,0x69,
+	0x66,0x6e,0x64,0x65,0x66,0x20,0x45,0x52,0x52,0x5f,0x42,0x55,0x46,0x53,0x49,0x5a,
+	0x45,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x45,0x52,0x52,0x5f,0x42,0x55,
+	0x46,0x53,0x49,0x5a,0x45,0x20,0x34,0x30,0x39,0x36,0x0a,0x23,0x65,0x6e,0x64,0x69,
+	0x66,0x0a,0x0a,0x65,0x6e,0x75,0x6d,0x20,0x65,0x72,0x72,0x5f,0x6c,0x65,0x76,0x65,
+	0x6c,0x20,0x7b,0x20,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x48,0x49,0x4e,0x54,0x2c,0x20,
+	0x4c,0x45,0x56,0x45,0x4c,0x5f,0x4e,0x4f,0x54,0x45,0x2c,0x20,0x4c,0x45,0x56,0x45,
+	0x4c,0x5f,0x57,0x41,0x52,0x4e,0x2c,0x20,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x45,0x52,
+	0x52,0x4f,0x52,0x2c,0x20,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x46,0x41,0x54,0x41,0x4c,
+	0x20,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x7b,0x0a,0x09,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x09,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x63,0x6f,0x6c,0x6f,0x72,
+	0x3b,0x0a,0x7d,0x20,0x6c,0x65,0x76,0x65,0x6c,0x73,0x5b,0x5d,0x20,0x3d,0x20,0x7b,
+	0x0a,0x09,0x5b,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x48,0x49,0x4e,0x54,0x5d,0x20,0x3d,
+	0x20,0x7b,0x20,0x22,0x68,0x69,0x6e,0x74,0x22,0x2c,0x20,0x48,0x49,0x4e,0x54,0x20,
+	0x7d,0x2c,0x0a,0x09,0x5b,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x4e,0x4f,0x54,0x45,0x5d,
+	0x20,0x3d,0x20,0x7b,0x20,0x22,0x6e,0x6f,0x74,0x65,0x22,0x2c,0x20,0x4e,0x4f,0x54,
+	0x45,0x20,0x7d,0x2c,0x0a,0x09,0x5b,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x57,0x41,0x52,
+	0x4e,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x22,0x77,0x61,0x72,0x6e,0x69,0x6e,0x67,0x22,
+	0x2c,0x20,0x57,0x41,0x52,0x4e,0x20,0x7d,0x2c,0x0a,0x09,0x5b,0x4c,0x45,0x56,0x45,
+	0x4c,0x5f,0x45,0x52,0x52,0x4f,0x52,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x22,0x65,0x72,
+	0x72,0x6f,0x72,0x22,0x2c,0x20,0x45,0x52,0x52,0x4f,0x52,0x20,0x7d,0x2c,0x0a,0x09,
+	0x5b,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x46,0x41,0x54,0x41,0x4c,0x5d,0x20,0x3d,0x20,
+	0x7b,0x20,0x22,0x66,0x61,0x74,0x61,0x6c,0x20,0x65,0x72,0x72,0x6f,0x72,0x22,0x2c,
+	0x20,0x45,0x52,0x52,0x4f,0x52,0x20,0x7d,0x2c,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x65,0x72,0x72,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x20,
+	0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x62,0x75,0x66,0x5b,0x45,0x52,0x52,0x5f,
+	0x42,0x55,0x46,0x53,0x49,0x5a,0x45,0x5d,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x20,0x6c,0x65,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+	0x63,0x20,0x65,0x6e,0x75,0x6d,0x20,0x65,0x72,0x72,0x5f,0x66,0x6f,0x72,0x6d,0x61,
+	0x74,0x20,0x65,0x72,0x72,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x20,0x3d,0x20,0x45,
+	0x52,0x52,0x5f,0x54,0x45,0x58,0x54,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x62,0x6f,0x6f,0x6c,0x20,0x65,0x72,0x72,0x5f,0x62,0x61,0x74,0x63,0x68,0x20,0x3d,
+	0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x70,0x65,0x6e,0x64,
+	0x69,0x6e,0x67,0x20,0x62,0x61,0x74,0x63,0x68,0x65,0x64,0x20,0x72,0x65,0x63,0x6f,
+	0x72,0x64,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x6c,0x6c,0x69,
+	0x6e,0x67,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x5f,0x54,0x68,0x72,0x65,0x61,0x64,0x5f,0x6c,0x6f,0x63,0x61,
+	0x6c,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x65,0x72,0x72,0x5f,0x72,0x65,0x63,
+	0x6f,0x72,0x64,0x20,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x3b,0x0a,0x0a,0x73,0x74,
+	0x61,0x74,0x69,0x63,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x65,0x72,0x72,0x5f,0x73,0x75,
+	0x70,0x70,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x76,0x6f,0x69,0x64,
+	0x29,0x0a,0x7b,0x0a,0x23,0x69,0x66,0x64,0x65,0x66,0x20,0x4e,0x4f,0x43,0x4f,0x4c,
+	0x4f,0x52,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,
+	0x3b,0x0a,0x23,0x65,0x6c,0x73,0x65,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x69,0x6e,0x74,0x20,0x63,0x61,0x63,0x68,0x65,0x64,0x20,0x3d,0x20,0x2d,0x31,0x3b,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x63,0x61,0x63,0x68,0x65,0x64,0x20,0x21,0x3d,0x20,
+	0x2d,0x31,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x61,0x63,
+	0x68,0x65,0x64,0x3b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x74,0x65,0x72,0x6d,0x2c,0x20,0x2a,0x63,0x6f,0x6c,0x6f,0x72,0x74,0x65,
+	0x72,0x6d,0x2c,0x20,0x2a,0x66,0x6f,0x72,0x63,0x65,0x2c,0x20,0x2a,0x6e,0x6f,0x63,
+	0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x09,0x74,0x65,0x72,0x6d,0x20,0x3d,0x20,0x67,0x65,
+	0x74,0x65,0x6e,0x76,0x28,0x22,0x54,0x45,0x52,0x4d,0x22,0x29,0x3b,0x0a,0x09,0x63,
+	0x6f,0x6c,0x6f,0x72,0x74,0x65,0x72,0x6d,0x20,0x3d,0x20,0x67,0x65,0x74,0x65,0x6e,
+	0x76,0x28,0x22,0x43,0x4f,0x4c,0x4f,0x52,0x54,0x45,0x52,0x4d,0x22,0x29,0x3b,0x0a,
+	0x09,0x66,0x6f,0x72,0x63,0x65,0x20,0x3d,0x20,0x67,0x65,0x74,0x65,0x6e,0x76,0x28,
+	0x22,0x46,0x4f,0x52,0x43,0x45,0x5f,0x43,0x4f,0x4c,0x4f,0x52,0x22,0x29,0x3b,0x0a,
+	0x09,0x6e,0x6f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x65,0x6e,
+	0x76,0x28,0x22,0x4e,0x4f,0x5f,0x43,0x4f,0x4c,0x4f,0x52,0x22,0x29,0x3b,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x6e,0x6f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x26,0x26,0x20,0x2a,
+	0x6e,0x6f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x26,0x26,0x20,0x28,0x21,0x66,0x6f,0x72,
+	0x63,0x65,0x20,0x7c,0x7c,0x20,0x21,0x2a,0x66,0x6f,0x72,0x63,0x65,0x29,0x29,0x20,
+	0x7b,0x0a,0x09,0x09,0x63,0x61,0x63,0x68,0x65,0x64,0x20,0x3d,0x20,0x30,0x3b,0x0a,
+	0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,
+	0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x6f,0x72,0x63,0x65,0x20,0x26,0x26,
+	0x20,0x2a,0x66,0x6f,0x72,0x63,0x65,0x20,0x26,0x26,0x20,0x73,0x74,0x72,0x63,0x6d,
+	0x70,0x28,0x66,0x6f,0x72,0x63,0x65,0x2c,0x20,0x22,0x30,0x22,0x29,0x20,0x21,0x3d,
+	0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x63,0x61,0x63,0x68,0x65,0x64,0x20,0x3d,
+	0x20,0x31,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x72,0x75,
+	0x65,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x2f,0x2f,0x20,0x69,0x66,0x20,0x28,0x21,0x69,
+	0x73,0x61,0x74,0x74,0x79,0x28,0x66,0x69,0x6c,0x65,0x6e,0x6f,0x28,0x73,0x74,0x64,
+	0x6f,0x75,0x74,0x29,0x29,0x29,0x20,0x7b,0x0a,0x09,0x2f,0x2f,0x20,0x09,0x63,0x61,
+	0x63,0x68,0x65,0x64,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x09,0x2f,0x2f,0x20,0x09,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x09,0x2f,0x2f,
+	0x20,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x74,0x65,0x72,
+	0x6d,0x20,0x26,0x26,0x20,0x2a,0x63,0x6f,0x6c,0x6f,0x72,0x74,0x65,0x72,0x6d,0x29,
+	0x20,0x7b,0x0a,0x09,0x09,0x63,0x61,0x63,0x68,0x65,0x64,0x20,0x3d,0x20,0x31,0x3b,
+	0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,
+	0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x74,0x65,0x72,0x6d,0x20,0x7c,0x7c,
+	0x20,0x21,0x2a,0x74,0x65,0x72,0x6d,0x29,0x20,0x7b,0x0a,0x09,0x09,0x63,0x61,0x63,
+	0x68,0x65,0x64,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,0x22,0x63,
+	0x6f,0x6c,0x6f,0x72,0x22,0x29,0x20,0x7c,0x7c,0x20,0x73,0x74,0x72,0x73,0x74,0x72,
+	0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,0x22,0x78,0x74,0x65,0x72,0x6d,0x22,0x29,0x20,
+	0x7c,0x7c,0x0a,0x09,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,
+	0x65,0x72,0x6d,0x2c,0x20,0x22,0x73,0x63,0x72,0x65,0x65,0x6e,0x22,0x29,0x20,0x7c,
+	0x7c,0x20,0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,0x22,
+	0x76,0x74,0x31,0x30,0x30,0x22,0x29,0x20,0x7c,0x7c,0x0a,0x09,0x20,0x20,0x20,0x20,
+	0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,0x22,0x72,0x78,
+	0x76,0x74,0x22,0x29,0x20,0x7c,0x7c,0x20,0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,
+	0x65,0x72,0x6d,0x2c,0x20,0x22,0x61,0x6e,0x73,0x69,0x22,0x29,0x20,0x7c,0x7c,0x0a,
+	0x09,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,
+	0x2c,0x20,0x22,0x6c,0x69,0x6e,0x75,0x78,0x22,0x29,0x20,0x7c,0x7c,0x20,0x73,0x74,
+	0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,0x22,0x6b,0x6f,0x6e,0x73,
+	0x6f,0x6c,0x65,0x22,0x29,0x20,0x7c,0x7c,0x0a,0x09,0x20,0x20,0x20,0x20,0x73,0x74,
+	0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,0x22,0x76,0x74,0x65,0x22,
+	0x29,0x20,0x7c,0x7c,0x20,0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,
+	0x2c,0x20,0x22,0x6b,0x69,0x74,0x74,0x79,0x22,0x29,0x20,0x7c,0x7c,0x0a,0x09,0x20,
+	0x20,0x20,0x20,0x73,0x74,0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,
+	0x22,0x77,0x65,0x7a,0x74,0x65,0x72,0x6d,0x22,0x29,0x20,0x7c,0x7c,0x20,0x73,0x74,
+	0x72,0x73,0x74,0x72,0x28,0x74,0x65,0x72,0x6d,0x2c,0x20,0x22,0x67,0x6e,0x6f,0x6d,
+	0x65,0x22,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x63,0x61,0x63,0x68,0x65,0x64,0x20,
+	0x3d,0x20,0x31,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x72,
+	0x75,0x65,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x63,0x61,0x63,0x68,0x65,0x64,0x20,0x3d,
+	0x20,0x30,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,
+	0x65,0x3b,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,0x77,0x72,0x69,
+	0x74,0x65,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x62,
+	0x75,0x66,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x29,0x0a,
+	0x7b,0x0a,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6c,0x65,0x6e,0x20,0x3e,0x20,
+	0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,
+	0x20,0x3d,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x53,0x54,0x44,0x45,0x52,0x52,0x5f,
+	0x46,0x49,0x4c,0x45,0x4e,0x4f,0x2c,0x20,0x62,0x75,0x66,0x2c,0x20,0x6c,0x65,0x6e,
+	0x29,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x6e,0x20,0x3c,0x20,0x30,0x29,0x20,
+	0x7b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,
+	0x3d,0x20,0x45,0x49,0x4e,0x54,0x52,0x29,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,
+	0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,
+	0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x62,0x75,0x66,0x20,0x2b,0x3d,0x20,0x6e,
+	0x3b,0x0a,0x09,0x09,0x6c,0x65,0x6e,0x20,0x2d,0x3d,0x20,0x28,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x29,0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x52,
+	0x6f,0x6f,0x6d,0x20,0x6c,0x65,0x66,0x74,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,0x65,
+	0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2c,0x20,0x61,0x6c,0x77,0x61,0x79,0x73,
+	0x20,0x6b,0x65,0x65,0x70,0x69,0x6e,0x67,0x20,0x73,0x6f,0x6d,0x65,0x20,0x66,0x6f,
+	0x72,0x20,0x74,0x68,0x65,0x20,0x72,0x65,0x63,0x6f,0x72,0x64,0x20,0x74,0x72,0x61,
+	0x69,0x6c,0x65,0x72,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x65,0x72,0x72,0x5f,0x72,0x6f,0x6f,0x6d,0x28,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x65,0x72,0x72,
+	0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x20,0x2a,0x72,0x65,0x63,0x29,0x0a,0x7b,0x0a,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x72,
+	0x65,0x63,0x2d,0x3e,0x62,0x75,0x66,0x20,0x2d,0x20,0x38,0x20,0x2d,0x20,0x72,0x65,
+	0x63,0x2d,0x3e,0x6c,0x65,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x41,0x70,
+	0x70,0x65,0x6e,0x64,0x73,0x20,0x61,0x74,0x20,0x6d,0x6f,0x73,0x74,0x20,0x77,0x68,
+	0x61,0x74,0x20,0x66,0x69,0x74,0x73,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,
+	0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x28,
+	0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x65,0x72,0x72,0x5f,0x72,0x65,0x63,0x6f,0x72,
+	0x64,0x20,0x2a,0x72,0x65,0x63,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x73,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x29,
+	0x0a,0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x72,0x6f,0x6f,0x6d,0x20,
+	0x3d,0x20,0x65,0x72,0x72,0x5f,0x72,0x6f,0x6f,0x6d,0x28,0x72,0x65,0x63,0x29,0x3b,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x6e,0x20,0x3e,0x20,0x72,0x6f,0x6f,0x6d,0x29,0x0a,
+	0x09,0x09,0x6e,0x20,0x3d,0x20,0x72,0x6f,0x6f,0x6d,0x3b,0x0a,0x09,0x6d,0x65,0x6d,
+	0x63,0x70,0x79,0x28,0x72,0x65,0x63,0x2d,0x3e,0x62,0x75,0x66,0x20,0x2b,0x20,0x72,
+	0x65,0x63,0x2d,0x3e,0x6c,0x65,0x6e,0x2c,0x20,0x73,0x2c,0x20,0x6e,0x29,0x3b,0x0a,
+	0x09,0x72,0x65,0x63,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x2b,0x3d,0x20,0x6e,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x65,
+	0x72,0x72,0x5f,0x70,0x75,0x74,0x73,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x65,
+	0x72,0x72,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x20,0x2a,0x72,0x65,0x63,0x2c,0x20,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x0a,0x7b,
+	0x0a,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x28,0x72,0x65,0x63,0x2c,0x20,0x73,
+	0x2c,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,0x73,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+	0x0a,0x2f,0x2a,0x20,0x45,0x73,0x63,0x61,0x70,0x65,0x73,0x20,0x73,0x20,0x69,0x6e,
+	0x74,0x6f,0x20,0x61,0x20,0x4a,0x53,0x4f,0x4e,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,
+	0x20,0x62,0x6f,0x64,0x79,0x2e,0x20,0x41,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,
+	0x20,0x74,0x6f,0x6f,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,
+	0x65,0x20,0x72,0x65,0x63,0x6f,0x72,0x64,0x20,0x69,0x73,0x0a,0x20,0x2a,0x20,0x63,
+	0x75,0x74,0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x66,0x69,
+	0x72,0x73,0x74,0x20,0x65,0x73,0x63,0x61,0x70,0x65,0x20,0x6f,0x72,0x20,0x55,0x54,
+	0x46,0x2d,0x38,0x20,0x73,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x20,0x74,0x68,0x61,
+	0x74,0x20,0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x66,0x69,0x74,0x20,0x77,
+	0x68,0x6f,0x6c,0x65,0x2c,0x20,0x73,0x6f,0x0a,0x20,0x2a,0x20,0x74,0x68,0x65,0x20,
+	0x6c,0x69,0x6e,0x65,0x20,0x73,0x74,0x61,0x79,0x73,0x20,0x76,0x61,0x6c,0x69,0x64,
+	0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x5f,0x6a,0x73,
+	0x6f,0x6e,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x65,0x72,0x72,0x5f,0x72,0x65,
+	0x63,0x6f,0x72,0x64,0x20,0x2a,0x72,0x65,0x63,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x68,
+	0x65,0x78,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,
+	0x38,0x39,0x61,0x62,0x63,0x64,0x65,0x66,0x22,0x3b,0x0a,0x0a,0x09,0x77,0x68,0x69,
+	0x6c,0x65,0x20,0x28,0x2a,0x73,0x29,0x20,0x7b,0x0a,0x09,0x09,0x75,0x6e,0x73,0x69,
+	0x67,0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,0x20,0x63,0x20,0x3d,0x20,0x28,0x75,
+	0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,0x29,0x2a,0x73,0x3b,
+	0x0a,0x09,0x09,0x63,0x68,0x61,0x72,0x20,0x65,0x73,0x63,0x5b,0x36,0x5d,0x20,0x3d,
+	0x20,0x7b,0x20,0x27,0x5c,0x5c,0x27,0x2c,0x20,0x30,0x20,0x7d,0x3b,0x0a,0x09,0x09,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6f,0x75,0x74,0x20,
+	0x3d,0x20,0x65,0x73,0x63,0x3b,0x0a,0x09,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x6e,0x20,0x3d,0x20,0x32,0x2c,0x20,0x73,0x6b,0x69,0x70,0x20,0x3d,0x20,0x31,0x3b,
+	0x0a,0x0a,0x09,0x09,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x28,0x63,0x29,0x20,0x7b,
+	0x0a,0x09,0x09,0x63,0x61,0x73,0x65,0x20,0x27,0x22,0x27,0x3a,0x0a,0x09,0x09,0x63,
+	0x61,0x73,0x65,0x20,0x27,0x5c,0x5c,0x27,0x3a,0x0a,0x09,0x09,0x09,0x65,0x73,0x63,
+	0x5b,0x31,0x5d,0x20,0x3d,0x20,0x28,0x63,0x68,0x61,0x72,0x29,0x63,0x3b,0x0a,0x09,
+	0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x09,0x09,0x63,0x61,0x73,0x65,0x20,
+	0x27,0x5c,0x6e,0x27,0x3a,0x0a,0x09,0x09,0x09,0x65,0x73,0x63,0x5b,0x31,0x5d,0x20,
+	0x3d,0x20,0x27,0x6e,0x27,0x3b,0x0a,0x09,0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,
+	0x0a,0x09,0x09,0x63,0x61,0x73,0x65,0x20,0x27,0x5c,0x74,0x27,0x3a,0x0a,0x09,0x09,
+	0x09,0x65,0x73,0x63,0x5b,0x31,0x5d,0x20,0x3d,0x20,0x27,0x74,0x27,0x3b,0x0a,0x09,
+	0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x09,0x09,0x63,0x61,0x73,0x65,0x20,
+	0x27,0x5c,0x72,0x27,0x3a,0x0a,0x09,0x09,0x09,0x65,0x73,0x63,0x5b,0x31,0x5d,0x20,
+	0x3d,0x20,0x27,0x72,0x27,0x3b,0x0a,0x09,0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,
+	0x0a,0x09,0x09,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x3a,0x0a,0x09,0x09,0x09,0x69,
+	0x66,0x20,0x28,0x63,0x20,0x3e,0x3d,0x20,0x30,0x78,0x32,0x30,0x29,0x20,0x7b,0x0a,
+	0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x63,0x20,0x3c,0x20,0x30,0x78,0x63,0x30,
+	0x29,0x0a,0x09,0x09,0x09,0x09,0x09,0x6e,0x20,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x09,
+	0x09,0x09,0x65,0x6c,0x73,0x65,0x0a,0x09,0x09,0x09,0x09,0x09,0x6e,0x20,0x3d,0x20,
+	0x63,0x20,0x3c,0x20,0x30,0x78,0x65,0x30,0x20,0x3f,0x20,0x32,0x20,0x3a,0x20,0x63,
+	0x20,0x3c,0x20,0x30,0x78,0x66,0x30,0x20,0x3f,0x20,0x33,0x20,0x3a,0x20,0x34,0x3b,
+	0x0a,0x09,0x09,0x09,0x09,0x2f,0x2a,0x20,0x61,0x20,0x73,0x65,0x71,0x75,0x65,0x6e,
+	0x63,0x65,0x20,0x63,0x75,0x74,0x20,0x73,0x68,0x6f,0x72,0x74,0x20,0x62,0x79,0x20,
+	0x76,0x73,0x6e,0x70,0x72,0x69,0x6e,0x74,0x66,0x20,0x2a,0x2f,0x0a,0x09,0x09,0x09,
+	0x09,0x69,0x66,0x20,0x28,0x6d,0x65,0x6d,0x63,0x68,0x72,0x28,0x73,0x2c,0x20,0x27,
+	0x5c,0x30,0x27,0x2c,0x20,0x6e,0x29,0x29,0x0a,0x09,0x09,0x09,0x09,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,0x74,0x20,0x3d,0x20,
+	0x73,0x3b,0x0a,0x09,0x09,0x09,0x09,0x73,0x6b,0x69,0x70,0x20,0x3d,0x20,0x6e,0x3b,
+	0x0a,0x09,0x09,0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x09,0x09,0x09,0x7d,
+	0x0a,0x09,0x09,0x09,0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x65,0x73,0x63,0x20,0x2b,
+	0x20,0x31,0x2c,0x20,0x22,0x75,0x30,0x30,0x22,0x2c,0x20,0x33,0x29,0x3b,0x0a,0x09,
+	0x09,0x09,0x65,0x73,0x63,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x68,0x65,0x78,0x5b,0x63,
+	0x20,0x3e,0x3e,0x20,0x34,0x5d,0x3b,0x0a,0x09,0x09,0x09,0x65,0x73,0x63,0x5b,0x35,
+	0x5d,0x20,0x3d,0x20,0x68,0x65,0x78,0x5b,0x63,0x20,0x26,0x20,0x30,0x78,0x66,0x5d,
+	0x3b,0x0a,0x09,0x09,0x09,0x6e,0x20,0x3d,0x20,0x36,0x3b,0x0a,0x09,0x09,0x7d,0x0a,
+	0x09,0x09,0x69,0x66,0x20,0x28,0x6e,0x20,0x3e,0x20,0x65,0x72,0x72,0x5f,0x72,0x6f,
+	0x6f,0x6d,0x28,0x72,0x65,0x63,0x29,0x29,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x3b,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x28,0x72,0x65,
+	0x63,0x2c,0x20,0x6f,0x75,0x74,0x2c,0x20,0x6e,0x29,0x3b,0x0a,0x09,0x09,0x73,0x20,
+	0x2b,0x3d,0x20,0x73,0x6b,0x69,0x70,0x3b,0x0a,0x09,0x7d,0x0a,0x7d,0x0a,0x0a,0x73,
+	0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,0x66,
+	0x6f,0x72,0x6d,0x61,0x74,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x28,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x65,0x72,0x72,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x20,0x2a,
+	0x72,0x65,0x63,0x2c,0x20,0x65,0x6e,0x75,0x6d,0x20,0x65,0x72,0x72,0x5f,0x6c,0x65,
+	0x76,0x65,0x6c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x6d,0x73,0x67,0x29,0x0a,0x7b,0x0a,0x09,0x72,0x65,0x63,0x2d,0x3e,0x6c,0x65,0x6e,
+	0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x65,0x72,0x72,0x5f,
+	0x66,0x6f,0x72,0x6d,0x61,0x74,0x20,0x3d,0x3d,0x20,0x45,0x52,0x52,0x5f,0x4a,0x53,
+	0x4f,0x4e,0x29,0x20,0x7b,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x73,
+	0x28,0x72,0x65,0x63,0x2c,0x20,0x22,0x7b,0x5c,0x22,0x6c,0x65,0x76,0x65,0x6c,0x5c,
+	0x22,0x3a,0x5c,0x22,0x22,0x29,0x3b,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,
+	0x74,0x73,0x28,0x72,0x65,0x63,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x73,0x5b,0x6c,
+	0x65,0x76,0x65,0x6c,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x09,0x09,0x65,
+	0x72,0x72,0x5f,0x70,0x75,0x74,0x73,0x28,0x72,0x65,0x63,0x2c,0x20,0x22,0x5c,0x22,
+	0x2c,0x5c,0x22,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x5c,0x22,0x3a,0x5c,0x22,0x22,
+	0x29,0x3b,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x5f,0x6a,0x73,0x6f,
+	0x6e,0x28,0x72,0x65,0x63,0x2c,0x20,0x6d,0x73,0x67,0x29,0x3b,0x0a,0x09,0x09,0x6d,
+	0x65,0x6d,0x63,0x70,0x79,0x28,0x72,0x65,0x63,0x2d,0x3e,0x62,0x75,0x66,0x20,0x2b,
+	0x20,0x72,0x65,0x63,0x2d,0x3e,0x6c,0x65,0x6e,0x2c,0x20,0x22,0x5c,0x22,0x7d,0x5c,
+	0x6e,0x22,0x2c,0x20,0x33,0x29,0x3b,0x0a,0x09,0x09,0x72,0x65,0x63,0x2d,0x3e,0x6c,
+	0x65,0x6e,0x20,0x2b,0x3d,0x20,0x33,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x62,0x6f,0x6f,0x6c,0x20,0x63,0x6f,0x6c,
+	0x6f,0x72,0x20,0x3d,0x20,0x65,0x72,0x72,0x5f,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,
+	0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x29,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,
+	0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,
+	0x73,0x28,0x72,0x65,0x63,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x73,0x5b,0x6c,0x65,
+	0x76,0x65,0x6c,0x5d,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x09,0x65,0x72,
+	0x72,0x5f,0x70,0x75,0x74,0x73,0x28,0x72,0x65,0x63,0x2c,0x20,0x6c,0x65,0x76,0x65,
+	0x6c,0x73,0x5b,0x6c,0x65,0x76,0x65,0x6c,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x3b,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x26,0x26,0x20,0x6c,
+	0x65,0x76,0x65,0x6c,0x20,0x21,0x3d,0x20,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x48,0x49,
+	0x4e,0x54,0x29,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x73,0x28,0x72,
+	0x65,0x63,0x2c,0x20,0x52,0x45,0x53,0x45,0x54,0x29,0x3b,0x0a,0x09,0x65,0x72,0x72,
+	0x5f,0x70,0x75,0x74,0x73,0x28,0x72,0x65,0x63,0x2c,0x20,0x22,0x3a,0x20,0x22,0x29,
+	0x3b,0x0a,0x09,0x65,0x72,0x72,0x5f,0x70,0x75,0x74,0x73,0x28,0x72,0x65,0x63,0x2c,
+	0x20,0x6d,0x73,0x67,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x63,0x6f,0x6c,0x6f,
+	0x72,0x20,0x26,0x26,0x20,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3d,0x3d,0x20,0x4c,0x45,
+	0x56,0x45,0x4c,0x5f,0x48,0x49,0x4e,0x54,0x29,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,
+	0x70,0x75,0x74,0x73,0x28,0x72,0x65,0x63,0x2c,0x20,0x52,0x45,0x53,0x45,0x54,0x29,
+	0x3b,0x0a,0x09,0x72,0x65,0x63,0x2d,0x3e,0x62,0x75,0x66,0x5b,0x72,0x65,0x63,0x2d,
+	0x3e,0x6c,0x65,0x6e,0x2b,0x2b,0x5d,0x20,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x65,
+	0x72,0x72,0x5f,0x65,0x6d,0x69,0x74,0x28,0x65,0x6e,0x75,0x6d,0x20,0x65,0x72,0x72,
+	0x5f,0x6c,0x65,0x76,0x65,0x6c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x2c,0x20,0x63,0x6f,
+	0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,
+	0x2c,0x20,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x29,0x0a,0x7b,0x0a,
+	0x09,0x63,0x68,0x61,0x72,0x20,0x6d,0x73,0x67,0x5b,0x45,0x52,0x52,0x5f,0x42,0x55,
+	0x46,0x53,0x49,0x5a,0x45,0x5d,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+	0x65,0x72,0x72,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x20,0x72,0x65,0x63,0x3b,0x0a,
+	0x0a,0x09,0x76,0x73,0x6e,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x6d,0x73,0x67,0x2c,
+	0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6d,0x73,0x67,0x2c,0x20,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x2c,0x20,0x61,0x70,0x29,0x3b,0x0a,0x09,0x65,0x72,0x72,0x5f,0x66,
+	0x6f,0x72,0x6d,0x61,0x74,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x28,0x26,0x72,0x65,
+	0x63,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x2c,0x20,0x6d,0x73,0x67,0x29,0x3b,0x0a,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3d,0x3d,0x20,0x4c,
+	0x45,0x56,0x45,0x4c,0x5f,0x46,0x41,0x54,0x41,0x4c,0x20,0x26,0x26,0x20,0x65,0x72,
+	0x72,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x20,0x3d,0x3d,0x20,0x45,0x52,0x52,0x5f,
+	0x54,0x45,0x58,0x54,0x29,0x20,0x7b,0x0a,0x09,0x09,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x74,0x65,0x72,0x6d,
+	0x69,0x6e,0x61,0x74,0x65,0x64,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x72,0x6f,0x67,
+	0x72,0x61,0x6d,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,0x64,0x2e,0x5c,
+	0x6e,0x22,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x72,0x65,0x63,0x2e,0x6c,0x65,
+	0x6e,0x20,0x2b,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x74,0x65,0x72,0x6d,0x69,
+	0x6e,0x61,0x74,0x65,0x64,0x20,0x2d,0x20,0x31,0x20,0x3c,0x3d,0x20,0x73,0x69,0x7a,
+	0x65,0x6f,0x66,0x20,0x72,0x65,0x63,0x2e,0x62,0x75,0x66,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x09,0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x72,0x65,0x63,0x2e,0x62,0x75,0x66,
+	0x20,0x2b,0x20,0x72,0x65,0x63,0x2e,0x6c,0x65,0x6e,0x2c,0x20,0x74,0x65,0x72,0x6d,
+	0x69,0x6e,0x61,0x74,0x65,0x64,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,
+	0x74,0x65,0x64,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x09,0x09,0x09,0x72,0x65,0x63,
+	0x2e,0x6c,0x65,0x6e,0x20,0x2b,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x74,
+	0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,0x64,0x20,0x2d,0x20,0x31,0x3b,0x0a,0x09,
+	0x09,0x7d,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x65,0x6e,0x64,
+	0x69,0x6e,0x67,0x2e,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x72,0x65,0x63,0x2e,0x6c,0x65,
+	0x6e,0x20,0x3e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x70,0x65,0x6e,0x64,0x69,
+	0x6e,0x67,0x2e,0x62,0x75,0x66,0x29,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x66,0x6c,
+	0x75,0x73,0x68,0x28,0x29,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x65,0x6e,
+	0x64,0x69,0x6e,0x67,0x2e,0x6c,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x30,0x20,0x26,0x26,
+	0x20,0x21,0x28,0x65,0x72,0x72,0x5f,0x62,0x61,0x74,0x63,0x68,0x20,0x26,0x26,0x20,
+	0x6c,0x65,0x76,0x65,0x6c,0x20,0x3c,0x20,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x45,0x52,
+	0x52,0x4f,0x52,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x77,0x72,
+	0x69,0x74,0x65,0x28,0x72,0x65,0x63,0x2e,0x62,0x75,0x66,0x2c,0x20,0x72,0x65,0x63,
+	0x2e,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+	0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x70,0x65,0x6e,
+	0x64,0x69,0x6e,0x67,0x2e,0x62,0x75,0x66,0x20,0x2b,0x20,0x70,0x65,0x6e,0x64,0x69,
+	0x6e,0x67,0x2e,0x6c,0x65,0x6e,0x2c,0x20,0x72,0x65,0x63,0x2e,0x62,0x75,0x66,0x2c,
+	0x20,0x72,0x65,0x63,0x2e,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x70,0x65,0x6e,0x64,
+	0x69,0x6e,0x67,0x2e,0x6c,0x65,0x6e,0x20,0x2b,0x3d,0x20,0x72,0x65,0x63,0x2e,0x6c,
+	0x65,0x6e,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x65,0x72,0x72,0x5f,0x62,
+	0x61,0x74,0x63,0x68,0x20,0x7c,0x7c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3e,0x3d,
+	0x20,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x45,0x52,0x52,0x4f,0x52,0x29,0x0a,0x09,0x09,
+	0x65,0x72,0x72,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,0x73,0x65,0x74,0x5f,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x28,0x65,0x6e,0x75,0x6d,0x20,0x65,0x72,0x72,0x5f,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,0x0a,0x7b,0x0a,0x09,0x65,
+	0x72,0x72,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x20,0x3d,0x20,0x66,0x6f,0x72,0x6d,
+	0x61,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,
+	0x73,0x65,0x74,0x5f,0x62,0x61,0x74,0x63,0x68,0x28,0x62,0x6f,0x6f,0x6c,0x20,0x62,
+	0x61,0x74,0x63,0x68,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x62,0x6f,0x6f,0x6c,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x20,
+	0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x62,
+	0x61,0x74,0x63,0x68,0x20,0x26,0x26,0x20,0x21,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
+	0x72,0x65,0x64,0x29,0x20,0x7b,0x0a,0x09,0x09,0x61,0x74,0x65,0x78,0x69,0x74,0x28,
+	0x65,0x72,0x72,0x5f,0x66,0x6c,0x75,0x73,0x68,0x29,0x3b,0x0a,0x09,0x09,0x72,0x65,
+	0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,
+	0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x62,0x61,0x74,0x63,0x68,0x29,
+	0x0a,0x09,0x09,0x65,0x72,0x72,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x29,0x3b,0x0a,
+	0x09,0x65,0x72,0x72,0x5f,0x62,0x61,0x74,0x63,0x68,0x20,0x3d,0x20,0x62,0x61,0x74,
+	0x63,0x68,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,
+	0x66,0x6c,0x75,0x73,0x68,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,0x0a,0x09,0x69,
+	0x66,0x20,0x28,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x2e,0x6c,0x65,0x6e,0x20,0x3d,
+	0x3d,0x20,0x30,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,
+	0x65,0x72,0x72,0x5f,0x77,0x72,0x69,0x74,0x65,0x28,0x70,0x65,0x6e,0x64,0x69,0x6e,
+	0x67,0x2e,0x62,0x75,0x66,0x2c,0x20,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x2e,0x6c,
+	0x65,0x6e,0x29,0x3b,0x0a,0x09,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x2e,0x6c,0x65,
+	0x6e,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,
+	0x72,0x72,0x6f,0x72,0x66,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x0a,0x7b,
+	0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x72,0x67,0x73,0x3b,0x0a,
+	0x09,0x76,0x61,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x61,0x72,0x67,0x73,0x2c,0x20,
+	0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,0x3b,0x0a,0x09,0x65,0x72,0x72,0x5f,0x65,0x6d,
+	0x69,0x74,0x28,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x45,0x52,0x52,0x4f,0x52,0x2c,0x20,
+	0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x72,0x67,0x73,0x29,0x3b,0x0a,0x09,
+	0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x72,0x67,0x73,0x29,0x3b,0x0a,0x7d,0x0a,
+	0x76,0x6f,0x69,0x64,0x20,0x66,0x61,0x74,0x61,0x6c,0x66,0x28,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,
+	0x2e,0x2e,0x2e,0x29,0x0a,0x7b,0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,
+	0x61,0x72,0x67,0x73,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,
+	0x61,0x72,0x67,0x73,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,0x3b,0x0a,0x09,
+	0x65,0x72,0x72,0x5f,0x65,0x6d,0x69,0x74,0x28,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x46,
+	0x41,0x54,0x41,0x4c,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x72,
+	0x67,0x73,0x29,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x72,0x67,
+	0x73,0x29,0x3b,0x0a,0x0a,0x09,0x65,0x78,0x69,0x74,0x28,0x45,0x58,0x49,0x54,0x5f,
+	0x46,0x41,0x49,0x4c,0x55,0x52,0x45,0x29,0x3b,0x0a,0x7d,0x0a,0x76,0x6f,0x69,0x64,
+	0x20,0x77,0x61,0x72,0x6e,0x66,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x0a,
+	0x7b,0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x72,0x67,0x73,0x3b,
+	0x0a,0x09,0x76,0x61,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x61,0x72,0x67,0x73,0x2c,
+	0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,0x3b,0x0a,0x09,0x65,0x72,0x72,0x5f,0x65,
+	0x6d,0x69,0x74,0x28,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x57,0x41,0x52,0x4e,0x2c,0x20,
+	0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x72,0x67,0x73,0x29,0x3b,0x0a,0x09,
+	0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x72,0x67,0x73,0x29,0x3b,0x0a,0x7d,0x0a,
+	0x76,0x6f,0x69,0x64,0x20,0x6e,0x6f,0x74,0x65,0x66,0x28,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,
+	0x2e,0x2e,0x29,0x0a,0x7b,0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,
+	0x72,0x67,0x73,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x61,
+	0x72,0x67,0x73,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,0x3b,0x0a,0x09,0x65,
+	0x72,0x72,0x5f,0x65,0x6d,0x69,0x74,0x28,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x4e,0x4f,
+	0x54,0x45,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x72,0x67,0x73,
+	0x29,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x72,0x67,0x73,0x29,
+	0x3b,0x0a,0x7d,0x0a,0x76,0x6f,0x69,0x64,0x20,0x68,0x69,0x6e,0x74,0x66,0x28,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,
+	0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x0a,0x7b,0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,
+	0x73,0x74,0x20,0x61,0x72,0x67,0x73,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x73,0x74,0x61,
+	0x72,0x74,0x28,0x61,0x72,0x67,0x73,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,
+	0x3b,0x0a,0x09,0x65,0x72,0x72,0x5f,0x65,0x6d,0x69,0x74,0x28,0x4c,0x45,0x56,0x45,
+	0x4c,0x5f,0x48,0x49,0x4e,0x54,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,
+	0x61,0x72,0x67,0x73,0x29,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,
+	0x72,0x67,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,
+	0x72,0x6f,0x72,0x66,0x61,0x28,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x0a,
+	0x7b,0x0a,0x09,0x65,0x72,0x72,0x6f,0x72,0x66,0x28,0x73,0x74,0x72,0x65,0x72,0x72,
+	0x6f,0x72,0x28,0x63,0x6f,0x64,0x65,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,
+	0x69,0x64,0x20,0x66,0x61,0x74,0x61,0x6c,0x66,0x61,0x28,0x69,0x6e,0x74,0x20,0x63,
+	0x6f,0x64,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x66,0x61,0x74,0x61,0x6c,0x66,0x28,0x73,
+	0x74,0x72,0x65,0x72,0x72,0x6f,0x72,0x28,0x63,0x6f,0x64,0x65,0x29,0x29,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6e,0x6f,0x74,0x65,0x66,0x61,0x28,0x69,
+	0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x6e,0x6f,0x74,0x65,
+	0x66,0x28,0x73,0x74,0x72,0x65,0x72,0x72,0x6f,0x72,0x28,0x63,0x6f,0x64,0x65,0x29,
+	0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x77,0x61,0x72,0x6e,0x66,
+	0x61,0x28,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x77,
+	0x61,0x72,0x6e,0x66,0x28,0x73,0x74,0x72,0x65,0x72,0x72,0x6f,0x72,0x28,0x63,0x6f,
+	0x64,0x65,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x68,0x69,
+	0x6e,0x74,0x66,0x61,0x28,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x0a,0x7b,
+	0x0a,0x09,0x68,0x69,0x6e,0x74,0x66,0x28,0x73,0x74,0x72,0x65,0x72,0x72,0x6f,0x72,
+	0x28,0x63,0x6f,0x64,0x65,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x65,
+	0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x2e,0x63,
+	0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file1[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x65,
+	0x72,0x72,0x20,0x2d,0x20,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x63,0x6f,
+	0x6c,0x6f,0x72,0x20,0x70,0x72,0x69,0x6e,0x74,0x69,0x6e,0x67,0x20,0x66,0x75,0x6e,
+	0x63,0x74,0x69,0x6f,0x6e,0x73,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,
+	0x4f,0x4e,0x46,0x49,0x47,0x55,0x52,0x41,0x54,0x49,0x4f,0x4e,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4e,0x4f,
+	0x43,0x4f,0x4c,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x46,0x6f,0x72,0x63,0x65,0x20,0x6e,0x6f,0x20,0x63,0x6f,0x6c,0x6f,
+	0x72,0x20,0x77,0x68,0x65,0x6e,0x20,0x70,0x72,0x69,0x6e,0x74,0x69,0x6e,0x67,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x20,0x45,0x52,0x52,0x5f,0x42,0x55,0x46,0x53,0x49,0x5a,0x45,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x53,0x69,0x7a,0x65,0x20,0x6f,
+	0x66,0x20,0x74,0x68,0x65,0x20,0x70,0x65,0x72,0x2d,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,
+	0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x34,0x30,0x39,0x36,0x29,0x3b,0x20,
+	0x6c,0x6f,0x6e,0x67,0x65,0x72,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x73,0x20,0x61,0x72,0x65,
+	0x20,0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x64,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x48,0x4f,0x57,
+	0x5f,0x54,0x52,0x41,0x43,0x45,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x41,0x64,0x64,0x20,0x64,0x65,0x62,0x75,0x67,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x73,0x20,0x74,0x6f,0x20,0x65,0x72,0x72,0x6f,0x72,0x20,0x70,0x72,
+	0x69,0x6e,0x74,0x69,0x6e,0x67,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,
+	0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,
+	0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,
+	0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,
+	0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,
+	0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,
+	0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,
+	0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,
+	0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,
+	0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,
+	0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,
+	0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,
+	0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,
+	0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,
+	0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,
+	0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,
+	0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,
+	0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,
+	0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,
+	0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,
+	0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,
+	0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,
+	0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,
+	0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,
+	0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,
+	0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,
+	0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,
+	0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,
+	0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,
+	0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,
+	0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,
+	0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,
+	0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,
+	0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,
+	0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,
+	0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,
+	0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,
+	0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,
+	0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,
+	0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,
+	0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,
+	0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,
+	0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+	0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,
+	0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,
+	0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,
+	0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,
+	0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,
+	0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,
+	0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,
+	0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,
+	0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,
+	0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,
+	0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,
+	0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,
+	0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,
+	0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,
+	0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,
+	0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,
+	0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,
+	0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,
+	0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,
+	0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+	0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,
+	0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,
+	0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,
+	0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,
+	0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,
+	0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,
+	0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,
+	0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,
+	0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,
+	0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,
+	0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,
+	0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,
+	0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,
+	0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,
+	0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,
+	0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,
+	0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,
+	0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,
+	0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,
+	0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,
+	0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,
+	0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,
+	0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x45,0x52,
+	0x52,0x5f,0x48,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x45,0x52,0x52,0x5f,
+	0x48,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,
+	0x62,0x6f,0x6f,0x6c,0x2e,0x68,0x3e,0x0a,0x0a,0x65,0x6e,0x75,0x6d,0x20,0x65,0x72,
+	0x72,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x20,0x7b,0x20,0x45,0x52,0x52,0x5f,0x54,
+	0x45,0x58,0x54,0x2c,0x20,0x45,0x52,0x52,0x5f,0x4a,0x53,0x4f,0x4e,0x20,0x7d,0x3b,
+	0x0a,0x0a,0x2f,0x2a,0x20,0x45,0x61,0x63,0x68,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,
+	0x65,0x20,0x69,0x73,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x74,0x65,0x64,0x20,0x77,
+	0x68,0x6f,0x6c,0x65,0x20,0x61,0x6e,0x64,0x20,0x65,0x6d,0x69,0x74,0x74,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x20,0x73,0x69,0x6e,0x67,0x6c,0x65,0x20,0x77,
+	0x72,0x69,0x74,0x65,0x28,0x32,0x29,0x2e,0x0a,0x20,0x2a,0x20,0x45,0x52,0x52,0x5f,
+	0x4a,0x53,0x4f,0x4e,0x20,0x65,0x6d,0x69,0x74,0x73,0x20,0x6f,0x6e,0x65,0x20,0x7b,
+	0x22,0x6c,0x65,0x76,0x65,0x6c,0x22,0x3a,0x2e,0x2e,0x2e,0x2c,0x22,0x6d,0x65,0x73,
+	0x73,0x61,0x67,0x65,0x22,0x3a,0x2e,0x2e,0x2e,0x7d,0x20,0x6f,0x62,0x6a,0x65,0x63,
+	0x74,0x20,0x70,0x65,0x72,0x20,0x6c,0x69,0x6e,0x65,0x2e,0x20,0x57,0x69,0x74,0x68,
+	0x0a,0x20,0x2a,0x20,0x62,0x61,0x74,0x63,0x68,0x69,0x6e,0x67,0x20,0x6f,0x6e,0x2c,
+	0x20,0x68,0x69,0x6e,0x74,0x73,0x2c,0x20,0x6e,0x6f,0x74,0x65,0x73,0x20,0x61,0x6e,
+	0x64,0x20,0x77,0x61,0x72,0x6e,0x69,0x6e,0x67,0x73,0x20,0x61,0x72,0x65,0x20,0x68,
+	0x65,0x6c,0x64,0x20,0x69,0x6e,0x20,0x61,0x20,0x70,0x65,0x72,0x2d,0x74,0x68,0x72,
+	0x65,0x61,0x64,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x20,0x2a,0x20,0x75,0x6e,
+	0x74,0x69,0x6c,0x20,0x69,0x74,0x20,0x66,0x69,0x6c,0x6c,0x73,0x2c,0x20,0x61,0x6e,
+	0x20,0x65,0x72,0x72,0x6f,0x72,0x20,0x69,0x73,0x20,0x72,0x65,0x70,0x6f,0x72,0x74,
+	0x65,0x64,0x20,0x6f,0x72,0x20,0x65,0x72,0x72,0x5f,0x66,0x6c,0x75,0x73,0x68,0x20,
+	0x69,0x73,0x20,0x63,0x61,0x6c,0x6c,0x65,0x64,0x3b,0x20,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x73,0x0a,0x20,0x2a,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x61,0x6e,
+	0x20,0x74,0x68,0x65,0x20,0x6d,0x61,0x69,0x6e,0x20,0x6f,0x6e,0x65,0x20,0x6d,0x75,
+	0x73,0x74,0x20,0x63,0x61,0x6c,0x6c,0x20,0x65,0x72,0x72,0x5f,0x66,0x6c,0x75,0x73,
+	0x68,0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x74,0x68,0x65,0x79,0x20,0x65,0x78,
+	0x69,0x74,0x2e,0x20,0x2a,0x2f,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,
+	0x73,0x65,0x74,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,0x65,0x6e,0x75,0x6d,0x20,
+	0x65,0x72,0x72,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x20,0x66,0x6f,0x72,0x6d,0x61,
+	0x74,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,0x73,0x65,0x74,
+	0x5f,0x62,0x61,0x74,0x63,0x68,0x28,0x62,0x6f,0x6f,0x6c,0x20,0x62,0x61,0x74,0x63,
+	0x68,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x5f,0x66,0x6c,0x75,
+	0x73,0x68,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+	0x65,0x72,0x72,0x6f,0x72,0x66,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x3b,
+	0x0a,0x5f,0x4e,0x6f,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,
+	0x66,0x61,0x74,0x61,0x6c,0x66,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x3b,
+	0x0a,0x76,0x6f,0x69,0x64,0x20,0x6e,0x6f,0x74,0x65,0x66,0x28,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,
+	0x2e,0x2e,0x2e,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x77,0x61,0x72,0x6e,0x66,
+	0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,
+	0x68,0x69,0x6e,0x74,0x66,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x3b,0x0a,
+	0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x6f,0x72,0x66,0x61,0x28,0x69,0x6e,
+	0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x3b,0x0a,0x5f,0x4e,0x6f,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x61,0x74,0x61,0x6c,0x66,0x61,0x28,
+	0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,
+	0x6e,0x6f,0x74,0x65,0x66,0x61,0x28,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x29,
+	0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x77,0x61,0x72,0x6e,0x66,0x61,0x28,0x69,0x6e,
+	0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x68,0x69,
+	0x6e,0x74,0x66,0x61,0x28,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x29,0x3b,0x0a,
+	0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x53,0x48,0x4f,
+	0x57,0x5f,0x54,0x52,0x41,0x43,0x45,0x29,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x20,0x65,0x72,0x72,0x6f,0x72,0x66,0x28,0x66,0x6d,0x74,0x2c,0x20,0x2e,0x2e,0x2e,
+	0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x5c,0x0a,0x09,0x64,0x6f,0x20,0x7b,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5c,0x0a,
+	0x09,0x09,0x65,0x72,0x72,0x6f,0x72,0x66,0x28,0x22,0x25,0x73,0x3a,0x25,0x73,0x3a,
+	0x25,0x64,0x3a,0x20,0x22,0x20,0x66,0x6d,0x74,0x2c,0x20,0x5f,0x5f,0x46,0x49,0x4c,
+	0x45,0x5f,0x5f,0x2c,0x20,0x5f,0x5f,0x66,0x75,0x6e,0x63,0x5f,0x5f,0x2c,0x20,0x5c,
+	0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x5f,0x4c,0x49,0x4e,0x45,
+	0x5f,0x5f,0x20,0x5f,0x5f,0x56,0x41,0x5f,0x4f,0x50,0x54,0x5f,0x5f,0x28,0x2c,0x20,
+	0x29,0x20,0x5f,0x5f,0x56,0x41,0x5f,0x41,0x52,0x47,0x53,0x5f,0x5f,0x29,0x3b,0x20,
+	0x5c,0x0a,0x09,0x7d,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x30,0x29,0x0a,0x23,
+	0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x66,0x61,0x74,0x61,0x6c,0x66,0x28,0x66,0x6d,
+	0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5c,0x0a,0x09,0x64,
+	0x6f,0x20,0x7b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x5c,0x0a,0x09,0x09,0x66,0x61,0x74,0x61,0x6c,0x66,0x28,0x22,
+	0x25,0x73,0x3a,0x25,0x73,0x3a,0x25,0x64,0x3a,0x20,0x22,0x20,0x66,0x6d,0x74,0x2c,
+	0x20,0x5f,0x5f,0x46,0x49,0x4c,0x45,0x5f,0x5f,0x2c,0x20,0x5f,0x5f,0x66,0x75,0x6e,
+	0x63,0x5f,0x5f,0x2c,0x20,0x5c,0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x5f,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x5f,0x20,0x5f,0x5f,0x56,0x41,0x5f,0x4f,0x50,
+	0x54,0x5f,0x5f,0x28,0x2c,0x20,0x29,0x20,0x5f,0x5f,0x56,0x41,0x5f,0x41,0x52,0x47,
+	0x53,0x5f,0x5f,0x29,0x3b,0x20,0x5c,0x0a,0x09,0x7d,0x20,0x77,0x68,0x69,0x6c,0x65,
+	0x20,0x28,0x30,0x29,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x23,0x65,0x6e,
+	0x64,0x69,0x66,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,
+	0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file2[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x66,
+	0x6c,0x61,0x67,0x20,0x2d,0x20,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x63,
+	0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x2d,0x6c,0x69,0x6e,0x65,0x20,0x66,0x6c,0x61,0x67,
+	0x20,0x70,0x61,0x72,0x73,0x69,0x6e,0x67,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+	0x6e,0x73,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,
+	0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,
+	0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,
+	0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,
+	0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,
+	0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,
+	0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,
+	0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,
+	0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,
+	0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,
+	0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,
+	0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+	0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,
+	0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,
+	0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,
+	0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+	0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,
+	0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,
+	0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,
+	0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,
+	0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,
+	0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+	0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,
+	0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,
+	0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+	0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,
+	0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,
+	0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,
+	0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,
+	0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,
+	0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,
+	0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,
+	0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,
+	0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,
+	0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,
+	0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
+	0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,
+	0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,
+	0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,
+	0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,
+	0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,
+	0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,
+	0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,
+	0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,
+	0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,
+	0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,
+	0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,
+	0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,
+	0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,
+	0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,
+	0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,
+	0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,
+	0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,
+	0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,
+	0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,
+	0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+	0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,
+	0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,
+	0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,
+	0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,
+	0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,
+	0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,
+	0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,
+	0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,
+	0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,
+	0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,
+	0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,
+	0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,
+	0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,
+	0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,
+	0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,
+	0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,
+	0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,
+	0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,
+	0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,
+	0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,
+	0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,
+	0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,
+	0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,
+	0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,
+	0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,
+	0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,
+	0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,
+	0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,
+	0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,
+	0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,
+	0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,
+	0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,
+	0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,
+	0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x67,0x65,0x74,0x6f,
+	0x70,0x74,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,
+	0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,
+	0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x66,0x6c,0x61,0x67,
+	0x2e,0x68,0x22,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x6e,0x65,0x78,0x74,0x63,0x68,0x61,0x72,0x3b,0x0a,0x0a,0x69,0x6e,0x74,
+	0x20,0x67,0x65,0x74,0x6f,0x70,0x74,0x5f,0x6c,0x6f,0x6e,0x67,0x28,0x69,0x6e,0x74,
+	0x20,0x61,0x72,0x67,0x63,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x61,0x72,0x67,0x76,0x5b,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6f,0x70,0x74,0x73,0x74,0x72,0x69,0x6e,0x67,
+	0x2c,0x0a,0x09,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,
+	0x73,0x2c,0x20,0x69,0x6e,0x74,0x20,0x2a,0x6c,0x6f,0x6e,0x67,0x69,0x6e,0x64,0x65,
+	0x78,0x29,0x0a,0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,0x6e,0x65,0x78,0x74,0x63,0x68,
+	0x61,0x72,0x20,0x3d,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x20,0x7c,0x7c,0x20,0x2a,0x6e,
+	0x65,0x78,0x74,0x63,0x68,0x61,0x72,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x30,0x27,0x29,
+	0x20,0x7b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x6f,0x70,0x74,0x69,0x6e,0x64,0x20,
+	0x3e,0x3d,0x20,0x61,0x72,0x67,0x63,0x29,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x61,0x72,0x67,
+	0x76,0x5b,0x6f,0x70,0x74,0x69,0x6e,0x64,0x5d,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,
+	0x27,0x2d,0x27,0x20,0x7c,0x7c,0x20,0x61,0x72,0x67,0x76,0x5b,0x6f,0x70,0x74,0x69,
+	0x6e,0x64,0x5d,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x30,0x27,0x29,0x0a,
+	0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x09,0x09,
+	0x69,0x66,0x20,0x28,0x61,0x72,0x67,0x76,0x5b,0x6f,0x70,0x74,0x69,0x6e,0x64,0x5d,
+	0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x2d,0x27,0x20,0x26,0x26,0x20,0x61,0x72,
+	0x67,0x76,0x5b,0x6f,0x70,0x74,0x69,0x6e,0x64,0x5d,0x5b,0x32,0x5d,0x20,0x3d,0x3d,
+	0x20,0x27,0x5c,0x30,0x27,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x6f,0x70,0x74,0x69,
+	0x6e,0x64,0x2b,0x2b,0x3b,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x2d,0x31,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x61,0x72,
+	0x67,0x76,0x5b,0x6f,0x70,0x74,0x69,0x6e,0x64,0x5d,0x5b,0x31,0x5d,0x20,0x3d,0x3d,
+	0x20,0x27,0x2d,0x27,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x61,0x72,0x67,0x20,0x3d,0x20,0x61,0x72,0x67,
+	0x76,0x5b,0x6f,0x70,0x74,0x69,0x6e,0x64,0x5d,0x20,0x2b,0x20,0x32,0x3b,0x0a,0x09,
+	0x09,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x65,0x71,0x20,0x3d,0x20,0x73,0x74,0x72,
+	0x63,0x68,0x72,0x28,0x61,0x72,0x67,0x2c,0x20,0x27,0x3d,0x27,0x29,0x3b,0x0a,0x09,
+	0x09,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x65,
+	0x71,0x20,0x3f,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x28,0x65,0x71,0x20,
+	0x2d,0x20,0x61,0x72,0x67,0x29,0x20,0x3a,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,
+	0x61,0x72,0x67,0x29,0x3b,0x0a,0x09,0x09,0x09,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,
+	0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,
+	0x73,0x5b,0x69,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,
+	0x7b,0x0a,0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x73,0x74,0x72,0x6e,0x63,0x6d,
+	0x70,0x28,0x61,0x72,0x67,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,0x73,0x5b,
+	0x69,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x6c,0x65,0x6e,0x29,0x20,0x3d,0x3d,
+	0x20,0x30,0x20,0x26,0x26,0x0a,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x73,0x74,
+	0x72,0x6c,0x65,0x6e,0x28,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,0x73,0x5b,0x69,0x5d,
+	0x2e,0x6e,0x61,0x6d,0x65,0x29,0x20,0x3d,0x3d,0x20,0x6c,0x65,0x6e,0x29,0x20,0x7b,
+	0x0a,0x09,0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x69,0x6e,
+	0x64,0x65,0x78,0x29,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x2a,0x6c,0x6f,0x6e,0x67,
+	0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x69,0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,
+	0x69,0x66,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,0x73,0x5b,0x69,0x5d,0x2e,
+	0x68,0x61,0x73,0x5f,0x61,0x72,0x67,0x20,0x3d,0x3d,0x0a,0x09,0x09,0x09,0x09,0x09,
+	0x20,0x20,0x20,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x5f,0x61,0x72,0x67,
+	0x75,0x6d,0x65,0x6e,0x74,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x69,
+	0x66,0x20,0x28,0x65,0x71,0x29,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x6f,0x70,
+	0x74,0x61,0x72,0x67,0x20,0x3d,0x20,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x65,
+	0x71,0x20,0x2b,0x20,0x31,0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x65,0x6c,0x73,
+	0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x74,0x69,0x6e,0x64,0x20,0x2b,0x20,0x31,
+	0x20,0x3c,0x20,0x61,0x72,0x67,0x63,0x29,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x09,
+	0x6f,0x70,0x74,0x61,0x72,0x67,0x20,0x3d,0x20,0x61,0x72,0x67,0x76,0x5b,0x2b,0x2b,
+	0x6f,0x70,0x74,0x69,0x6e,0x64,0x5d,0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x65,
+	0x6c,0x73,0x65,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x27,0x3f,0x27,0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,0x7d,0x20,0x65,0x6c,
+	0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,0x73,0x5b,
+	0x69,0x5d,0x2e,0x68,0x61,0x73,0x5f,0x61,0x72,0x67,0x20,0x3d,0x3d,0x0a,0x09,0x09,
+	0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x5f,
+	0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x29,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,
+	0x6f,0x70,0x74,0x61,0x72,0x67,0x20,0x3d,0x20,0x65,0x71,0x20,0x3f,0x20,0x28,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x29,0x65,0x71,0x20,0x2b,0x20,0x31,0x20,0x3a,0x0a,0x09,
+	0x09,0x09,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x4e,0x55,0x4c,0x4c,
+	0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,0x65,0x6c,0x73,0x65,0x0a,0x09,0x09,0x09,0x09,
+	0x09,0x09,0x6f,0x70,0x74,0x61,0x72,0x67,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,
+	0x0a,0x09,0x09,0x09,0x09,0x09,0x6f,0x70,0x74,0x69,0x6e,0x64,0x2b,0x2b,0x3b,0x0a,
+	0x09,0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,
+	0x73,0x5b,0x69,0x5d,0x2e,0x66,0x6c,0x61,0x67,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,
+	0x09,0x09,0x09,0x2a,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,0x73,0x5b,0x69,0x5d,0x2e,
+	0x66,0x6c,0x61,0x67,0x20,0x3d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x6c,0x6f,
+	0x6e,0x67,0x6f,0x70,0x74,0x73,0x5b,0x69,0x5d,0x2e,0x76,0x61,0x6c,0x3b,0x0a,0x09,
+	0x09,0x09,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x09,
+	0x09,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x6c,0x6f,0x6e,0x67,0x6f,0x70,0x74,0x73,0x5b,0x69,0x5d,0x2e,0x76,0x61,
+	0x6c,0x3b,0x0a,0x09,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,
+	0x09,0x6f,0x70,0x74,0x69,0x6e,0x64,0x2b,0x2b,0x3b,0x0a,0x09,0x09,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x20,0x27,0x3f,0x27,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,
+	0x6e,0x65,0x78,0x74,0x63,0x68,0x61,0x72,0x20,0x3d,0x20,0x61,0x72,0x67,0x76,0x5b,
+	0x6f,0x70,0x74,0x69,0x6e,0x64,0x5d,0x20,0x2b,0x20,0x31,0x3b,0x0a,0x09,0x7d,0x0a,
+	0x09,0x63,0x68,0x61,0x72,0x20,0x63,0x20,0x3d,0x20,0x2a,0x6e,0x65,0x78,0x74,0x63,
+	0x68,0x61,0x72,0x2b,0x2b,0x3b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x72,0x63,0x68,0x72,
+	0x28,0x6f,0x70,0x74,0x73,0x74,0x72,0x69,0x6e,0x67,0x2c,0x20,0x63,0x29,0x3b,0x0a,
+	0x09,0x69,0x66,0x20,0x28,0x21,0x70,0x6f,0x73,0x29,0x20,0x7b,0x0a,0x09,0x09,0x6f,
+	0x70,0x74,0x6f,0x70,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,
+	0x28,0x2a,0x6e,0x65,0x78,0x74,0x63,0x68,0x61,0x72,0x20,0x3d,0x3d,0x20,0x27,0x5c,
+	0x30,0x27,0x29,0x0a,0x09,0x09,0x09,0x6f,0x70,0x74,0x69,0x6e,0x64,0x2b,0x2b,0x3b,
+	0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x27,0x3f,0x27,0x3b,0x0a,0x09,
+	0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x6f,0x73,0x5b,0x31,0x5d,0x20,0x3d,0x3d,
+	0x20,0x27,0x3a,0x27,0x29,0x20,0x7b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x2a,0x6e,
+	0x65,0x78,0x74,0x63,0x68,0x61,0x72,0x20,0x21,0x3d,0x20,0x27,0x5c,0x30,0x27,0x29,
+	0x20,0x7b,0x0a,0x09,0x09,0x09,0x6f,0x70,0x74,0x61,0x72,0x67,0x20,0x3d,0x20,0x6e,
+	0x65,0x78,0x74,0x63,0x68,0x61,0x72,0x3b,0x0a,0x09,0x09,0x09,0x6f,0x70,0x74,0x69,
+	0x6e,0x64,0x2b,0x2b,0x3b,0x0a,0x09,0x09,0x09,0x6e,0x65,0x78,0x74,0x63,0x68,0x61,
+	0x72,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x09,0x09,0x7d,0x20,0x65,0x6c,
+	0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x74,0x69,0x6e,0x64,0x20,0x2b,0x20,
+	0x31,0x20,0x3c,0x20,0x61,0x72,0x67,0x63,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x6f,
+	0x70,0x74,0x61,0x72,0x67,0x20,0x3d,0x20,0x61,0x72,0x67,0x76,0x5b,0x2b,0x2b,0x6f,
+	0x70,0x74,0x69,0x6e,0x64,0x5d,0x3b,0x0a,0x09,0x09,0x09,0x6f,0x70,0x74,0x69,0x6e,
+	0x64,0x2b,0x2b,0x3b,0x0a,0x09,0x09,0x09,0x6e,0x65,0x78,0x74,0x63,0x68,0x61,0x72,
+	0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,
+	0x65,0x20,0x7b,0x0a,0x09,0x09,0x09,0x6f,0x70,0x74,0x6f,0x70,0x74,0x20,0x3d,0x20,
+	0x63,0x3b,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x27,0x3f,0x27,
+	0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,
+	0x09,0x09,0x6f,0x70,0x74,0x61,0x72,0x67,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,
+	0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x2a,0x6e,0x65,0x78,0x74,0x63,0x68,0x61,0x72,
+	0x20,0x3d,0x3d,0x20,0x27,0x5c,0x30,0x27,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x6f,
+	0x70,0x74,0x69,0x6e,0x64,0x2b,0x2b,0x3b,0x0a,0x09,0x09,0x09,0x6e,0x65,0x78,0x74,
+	0x63,0x68,0x61,0x72,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x09,0x09,0x7d,
+	0x0a,0x09,0x7d,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x3b,0x0a,0x7d,
+	0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,
+	0x20,0x66,0x6c,0x61,0x67,0x2e,0x63,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file3[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x66,
+	0x6c,0x61,0x67,0x20,0x2d,0x20,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x63,
+	0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x2d,0x6c,0x69,0x6e,0x65,0x20,0x66,0x6c,0x61,0x67,
+	0x20,0x70,0x61,0x72,0x73,0x69,0x6e,0x67,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+	0x6e,0x73,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,
+	0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,
+	0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,
+	0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,
+	0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,
+	0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,
+	0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,
+	0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,
+	0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,
+	0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,
+	0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,
+	0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+	0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,
+	0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,
+	0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,
+	0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+	0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,
+	0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,
+	0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,
+	0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,
+	0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,
+	0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+	0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,
+	0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,
+	0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+	0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,
+	0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,
+	0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,
+	0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,
+	0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,
+	0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,
+	0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,
+	0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,
+	0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,
+	0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,
+	0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
+	0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,
+	0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,
+	0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,
+	0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,
+	0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,
+	0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,
+	0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,
+	0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,
+	0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,
+	0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,
+	0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,
+	0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,
+	0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,
+	0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,
+	0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,
+	0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,
+	0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,
+	0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,
+	0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,
+	0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+	0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,
+	0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,
+	0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,
+	0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,
+	0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,
+	0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,
+	0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,
+	0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,
+	0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,
+	0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,
+	0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,
+	0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,
+	0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,
+	0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,
+	0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,
+	0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,
+	0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,
+	0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,
+	0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,
+	0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,
+	0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,
+	0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,
+	0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,
+	0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,
+	0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,
+	0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,
+	0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,
+	0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,
+	0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,
+	0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,
+	0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,
+	0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,
+	0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,
+	0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x46,0x4c,0x41,0x47,0x5f,0x48,
+	0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x46,0x4c,0x41,0x47,0x5f,0x48,0x0a,
+	0x0a,0x69,0x6e,0x74,0x20,0x67,0x65,0x74,0x6f,0x70,0x74,0x5f,0x6c,0x6f,0x6e,0x67,
+	0x28,0x69,0x6e,0x74,0x20,0x61,0x72,0x67,0x63,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x61,0x72,0x67,0x76,0x5b,0x5d,0x2c,0x20,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6f,0x70,0x74,0x73,0x74,
+	0x72,0x69,0x6e,0x67,0x2c,0x0a,0x09,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x6c,0x6f,0x6e,
+	0x67,0x6f,0x70,0x74,0x73,0x2c,0x20,0x69,0x6e,0x74,0x20,0x2a,0x6c,0x6f,0x6e,0x67,
+	0x69,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,
+	0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,
+	0x66,0x6c,0x61,0x67,0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file4[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x66,
+	0x73,0x20,0x2d,0x20,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x66,0x69,0x6c,
+	0x65,0x20,0x73,0x79,0x73,0x74,0x65,0x6d,0x20,0x72,0x65,0x6c,0x61,0x74,0x65,0x64,
+	0x20,0x69,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x43,0x4f,0x4e,0x46,0x49,0x47,0x55,0x52,0x41,0x54,0x49,0x4f,
+	0x4e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,
+	0x6e,0x65,0x20,0x46,0x53,0x5f,0x45,0x52,0x52,0x4f,0x52,0x5f,0x4f,0x4e,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x72,0x72,0x6f,
+	0x72,0x20,0x69,0x6e,0x73,0x74,0x65,0x61,0x64,0x20,0x6f,0x66,0x20,0x66,0x61,0x74,
+	0x61,0x6c,0x20,0x6f,0x6e,0x20,0x66,0x61,0x69,0x6c,0x75,0x72,0x65,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x46,
+	0x53,0x5f,0x46,0x41,0x54,0x41,0x4c,0x5f,0x4f,0x46,0x46,0x0a,0x20,0x2a,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x69,0x73,0x61,0x62,0x6c,0x65,
+	0x20,0x61,0x75,0x74,0x6f,0x20,0x66,0x61,0x74,0x61,0x6c,0x20,0x6f,0x6e,0x20,0x66,
+	0x61,0x69,0x6c,0x75,0x72,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,
+	0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,
+	0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,
+	0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,
+	0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,
+	0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,
+	0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,
+	0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,
+	0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,
+	0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,
+	0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,
+	0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,
+	0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,
+	0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,
+	0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,
+	0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,
+	0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,
+	0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,
+	0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,
+	0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,
+	0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,
+	0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,
+	0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,
+	0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,
+	0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,
+	0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,
+	0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,
+	0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,
+	0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,
+	0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,
+	0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,
+	0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,
+	0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,
+	0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,
+	0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,
+	0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,
+	0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,
+	0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,
+	0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,
+	0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,
+	0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,
+	0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,
+	0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+	0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,
+	0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,
+	0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,
+	0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,
+	0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,
+	0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,
+	0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,
+	0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,
+	0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,
+	0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,
+	0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,
+	0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,
+	0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,
+	0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,
+	0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,
+	0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,
+	0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,
+	0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,
+	0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,
+	0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+	0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,
+	0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,
+	0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,
+	0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,
+	0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,
+	0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,
+	0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,
+	0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,
+	0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,
+	0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,
+	0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,
+	0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,
+	0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,
+	0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,
+	0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,
+	0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,
+	0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,
+	0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,
+	0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,
+	0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,
+	0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,
+	0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,
+	0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x5f,0x47,
+	0x4e,0x55,0x5f,0x53,0x4f,0x55,0x52,0x43,0x45,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x20,0x3c,0x64,0x69,0x72,0x65,0x6e,0x74,0x2e,0x68,0x3e,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x65,0x72,0x72,0x6e,0x6f,0x2e,0x68,
+	0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x66,0x63,0x6e,0x74,
+	0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x70,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+	0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x61,0x72,0x67,0x2e,0x68,0x3e,0x0a,0x23,0x69,
+	0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x61,0x74,0x6f,0x6d,0x69,
+	0x63,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,
+	0x74,0x64,0x69,0x6e,0x74,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x79,0x73,0x2f,0x73,
+	0x74,0x61,0x74,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,
+	0x3c,0x75,0x6e,0x69,0x73,0x74,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x23,0x69,0x66,0x20,
+	0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x5f,0x5f,0x6c,0x69,0x6e,0x75,0x78,0x5f,
+	0x5f,0x29,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6c,0x69,0x6e,
+	0x75,0x78,0x2f,0x66,0x73,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x79,0x73,0x2f,0x69,0x6f,0x63,0x74,0x6c,0x2e,0x68,0x3e,0x0a,
+	0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x79,0x73,0x2f,0x73,0x79,
+	0x73,0x63,0x61,0x6c,0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x66,0x73,0x2e,0x68,0x22,
+	0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x65,0x72,0x72,0x2e,
+	0x68,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x78,0x6d,0x65,
+	0x6d,0x2e,0x68,0x22,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x64,0x28,0x46,0x53,0x5f,0x45,0x52,0x52,0x4f,0x52,0x5f,0x4f,0x4e,0x29,0x0a,0x23,
+	0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x63,0x6f,
+	0x64,0x65,0x29,0x20,0x20,0x20,0x5c,0x0a,0x09,0x65,0x72,0x72,0x6f,0x72,0x66,0x61,
+	0x28,0x63,0x6f,0x64,0x65,0x29,0x3b,0x20,0x5c,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x63,0x6f,0x64,0x65,0x0a,0x23,0x65,0x6c,0x69,0x66,0x20,0x64,0x65,0x66,
+	0x69,0x6e,0x65,0x64,0x28,0x46,0x53,0x5f,0x46,0x41,0x54,0x41,0x4c,0x5f,0x4f,0x46,
+	0x46,0x29,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x52,0x45,0x54,0x55,0x52,
+	0x4e,0x28,0x63,0x6f,0x64,0x65,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,
+	0x6f,0x64,0x65,0x0a,0x23,0x65,0x6c,0x73,0x65,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,
+	0x65,0x20,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x63,0x6f,0x64,0x65,0x29,0x20,0x66,
+	0x61,0x74,0x61,0x6c,0x66,0x61,0x28,0x63,0x6f,0x64,0x65,0x29,0x0a,0x23,0x65,0x6e,
+	0x64,0x69,0x66,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x46,0x53,0x5f,
+	0x57,0x41,0x4c,0x4b,0x5f,0x42,0x55,0x46,0x53,0x49,0x5a,0x45,0x20,0x33,0x32,0x37,
+	0x36,0x38,0x0a,0x0a,0x2f,0x2a,0x20,0x41,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x6f,
+	0x72,0x79,0x20,0x64,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x6f,0x72,0x20,0x73,0x68,
+	0x61,0x72,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x71,0x75,0x65,0x75,
+	0x65,0x64,0x20,0x6a,0x6f,0x62,0x73,0x20,0x66,0x6f,0x72,0x20,0x69,0x74,0x73,0x20,
+	0x73,0x75,0x62,0x64,0x69,0x72,0x65,0x63,0x74,0x6f,0x72,0x69,0x65,0x73,0x3b,0x0a,
+	0x20,0x2a,0x20,0x74,0x68,0x65,0x20,0x6c,0x61,0x73,0x74,0x20,0x6f,0x6e,0x65,0x20,
+	0x74,0x6f,0x20,0x6f,0x70,0x65,0x6e,0x20,0x69,0x74,0x73,0x20,0x73,0x75,0x62,0x64,
+	0x69,0x72,0x65,0x63,0x74,0x6f,0x72,0x79,0x20,0x63,0x6c,0x6f,0x73,0x65,0x73,0x20,
+	0x69,0x74,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,
+	0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x7b,0x0a,0x09,
+	0x69,0x6e,0x74,0x20,0x66,0x64,0x3b,0x0a,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+	0x69,0x6e,0x74,0x20,0x72,0x65,0x66,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x6a,0x6f,0x62,
+	0x20,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,
+	0x6c,0x6b,0x5f,0x6a,0x6f,0x62,0x20,0x2a,0x6e,0x65,0x78,0x74,0x3b,0x0a,0x09,0x73,
+	0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,
+	0x72,0x65,0x6e,0x74,0x20,0x2a,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x20,0x2f,0x2a,
+	0x20,0x4e,0x55,0x4c,0x4c,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x72,0x6f,
+	0x6f,0x74,0x20,0x2a,0x2f,0x0a,0x09,0x69,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,0x68,
+	0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x61,0x6d,0x65,0x3b,0x20,
+	0x2f,0x2a,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x69,0x6e,0x61,0x6c,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+	0x20,0x69,0x6e,0x20,0x70,0x61,0x74,0x68,0x20,0x2a,0x2f,0x0a,0x09,0x63,0x68,0x61,
+	0x72,0x20,0x70,0x61,0x74,0x68,0x5b,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,0x20,0x7b,
+	0x0a,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x66,0x6e,0x20,0x66,0x6e,0x3b,
+	0x0a,0x09,0x76,0x6f,0x69,0x64,0x20,0x2a,0x64,0x61,0x74,0x61,0x3b,0x0a,0x09,0x62,
+	0x6f,0x6f,0x6c,0x20,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x3b,0x0a,0x09,0x61,
+	0x74,0x6f,0x6d,0x69,0x63,0x5f,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x74,0x6f,0x70,0x3b,
+	0x0a,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x69,0x6e,0x74,0x20,0x65,0x72,0x72,
+	0x6f,0x72,0x3b,0x0a,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,
+	0x74,0x65,0x78,0x5f,0x74,0x20,0x6c,0x6f,0x63,0x6b,0x3b,0x0a,0x09,0x70,0x74,0x68,
+	0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x74,0x20,0x63,0x6f,0x6e,0x64,
+	0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x5f,0x6a,0x6f,0x62,0x20,0x2a,0x6a,0x6f,0x62,0x73,0x3b,0x0a,0x09,0x73,0x69,
+	0x7a,0x65,0x5f,0x74,0x20,0x62,0x75,0x73,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+	0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x74,
+	0x61,0x74,0x65,0x20,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,
+	0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,0x20,0x2a,0x77,0x3b,0x0a,0x09,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,0x72,0x65,
+	0x6e,0x74,0x20,0x2a,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x20,0x2f,0x2a,0x20,0x64,
+	0x69,0x72,0x65,0x63,0x74,0x6f,0x72,0x79,0x20,0x62,0x65,0x69,0x6e,0x67,0x20,0x72,
+	0x65,0x61,0x64,0x2c,0x20,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x20,0x6f,0x6e,
+	0x6c,0x79,0x20,0x2a,0x2f,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,
+	0x68,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x3b,0x0a,
+	0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x63,0x61,0x70,0x3b,0x0a,0x7d,0x3b,0x0a,
+	0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x5f,0x5f,0x6c,
+	0x69,0x6e,0x75,0x78,0x5f,0x5f,0x29,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,
+	0x73,0x5f,0x64,0x69,0x72,0x65,0x6e,0x74,0x36,0x34,0x20,0x7b,0x0a,0x09,0x75,0x69,
+	0x6e,0x74,0x36,0x34,0x5f,0x74,0x20,0x64,0x5f,0x69,0x6e,0x6f,0x3b,0x0a,0x09,0x69,
+	0x6e,0x74,0x36,0x34,0x5f,0x74,0x20,0x64,0x5f,0x6f,0x66,0x66,0x3b,0x0a,0x09,0x75,
+	0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x73,0x68,0x6f,0x72,0x74,0x20,0x64,0x5f,
+	0x72,0x65,0x63,0x6c,0x65,0x6e,0x3b,0x0a,0x09,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,
+	0x64,0x20,0x63,0x68,0x61,0x72,0x20,0x64,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x09,
+	0x63,0x68,0x61,0x72,0x20,0x64,0x5f,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x3b,0x0a,0x7d,
+	0x3b,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x79,0x70,
+	0x65,0x28,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x20,0x6d,0x6f,0x64,0x65,0x29,0x3b,0x0a,
+	0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x73,0x5f,0x72,0x65,0x61,0x64,0x28,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x29,
+	0x0a,0x7b,0x0a,0x09,0x46,0x49,0x4c,0x45,0x20,0x2a,0x66,0x70,0x74,0x72,0x20,0x3d,
+	0x20,0x66,0x6f,0x70,0x65,0x6e,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x22,0x72,0x22,
+	0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x66,0x70,0x74,0x72,0x29,0x20,0x7b,
+	0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x46,0x53,0x5f,
+	0x45,0x52,0x52,0x4f,0x52,0x5f,0x4f,0x4e,0x29,0x0a,0x09,0x09,0x65,0x72,0x72,0x6f,
+	0x72,0x66,0x61,0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x23,0x65,0x6c,0x69,
+	0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x46,0x53,0x5f,0x46,0x41,0x54,
+	0x41,0x4c,0x5f,0x4f,0x4e,0x29,0x0a,0x09,0x09,0x66,0x61,0x74,0x61,0x6c,0x66,0x61,
+	0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,
+	0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x09,
+	0x7d,0x0a,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x63,0x61,0x70,0x20,0x3d,
+	0x20,0x31,0x30,0x32,0x34,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,
+	0x65,0x6e,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x62,
+	0x75,0x66,0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x63,0x61,0x70,
+	0x29,0x3b,0x0a,0x0a,0x09,0x69,0x6e,0x74,0x20,0x63,0x3b,0x0a,0x09,0x77,0x68,0x69,
+	0x6c,0x65,0x20,0x28,0x28,0x63,0x20,0x3d,0x20,0x66,0x67,0x65,0x74,0x63,0x28,0x66,
+	0x70,0x74,0x72,0x29,0x29,0x20,0x21,0x3d,0x20,0x45,0x4f,0x46,0x29,0x20,0x7b,0x0a,
+	0x09,0x09,0x69,0x66,0x20,0x28,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x31,0x20,0x3e,0x3d,
+	0x20,0x63,0x61,0x70,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x63,0x61,0x70,0x20,0x2a,
+	0x3d,0x20,0x32,0x3b,0x0a,0x09,0x09,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x6d,
+	0x70,0x20,0x3d,0x20,0x72,0x65,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x62,0x75,0x66,0x2c,
+	0x20,0x63,0x61,0x70,0x29,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x21,0x74,
+	0x6d,0x70,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x66,0x72,0x65,0x65,0x28,0x62,
+	0x75,0x66,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x66,0x63,0x6c,0x6f,0x73,0x65,0x28,
+	0x66,0x70,0x74,0x72,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,
+	0x62,0x75,0x66,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,
+	0x09,0x62,0x75,0x66,0x5b,0x6c,0x65,0x6e,0x2b,0x2b,0x5d,0x20,0x3d,0x20,0x28,0x63,
+	0x68,0x61,0x72,0x29,0x63,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x62,0x75,0x66,0x5b,0x6c,
+	0x65,0x6e,0x5d,0x20,0x3d,0x20,0x27,0x5c,0x30,0x27,0x3b,0x0a,0x0a,0x09,0x66,0x63,
+	0x6c,0x6f,0x73,0x65,0x28,0x66,0x70,0x74,0x72,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,
+	0x75,0x72,0x6e,0x20,0x62,0x75,0x66,0x3b,0x0a,0x7d,0x0a,0x0a,0x62,0x6f,0x6f,0x6c,
+	0x20,0x66,0x73,0x5f,0x65,0x78,0x69,0x73,0x74,0x73,0x28,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x09,
+	0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x63,0x63,0x65,0x73,0x73,0x61,0x74,
+	0x28,0x41,0x54,0x5f,0x46,0x44,0x43,0x57,0x44,0x2c,0x20,0x70,0x61,0x74,0x68,0x2c,
+	0x20,0x46,0x5f,0x4f,0x4b,0x2c,0x20,0x30,0x29,0x20,0x3d,0x3d,0x20,0x30,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,
+	0x73,0x5f,0x73,0x74,0x61,0x74,0x5f,0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,
+	0x2c,0x20,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,0x20,0x77,
+	0x61,0x6e,0x74,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x73,0x74,0x61,0x74,0x20,0x2a,0x6f,0x75,0x74,
+	0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x74,0x61,0x74,
+	0x20,0x73,0x62,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x73,0x74,0x61,0x74,
+	0x61,0x74,0x28,0x41,0x54,0x5f,0x46,0x44,0x43,0x57,0x44,0x2c,0x20,0x70,0x61,0x74,
+	0x68,0x2c,0x20,0x26,0x73,0x62,0x2c,0x20,0x41,0x54,0x5f,0x53,0x59,0x4d,0x4c,0x49,
+	0x4e,0x4b,0x5f,0x4e,0x4f,0x46,0x4f,0x4c,0x4c,0x4f,0x57,0x29,0x20,0x3d,0x3d,0x20,
+	0x2d,0x31,0x29,0x20,0x7b,0x0a,0x09,0x09,0x6f,0x75,0x74,0x2d,0x3e,0x65,0x72,0x72,
+	0x6f,0x72,0x20,0x3d,0x20,0x65,0x72,0x72,0x6e,0x6f,0x3b,0x0a,0x09,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x77,0x61,
+	0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x54,0x59,0x50,
+	0x45,0x29,0x0a,0x09,0x09,0x6f,0x75,0x74,0x2d,0x3e,0x74,0x79,0x70,0x65,0x20,0x3d,
+	0x20,0x66,0x73,0x5f,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x79,0x70,0x65,0x28,0x73,0x62,
+	0x2e,0x73,0x74,0x5f,0x6d,0x6f,0x64,0x65,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,
+	0x77,0x61,0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x4d,
+	0x4f,0x44,0x45,0x29,0x0a,0x09,0x09,0x6f,0x75,0x74,0x2d,0x3e,0x6d,0x6f,0x64,0x65,
+	0x20,0x3d,0x20,0x73,0x62,0x2e,0x73,0x74,0x5f,0x6d,0x6f,0x64,0x65,0x20,0x26,0x20,
+	0x30,0x37,0x37,0x37,0x37,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x77,0x61,0x6e,0x74,
+	0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x53,0x49,0x5a,0x45,0x29,
+	0x0a,0x09,0x09,0x6f,0x75,0x74,0x2d,0x3e,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x73,
+	0x62,0x2e,0x73,0x74,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,
+	0x77,0x61,0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x4d,
+	0x54,0x49,0x4d,0x45,0x29,0x0a,0x09,0x09,0x6f,0x75,0x74,0x2d,0x3e,0x6d,0x74,0x69,
+	0x6d,0x65,0x20,0x3d,0x20,0x73,0x62,0x2e,0x73,0x74,0x5f,0x6d,0x74,0x69,0x6d,0x3b,
+	0x0a,0x7d,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,
+	0x53,0x54,0x41,0x54,0x58,0x5f,0x54,0x59,0x50,0x45,0x29,0x0a,0x73,0x74,0x61,0x74,
+	0x69,0x63,0x20,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,0x20,
+	0x66,0x73,0x5f,0x73,0x74,0x61,0x74,0x78,0x5f,0x6d,0x61,0x73,0x6b,0x28,0x75,0x6e,
+	0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,0x20,0x77,0x61,0x6e,0x74,0x29,
+	0x0a,0x7b,0x0a,0x09,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,
+	0x20,0x6d,0x61,0x73,0x6b,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x77,0x61,0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,
+	0x54,0x59,0x50,0x45,0x29,0x0a,0x09,0x09,0x6d,0x61,0x73,0x6b,0x20,0x7c,0x3d,0x20,
+	0x53,0x54,0x41,0x54,0x58,0x5f,0x54,0x59,0x50,0x45,0x3b,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x77,0x61,0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,
+	0x4d,0x4f,0x44,0x45,0x29,0x0a,0x09,0x09,0x6d,0x61,0x73,0x6b,0x20,0x7c,0x3d,0x20,
+	0x53,0x54,0x41,0x54,0x58,0x5f,0x4d,0x4f,0x44,0x45,0x3b,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x77,0x61,0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,
+	0x53,0x49,0x5a,0x45,0x29,0x0a,0x09,0x09,0x6d,0x61,0x73,0x6b,0x20,0x7c,0x3d,0x20,
+	0x53,0x54,0x41,0x54,0x58,0x5f,0x53,0x49,0x5a,0x45,0x3b,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x77,0x61,0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,
+	0x4d,0x54,0x49,0x4d,0x45,0x29,0x0a,0x09,0x09,0x6d,0x61,0x73,0x6b,0x20,0x7c,0x3d,
+	0x20,0x53,0x54,0x41,0x54,0x58,0x5f,0x4d,0x54,0x49,0x4d,0x45,0x3b,0x0a,0x09,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x73,0x6b,0x3b,0x0a,0x7d,0x0a,0x23,0x65,
+	0x6e,0x64,0x69,0x66,0x0a,0x0a,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x66,0x73,0x5f,
+	0x73,0x74,0x61,0x74,0x5f,0x6d,0x61,0x6e,0x79,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x2a,0x70,0x61,0x74,
+	0x68,0x73,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x2c,0x20,0x75,0x6e,
+	0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,0x20,0x77,0x61,0x6e,0x74,0x2c,
+	0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,
+	0x5f,0x73,0x74,0x61,0x74,0x20,0x2a,0x6f,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x09,0x73,
+	0x69,0x7a,0x65,0x5f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,0x20,0x30,0x3b,
+	0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x53,0x54,0x41,
+	0x54,0x58,0x5f,0x54,0x59,0x50,0x45,0x29,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6e,0x6f,0x5f,0x73,0x74,0x61,0x74,0x78,0x20,0x3d,
+	0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x09,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,
+	0x64,0x20,0x69,0x6e,0x74,0x20,0x6d,0x61,0x73,0x6b,0x20,0x3d,0x20,0x66,0x73,0x5f,
+	0x73,0x74,0x61,0x74,0x78,0x5f,0x6d,0x61,0x73,0x6b,0x28,0x77,0x61,0x6e,0x74,0x29,
+	0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x74,0x61,0x74,0x78,0x20,
+	0x73,0x74,0x78,0x3b,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x09,0x66,0x6f,
+	0x72,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,
+	0x20,0x69,0x20,0x3c,0x20,0x6e,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x26,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x2c,
+	0x20,0x30,0x2c,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6f,0x75,0x74,0x5b,0x69,
+	0x5d,0x29,0x3b,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,
+	0x53,0x54,0x41,0x54,0x58,0x5f,0x54,0x59,0x50,0x45,0x29,0x0a,0x09,0x09,0x69,0x66,
+	0x20,0x28,0x21,0x6e,0x6f,0x5f,0x73,0x74,0x61,0x74,0x78,0x20,0x26,0x26,0x0a,0x09,
+	0x09,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x78,0x28,0x41,0x54,0x5f,0x46,0x44,
+	0x43,0x57,0x44,0x2c,0x20,0x70,0x61,0x74,0x68,0x73,0x5b,0x69,0x5d,0x2c,0x0a,0x09,
+	0x09,0x09,0x20,0x20,0x41,0x54,0x5f,0x53,0x59,0x4d,0x4c,0x49,0x4e,0x4b,0x5f,0x4e,
+	0x4f,0x46,0x4f,0x4c,0x4c,0x4f,0x57,0x20,0x7c,0x20,0x41,0x54,0x5f,0x53,0x54,0x41,
+	0x54,0x58,0x5f,0x44,0x4f,0x4e,0x54,0x5f,0x53,0x59,0x4e,0x43,0x2c,0x20,0x6d,0x61,
+	0x73,0x6b,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x26,0x73,0x74,0x78,0x29,0x20,0x3d,
+	0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x77,0x61,
+	0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x54,0x59,0x50,
+	0x45,0x29,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x2e,0x74,0x79,
+	0x70,0x65,0x20,0x3d,0x20,0x66,0x73,0x5f,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x79,0x70,
+	0x65,0x28,0x73,0x74,0x78,0x2e,0x73,0x74,0x78,0x5f,0x6d,0x6f,0x64,0x65,0x29,0x3b,
+	0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x77,0x61,0x6e,0x74,0x20,0x26,0x20,0x46,
+	0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x4d,0x4f,0x44,0x45,0x29,0x0a,0x09,0x09,0x09,
+	0x09,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x2e,0x6d,0x6f,0x64,0x65,0x20,0x3d,0x20,0x73,
+	0x74,0x78,0x2e,0x73,0x74,0x78,0x5f,0x6d,0x6f,0x64,0x65,0x20,0x26,0x20,0x30,0x37,
+	0x37,0x37,0x37,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x77,0x61,0x6e,0x74,
+	0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x53,0x49,0x5a,0x45,0x29,
+	0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x2e,0x73,0x69,0x7a,0x65,
+	0x20,0x3d,0x20,0x28,0x6f,0x66,0x66,0x5f,0x74,0x29,0x73,0x74,0x78,0x2e,0x73,0x74,
+	0x78,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x77,
+	0x61,0x6e,0x74,0x20,0x26,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x4d,0x54,
+	0x49,0x4d,0x45,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,0x74,0x5b,0x69,
+	0x5d,0x2e,0x6d,0x74,0x69,0x6d,0x65,0x2e,0x74,0x76,0x5f,0x73,0x65,0x63,0x20,0x3d,
+	0x20,0x73,0x74,0x78,0x2e,0x73,0x74,0x78,0x5f,0x6d,0x74,0x69,0x6d,0x65,0x2e,0x74,
+	0x76,0x5f,0x73,0x65,0x63,0x3b,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,0x74,0x5b,0x69,
+	0x5d,0x2e,0x6d,0x74,0x69,0x6d,0x65,0x2e,0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,0x20,
+	0x3d,0x20,0x73,0x74,0x78,0x2e,0x73,0x74,0x78,0x5f,0x6d,0x74,0x69,0x6d,0x65,0x2e,
+	0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,
+	0x09,0x66,0x6f,0x75,0x6e,0x64,0x2b,0x2b,0x3b,0x0a,0x09,0x09,0x09,0x63,0x6f,0x6e,
+	0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x69,0x66,0x20,
+	0x28,0x21,0x6e,0x6f,0x5f,0x73,0x74,0x61,0x74,0x78,0x20,0x26,0x26,0x20,0x65,0x72,
+	0x72,0x6e,0x6f,0x20,0x21,0x3d,0x20,0x45,0x4e,0x4f,0x53,0x59,0x53,0x29,0x20,0x7b,
+	0x0a,0x09,0x09,0x09,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x2e,0x65,0x72,0x72,0x6f,0x72,
+	0x20,0x3d,0x20,0x65,0x72,0x72,0x6e,0x6f,0x3b,0x0a,0x09,0x09,0x09,0x63,0x6f,0x6e,
+	0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x6e,0x6f,0x5f,
+	0x73,0x74,0x61,0x74,0x78,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x23,0x65,
+	0x6e,0x64,0x69,0x66,0x0a,0x09,0x09,0x66,0x73,0x5f,0x73,0x74,0x61,0x74,0x5f,0x66,
+	0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x70,0x61,0x74,0x68,0x73,0x5b,0x69,0x5d,
+	0x2c,0x20,0x77,0x61,0x6e,0x74,0x2c,0x20,0x26,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x29,
+	0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x21,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x2e,
+	0x65,0x72,0x72,0x6f,0x72,0x29,0x0a,0x09,0x09,0x09,0x66,0x6f,0x75,0x6e,0x64,0x2b,
+	0x2b,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,
+	0x6f,0x75,0x6e,0x64,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,
+	0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,
+	0x29,0x0a,0x7b,0x0a,0x09,0x46,0x49,0x4c,0x45,0x20,0x2a,0x66,0x70,0x20,0x3d,0x20,
+	0x66,0x6f,0x70,0x65,0x6e,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x22,0x61,0x22,0x29,
+	0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x66,0x70,0x29,0x0a,0x09,0x09,0x52,0x45,
+	0x54,0x55,0x52,0x4e,0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x0a,0x09,0x76,
+	0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x73,
+	0x74,0x61,0x72,0x74,0x28,0x61,0x70,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,
+	0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x72,0x65,0x74,0x20,0x3d,0x20,0x76,0x66,0x70,
+	0x72,0x69,0x6e,0x74,0x66,0x28,0x66,0x70,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,
+	0x2c,0x20,0x61,0x70,0x29,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,
+	0x70,0x29,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x72,0x65,0x74,0x20,0x3c,0x20,
+	0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,0x70,
+	0x29,0x3b,0x0a,0x09,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x65,0x72,0x72,0x6e,
+	0x6f,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x63,0x6c,
+	0x6f,0x73,0x65,0x28,0x66,0x70,0x29,0x20,0x21,0x3d,0x20,0x30,0x29,0x0a,0x09,0x09,
+	0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x0a,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x64,0x65,0x6c,0x28,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x09,
+	0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x72,0x65,0x6d,0x6f,0x76,0x65,0x28,0x70,0x61,
+	0x74,0x68,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,
+	0x6e,0x65,0x77,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x70,0x61,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x6c,0x65,0x6e,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x66,0x64,0x3b,0x0a,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x70,0x61,0x74,0x68,0x20,0x3d,0x3d,0x20,0x4e,0x55,0x4c,0x4c,
+	0x29,0x20,0x7b,0x0a,0x09,0x09,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x20,0x45,0x49,
+	0x4e,0x56,0x41,0x4c,0x3b,0x0a,0x09,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x2d,
+	0x31,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x73,
+	0x74,0x72,0x6c,0x65,0x6e,0x28,0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x09,0x69,0x66,
+	0x20,0x28,0x6c,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,
+	0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x20,0x45,0x49,0x4e,0x56,0x41,0x4c,0x3b,0x0a,
+	0x09,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x2d,0x31,0x29,0x3b,0x0a,0x09,0x7d,
+	0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x61,0x74,0x68,0x5b,0x6c,0x65,0x6e,0x20,
+	0x2d,0x20,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x2f,0x27,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x69,0x66,0x20,0x28,0x6d,0x6b,0x64,0x69,0x72,0x28,0x70,0x61,0x74,0x68,0x2c,
+	0x20,0x30,0x37,0x37,0x37,0x29,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,
+	0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x2d,0x31,0x29,0x3b,0x0a,0x09,0x7d,0x20,
+	0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x09,0x09,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,
+	0x65,0x6e,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x4f,0x5f,0x43,0x52,0x45,0x41,0x54,
+	0x20,0x7c,0x20,0x4f,0x5f,0x45,0x58,0x43,0x4c,0x20,0x7c,0x20,0x4f,0x5f,0x57,0x52,
+	0x4f,0x4e,0x4c,0x59,0x2c,0x20,0x30,0x36,0x36,0x36,0x29,0x3b,0x0a,0x09,0x09,0x69,
+	0x66,0x20,0x28,0x66,0x64,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x09,
+	0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x2d,0x31,0x29,0x3b,0x0a,0x09,0x09,0x63,0x6c,
+	0x6f,0x73,0x65,0x28,0x66,0x64,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,
+	0x73,0x5f,0x77,0x72,0x69,0x74,0x65,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,
+	0x2e,0x29,0x0a,0x7b,0x0a,0x09,0x46,0x49,0x4c,0x45,0x20,0x2a,0x66,0x70,0x74,0x72,
+	0x20,0x3d,0x20,0x66,0x6f,0x70,0x65,0x6e,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x22,
+	0x77,0x22,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x66,0x70,0x74,0x72,0x29,
+	0x0a,0x09,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x2d,0x31,0x29,0x3b,0x0a,0x0a,
+	0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x3b,0x0a,0x09,0x76,0x61,
+	0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x61,0x70,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,
+	0x74,0x29,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x72,0x65,0x74,0x20,0x3d,0x20,0x76,
+	0x66,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x66,0x70,0x74,0x72,0x2c,0x20,0x66,0x6f,
+	0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x70,0x29,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x65,
+	0x6e,0x64,0x28,0x61,0x70,0x29,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x72,0x65,
+	0x74,0x20,0x3c,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x63,0x6c,0x6f,0x73,
+	0x65,0x28,0x66,0x70,0x74,0x72,0x29,0x3b,0x0a,0x09,0x09,0x52,0x45,0x54,0x55,0x52,
+	0x4e,0x28,0x2d,0x31,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,
+	0x66,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,0x70,0x74,0x72,0x29,0x20,0x21,0x3d,0x20,
+	0x30,0x29,0x0a,0x09,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x2d,0x31,0x29,0x3b,
+	0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x74,0x3b,0x0a,0x7d,
+	0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,
+	0x63,0x6f,0x70,0x79,0x5f,0x72,0x77,0x28,0x69,0x6e,0x74,0x20,0x69,0x6e,0x2c,0x20,
+	0x69,0x6e,0x74,0x20,0x6f,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,
+	0x20,0x62,0x75,0x66,0x5b,0x46,0x53,0x5f,0x57,0x41,0x4c,0x4b,0x5f,0x42,0x55,0x46,
+	0x53,0x49,0x5a,0x45,0x5d,0x3b,0x0a,0x09,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x6e,0x3b,0x0a,0x0a,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x6e,0x20,0x3d,
+	0x20,0x72,0x65,0x61,0x64,0x28,0x69,0x6e,0x2c,0x20,0x62,0x75,0x66,0x2c,0x20,0x73,
+	0x69,0x7a,0x65,0x6f,0x66,0x20,0x62,0x75,0x66,0x29,0x29,0x20,0x21,0x3d,0x20,0x30,
+	0x29,0x20,0x7b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x6e,0x20,0x3d,0x3d,0x20,0x2d,
+	0x31,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x65,0x72,0x72,0x6e,
+	0x6f,0x20,0x3d,0x3d,0x20,0x45,0x49,0x4e,0x54,0x52,0x29,0x0a,0x09,0x09,0x09,0x09,
+	0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,
+	0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x66,0x6f,
+	0x72,0x20,0x28,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6f,0x66,0x66,0x20,0x3d,
+	0x20,0x30,0x3b,0x20,0x6f,0x66,0x66,0x20,0x3c,0x20,0x6e,0x3b,0x29,0x20,0x7b,0x0a,
+	0x09,0x09,0x09,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x77,0x20,0x3d,0x20,0x77,
+	0x72,0x69,0x74,0x65,0x28,0x6f,0x75,0x74,0x2c,0x20,0x62,0x75,0x66,0x20,0x2b,0x20,
+	0x6f,0x66,0x66,0x2c,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x28,0x6e,0x20,
+	0x2d,0x20,0x6f,0x66,0x66,0x29,0x29,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,
+	0x77,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x69,
+	0x66,0x20,0x28,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x3d,0x20,0x45,0x49,0x4e,0x54,
+	0x52,0x29,0x0a,0x09,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,
+	0x3b,0x0a,0x09,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,
+	0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x6f,0x66,0x66,0x20,0x2b,0x3d,0x20,
+	0x77,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,
+	0x63,0x6f,0x70,0x79,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x66,0x72,0x6f,0x6d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x74,0x6f,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x73,0x74,0x61,0x74,0x20,0x73,0x74,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x69,
+	0x6e,0x2c,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x0a,0x0a,0x09,0x69,
+	0x6e,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x66,0x72,0x6f,0x6d,0x2c,0x20,0x4f,
+	0x5f,0x52,0x44,0x4f,0x4e,0x4c,0x59,0x20,0x7c,0x20,0x4f,0x5f,0x43,0x4c,0x4f,0x45,
+	0x58,0x45,0x43,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x69,0x6e,0x20,0x3d,0x3d,
+	0x20,0x2d,0x31,0x20,0x7c,0x7c,0x20,0x66,0x73,0x74,0x61,0x74,0x28,0x69,0x6e,0x2c,
+	0x20,0x26,0x73,0x74,0x29,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x67,
+	0x6f,0x74,0x6f,0x20,0x66,0x61,0x69,0x6c,0x3b,0x0a,0x0a,0x09,0x6f,0x75,0x74,0x20,
+	0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x74,0x6f,0x2c,0x20,0x4f,0x5f,0x57,0x52,0x4f,
+	0x4e,0x4c,0x59,0x20,0x7c,0x20,0x4f,0x5f,0x43,0x52,0x45,0x41,0x54,0x20,0x7c,0x20,
+	0x4f,0x5f,0x54,0x52,0x55,0x4e,0x43,0x20,0x7c,0x20,0x4f,0x5f,0x43,0x4c,0x4f,0x45,
+	0x58,0x45,0x43,0x2c,0x0a,0x09,0x09,0x20,0x20,0x20,0x73,0x74,0x2e,0x73,0x74,0x5f,
+	0x6d,0x6f,0x64,0x65,0x20,0x26,0x20,0x30,0x37,0x37,0x37,0x37,0x29,0x3b,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x6f,0x75,0x74,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,
+	0x09,0x67,0x6f,0x74,0x6f,0x20,0x66,0x61,0x69,0x6c,0x3b,0x0a,0x0a,0x23,0x69,0x66,
+	0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x46,0x49,0x43,0x4c,0x4f,0x4e,0x45,
+	0x29,0x0a,0x09,0x69,0x66,0x20,0x28,0x69,0x6f,0x63,0x74,0x6c,0x28,0x6f,0x75,0x74,
+	0x2c,0x20,0x46,0x49,0x43,0x4c,0x4f,0x4e,0x45,0x2c,0x20,0x69,0x6e,0x29,0x20,0x3d,
+	0x3d,0x20,0x30,0x29,0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,0x20,0x64,0x6f,0x6e,0x65,
+	0x3b,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,
+	0x66,0x69,0x6e,0x65,0x64,0x28,0x5f,0x5f,0x6c,0x69,0x6e,0x75,0x78,0x5f,0x5f,0x29,
+	0x0a,0x09,0x2f,0x2a,0x20,0x53,0x74,0x6f,0x70,0x73,0x20,0x73,0x68,0x6f,0x72,0x74,
+	0x20,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x20,0x73,0x79,0x73,0x74,0x65,0x6d,0x73,
+	0x20,0x6f,0x72,0x20,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x73,0x20,0x74,0x68,0x61,0x74,
+	0x20,0x63,0x61,0x6e,0x6e,0x6f,0x74,0x20,0x63,0x6f,0x70,0x79,0x20,0x62,0x65,0x74,
+	0x77,0x65,0x65,0x6e,0x0a,0x09,0x20,0x2a,0x20,0x74,0x68,0x65,0x73,0x65,0x20,0x74,
+	0x77,0x6f,0x20,0x66,0x69,0x6c,0x65,0x73,0x3b,0x20,0x77,0x68,0x61,0x74,0x65,0x76,
+	0x65,0x72,0x20,0x69,0x73,0x20,0x6c,0x65,0x66,0x74,0x20,0x67,0x6f,0x65,0x73,0x20,
+	0x74,0x68,0x72,0x6f,0x75,0x67,0x68,0x20,0x72,0x65,0x61,0x64,0x2f,0x77,0x72,0x69,
+	0x74,0x65,0x2e,0x20,0x2a,0x2f,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x6f,0x66,0x66,
+	0x5f,0x74,0x20,0x6c,0x65,0x66,0x74,0x20,0x3d,0x20,0x73,0x74,0x2e,0x73,0x74,0x5f,
+	0x73,0x69,0x7a,0x65,0x3b,0x20,0x6c,0x65,0x66,0x74,0x20,0x3e,0x20,0x30,0x3b,0x29,
+	0x20,0x7b,0x0a,0x09,0x09,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x20,0x3d,
+	0x20,0x63,0x6f,0x70,0x79,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,
+	0x28,0x69,0x6e,0x2c,0x20,0x4e,0x55,0x4c,0x4c,0x2c,0x20,0x6f,0x75,0x74,0x2c,0x20,
+	0x4e,0x55,0x4c,0x4c,0x2c,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x6c,0x65,
+	0x66,0x74,0x2c,0x0a,0x09,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x30,0x29,0x3b,
+	0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x6e,0x20,0x3c,0x3d,0x20,0x30,0x29,0x0a,0x09,
+	0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x09,0x09,0x6c,0x65,0x66,0x74,0x20,
+	0x2d,0x3d,0x20,0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x73,0x5f,0x63,0x6f,0x70,0x79,0x5f,0x72,0x77,
+	0x28,0x69,0x6e,0x2c,0x20,0x6f,0x75,0x74,0x29,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,
+	0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,0x20,0x66,0x61,0x69,0x6c,0x3b,0x0a,0x0a,0x64,
+	0x6f,0x6e,0x65,0x3a,0x0a,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x69,0x6e,0x29,0x3b,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x63,0x6c,0x6f,0x73,0x65,0x28,0x6f,0x75,0x74,0x29,
+	0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x20,0x7b,0x0a,0x09,0x09,0x6f,0x75,0x74,0x20,
+	0x3d,0x20,0x2d,0x31,0x3b,0x0a,0x09,0x09,0x69,0x6e,0x20,0x3d,0x20,0x2d,0x31,0x3b,
+	0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,0x20,0x66,0x61,0x69,0x6c,0x3b,0x0a,0x09,0x7d,
+	0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x0a,0x66,0x61,0x69,
+	0x6c,0x3a,0x20,0x7b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x3d,
+	0x20,0x65,0x72,0x72,0x6e,0x6f,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x69,0x6e,0x20,
+	0x21,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x69,
+	0x6e,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x6f,0x75,0x74,0x20,0x21,0x3d,0x20,
+	0x2d,0x31,0x29,0x0a,0x09,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x6f,0x75,0x74,0x29,
+	0x3b,0x0a,0x09,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x20,0x63,0x6f,0x64,0x65,0x3b,
+	0x0a,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,
+	0x0a,0x7d,0x0a,0x7d,0x0a,0x0a,0x46,0x49,0x4c,0x45,0x20,0x2a,0x66,0x73,0x5f,0x74,
+	0x65,0x6d,0x70,0x28,0x29,0x0a,0x7b,0x0a,0x09,0x46,0x49,0x4c,0x45,0x20,0x2a,0x66,
+	0x70,0x74,0x72,0x20,0x3d,0x20,0x74,0x6d,0x70,0x66,0x69,0x6c,0x65,0x28,0x29,0x3b,
+	0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x66,0x70,0x74,0x72,0x29,0x20,0x7b,0x0a,
+	0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x46,0x53,0x5f,0x45,
+	0x52,0x52,0x4f,0x52,0x5f,0x4f,0x4e,0x29,0x0a,0x09,0x09,0x65,0x72,0x72,0x6f,0x72,
+	0x66,0x28,0x22,0x74,0x6d,0x70,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x22,0x29,0x3b,
+	0x0a,0x23,0x65,0x6c,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,0x46,
+	0x53,0x5f,0x46,0x41,0x54,0x41,0x4c,0x5f,0x4f,0x4e,0x29,0x0a,0x09,0x09,0x66,0x61,
+	0x74,0x61,0x6c,0x66,0x28,0x22,0x74,0x6d,0x70,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+	0x22,0x29,0x3b,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x09,0x09,0x72,0x65,0x74,
+	0x75,0x72,0x6e,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x70,0x74,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+	0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x73,0x5f,0x73,
+	0x74,0x72,0x6e,0x64,0x75,0x70,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x73,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x29,0x0a,
+	0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x20,0x3d,0x20,
+	0x73,0x74,0x72,0x6e,0x6c,0x65,0x6e,0x28,0x73,0x2c,0x20,0x6e,0x29,0x3b,0x0a,0x09,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x64,0x75,0x70,0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,
+	0x6c,0x6f,0x63,0x28,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x31,0x29,0x3b,0x0a,0x0a,0x09,
+	0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x64,0x75,0x70,0x2c,0x20,0x73,0x2c,0x20,0x6c,
+	0x65,0x6e,0x29,0x3b,0x0a,0x09,0x64,0x75,0x70,0x5b,0x6c,0x65,0x6e,0x5d,0x20,0x3d,
+	0x20,0x27,0x5c,0x30,0x27,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,
+	0x75,0x70,0x3b,0x0a,0x7d,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x46,
+	0x53,0x5f,0x41,0x54,0x4f,0x4d,0x49,0x43,0x5f,0x54,0x52,0x49,0x45,0x53,0x20,0x31,
+	0x30,0x30,0x0a,0x0a,0x2f,0x2a,0x20,0x57,0x72,0x69,0x74,0x65,0x73,0x20,0x61,0x20,
+	0x66,0x72,0x65,0x73,0x68,0x20,0x22,0x2e,0x6e,0x61,0x6d,0x65,0x2e,0x58,0x58,0x58,
+	0x58,0x58,0x58,0x22,0x20,0x69,0x6e,0x74,0x6f,0x20,0x74,0x6d,0x70,0x2c,0x20,0x77,
+	0x68,0x69,0x63,0x68,0x20,0x68,0x6f,0x6c,0x64,0x73,0x20,0x73,0x74,0x72,0x6c,0x65,
+	0x6e,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x20,0x2a,0x2f,
+	0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,
+	0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x74,0x6d,0x70,0x6e,0x61,0x6d,0x65,0x28,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x2c,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x6d,0x70,0x2c,0x20,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x61,0x74,
+	0x69,0x63,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,0x6e,0x74,0x20,0x63,
+	0x6f,0x75,0x6e,0x74,0x65,0x72,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+	0x74,0x69,0x6d,0x65,0x73,0x70,0x65,0x63,0x20,0x74,0x73,0x3b,0x0a,0x0a,0x09,0x63,
+	0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x65,0x74,0x74,0x69,0x6d,0x65,0x28,0x43,0x4c,0x4f,
+	0x43,0x4b,0x5f,0x52,0x45,0x41,0x4c,0x54,0x49,0x4d,0x45,0x2c,0x20,0x26,0x74,0x73,
+	0x29,0x3b,0x0a,0x09,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,
+	0x20,0x73,0x61,0x6c,0x74,0x20,0x3d,0x20,0x28,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,
+	0x64,0x20,0x69,0x6e,0x74,0x29,0x74,0x73,0x2e,0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,
+	0x20,0x5e,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x28,0x75,0x6e,0x73,0x69,0x67,
+	0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,0x29,0x67,0x65,0x74,0x70,0x69,0x64,0x28,0x29,
+	0x20,0x3c,0x3c,0x20,0x31,0x36,0x20,0x5e,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,
+	0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,0x63,0x68,0x5f,0x61,0x64,0x64,
+	0x28,0x26,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x09,
+	0x73,0x6e,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x74,0x6d,0x70,0x2c,0x20,0x73,0x69,
+	0x7a,0x65,0x2c,0x20,0x22,0x2e,0x25,0x73,0x2e,0x25,0x30,0x36,0x78,0x22,0x2c,0x20,
+	0x6e,0x61,0x6d,0x65,0x2c,0x20,0x73,0x61,0x6c,0x74,0x20,0x26,0x20,0x30,0x78,0x66,
+	0x66,0x66,0x66,0x66,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x43,0x72,
+	0x65,0x61,0x74,0x65,0x73,0x20,0x22,0x64,0x69,0x72,0x2f,0x2e,0x6e,0x61,0x6d,0x65,
+	0x2e,0x58,0x58,0x58,0x58,0x58,0x58,0x22,0x20,0x65,0x78,0x63,0x6c,0x75,0x73,0x69,
+	0x76,0x65,0x6c,0x79,0x2c,0x20,0x66,0x69,0x6c,0x6c,0x69,0x6e,0x67,0x20,0x69,0x6e,
+	0x20,0x61,0x20,0x75,0x6e,0x69,0x71,0x75,0x65,0x20,0x73,0x75,0x66,0x66,0x69,0x78,
+	0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,
+	0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6d,0x6b,0x74,0x65,0x6d,0x70,
+	0x28,0x69,0x6e,0x74,0x20,0x64,0x69,0x72,0x66,0x64,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x6d,0x6f,
+	0x64,0x65,0x5f,0x74,0x20,0x6d,0x6f,0x64,0x65,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,
+	0x20,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x74,0x6d,0x70,0x29,0x0a,0x7b,0x0a,
+	0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x73,
+	0x74,0x72,0x6c,0x65,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2b,0x20,0x31,0x36,
+	0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x66,0x64,0x3b,0x0a,0x0a,0x09,0x2a,0x74,0x6d,
+	0x70,0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x69,0x7a,0x65,
+	0x29,0x3b,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x74,0x72,0x69,
+	0x65,0x73,0x20,0x3d,0x20,0x30,0x3b,0x20,0x74,0x72,0x69,0x65,0x73,0x20,0x3c,0x20,
+	0x46,0x53,0x5f,0x41,0x54,0x4f,0x4d,0x49,0x43,0x5f,0x54,0x52,0x49,0x45,0x53,0x3b,
+	0x20,0x74,0x72,0x69,0x65,0x73,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x73,
+	0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x74,0x6d,0x70,0x6e,0x61,0x6d,0x65,0x28,
+	0x6e,0x61,0x6d,0x65,0x2c,0x20,0x2a,0x74,0x6d,0x70,0x2c,0x20,0x73,0x69,0x7a,0x65,
+	0x29,0x3b,0x0a,0x09,0x09,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x61,0x74,
+	0x28,0x64,0x69,0x72,0x66,0x64,0x2c,0x20,0x2a,0x74,0x6d,0x70,0x2c,0x0a,0x09,0x09,
+	0x09,0x20,0x20,0x20,0x20,0x4f,0x5f,0x57,0x52,0x4f,0x4e,0x4c,0x59,0x20,0x7c,0x20,
+	0x4f,0x5f,0x43,0x52,0x45,0x41,0x54,0x20,0x7c,0x20,0x4f,0x5f,0x45,0x58,0x43,0x4c,
+	0x20,0x7c,0x20,0x4f,0x5f,0x43,0x4c,0x4f,0x45,0x58,0x45,0x43,0x2c,0x20,0x6d,0x6f,
+	0x64,0x65,0x29,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x66,0x64,0x20,0x21,0x3d,
+	0x20,0x2d,0x31,0x20,0x7c,0x7c,0x20,0x65,0x72,0x72,0x6e,0x6f,0x20,0x21,0x3d,0x20,
+	0x45,0x45,0x58,0x49,0x53,0x54,0x29,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x66,0x64,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x4c,0x69,0x6e,0x6b,
+	0x73,0x20,0x74,0x68,0x65,0x20,0x4f,0x5f,0x54,0x4d,0x50,0x46,0x49,0x4c,0x45,0x20,
+	0x62,0x65,0x68,0x69,0x6e,0x64,0x20,0x70,0x72,0x6f,0x63,0x20,0x75,0x6e,0x64,0x65,
+	0x72,0x20,0x61,0x20,0x66,0x72,0x65,0x73,0x68,0x20,0x22,0x2e,0x6e,0x61,0x6d,0x65,
+	0x2e,0x58,0x58,0x58,0x58,0x58,0x58,0x22,0x2c,0x20,0x66,0x6f,0x72,0x20,0x61,0x0a,
+	0x20,0x2a,0x20,0x72,0x65,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x76,0x65,0x72,0x20,0x61,
+	0x6e,0x20,0x65,0x78,0x69,0x73,0x74,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x3b,
+	0x20,0x6c,0x69,0x6e,0x6b,0x61,0x74,0x20,0x66,0x61,0x69,0x6c,0x73,0x20,0x77,0x69,
+	0x74,0x68,0x20,0x45,0x45,0x58,0x49,0x53,0x54,0x20,0x6f,0x6e,0x20,0x61,0x20,0x63,
+	0x6c,0x61,0x73,0x68,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x65,0x0a,0x20,0x2a,0x20,
+	0x6e,0x61,0x6d,0x65,0x20,0x69,0x73,0x20,0x73,0x69,0x6d,0x70,0x6c,0x79,0x20,0x64,
+	0x72,0x61,0x77,0x6e,0x20,0x61,0x67,0x61,0x69,0x6e,0x2e,0x20,0x2a,0x2f,0x0a,0x73,
+	0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,
+	0x6d,0x69,0x63,0x5f,0x6c,0x69,0x6e,0x6b,0x74,0x65,0x6d,0x70,0x28,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x72,0x6f,0x63,0x2c,0x20,0x69,
+	0x6e,0x74,0x20,0x64,0x69,0x72,0x66,0x64,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x2c,0x0a,0x09,0x09,0x09,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x74,0x6d,0x70,0x29,
+	0x0a,0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,
+	0x3d,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2b,
+	0x20,0x31,0x36,0x3b,0x0a,0x0a,0x09,0x2a,0x74,0x6d,0x70,0x20,0x3d,0x20,0x78,0x6d,
+	0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x09,0x66,0x6f,
+	0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x74,0x72,0x69,0x65,0x73,0x20,0x3d,0x20,0x30,
+	0x3b,0x20,0x74,0x72,0x69,0x65,0x73,0x20,0x3c,0x20,0x46,0x53,0x5f,0x41,0x54,0x4f,
+	0x4d,0x49,0x43,0x5f,0x54,0x52,0x49,0x45,0x53,0x3b,0x20,0x74,0x72,0x69,0x65,0x73,
+	0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,
+	0x63,0x5f,0x74,0x6d,0x70,0x6e,0x61,0x6d,0x65,0x28,0x6e,0x61,0x6d,0x65,0x2c,0x20,
+	0x2a,0x74,0x6d,0x70,0x2c,0x20,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x09,0x09,0x69,
+	0x66,0x20,0x28,0x6c,0x69,0x6e,0x6b,0x61,0x74,0x28,0x41,0x54,0x5f,0x46,0x44,0x43,
+	0x57,0x44,0x2c,0x20,0x70,0x72,0x6f,0x63,0x2c,0x20,0x64,0x69,0x72,0x66,0x64,0x2c,
+	0x20,0x2a,0x74,0x6d,0x70,0x2c,0x20,0x41,0x54,0x5f,0x53,0x59,0x4d,0x4c,0x49,0x4e,
+	0x4b,0x5f,0x46,0x4f,0x4c,0x4c,0x4f,0x57,0x29,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,
+	0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x09,0x09,0x69,
+	0x66,0x20,0x28,0x65,0x72,0x72,0x6e,0x6f,0x20,0x21,0x3d,0x20,0x45,0x45,0x58,0x49,
+	0x53,0x54,0x29,0x0a,0x09,0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x09,0x7d,
+	0x0a,0x0a,0x09,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x3d,0x20,0x65,0x72,
+	0x72,0x6e,0x6f,0x3b,0x0a,0x09,0x66,0x72,0x65,0x65,0x28,0x2a,0x74,0x6d,0x70,0x29,
+	0x3b,0x0a,0x09,0x2a,0x74,0x6d,0x70,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,
+	0x09,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x20,0x63,0x6f,0x64,0x65,0x3b,0x0a,0x09,
+	0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,
+	0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6f,0x70,0x65,0x6e,
+	0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,
+	0x63,0x20,0x2a,0x66,0x69,0x6c,0x65,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,0x20,0x6d,0x6f,0x64,0x65,0x5f,
+	0x74,0x20,0x6d,0x6f,0x64,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x6c,0x61,0x73,0x68,0x20,0x3d,0x20,0x73,
+	0x74,0x72,0x72,0x63,0x68,0x72,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x27,0x2f,0x27,
+	0x29,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x64,0x69,0x72,0x3b,0x0a,0x0a,
+	0x09,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x0a,
+	0x09,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x20,0x3d,0x20,0x4e,0x55,0x4c,
+	0x4c,0x3b,0x0a,0x09,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x20,0x3d,
+	0x20,0x66,0x73,0x5f,0x73,0x74,0x72,0x6e,0x64,0x75,0x70,0x28,0x73,0x6c,0x61,0x73,
+	0x68,0x20,0x3f,0x20,0x73,0x6c,0x61,0x73,0x68,0x20,0x2b,0x20,0x31,0x20,0x3a,0x20,
+	0x70,0x61,0x74,0x68,0x2c,0x20,0x53,0x49,0x5a,0x45,0x5f,0x4d,0x41,0x58,0x29,0x3b,
+	0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x73,0x6c,0x61,0x73,0x68,0x20,0x3d,0x3d,0x20,
+	0x70,0x61,0x74,0x68,0x29,0x0a,0x09,0x09,0x64,0x69,0x72,0x20,0x3d,0x20,0x66,0x73,
+	0x5f,0x73,0x74,0x72,0x6e,0x64,0x75,0x70,0x28,0x22,0x2f,0x22,0x2c,0x20,0x31,0x29,
+	0x3b,0x0a,0x09,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x73,0x6c,0x61,0x73,
+	0x68,0x29,0x0a,0x09,0x09,0x64,0x69,0x72,0x20,0x3d,0x20,0x66,0x73,0x5f,0x73,0x74,
+	0x72,0x6e,0x64,0x75,0x70,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x28,0x73,0x69,0x7a,
+	0x65,0x5f,0x74,0x29,0x28,0x73,0x6c,0x61,0x73,0x68,0x20,0x2d,0x20,0x70,0x61,0x74,
+	0x68,0x29,0x29,0x3b,0x0a,0x09,0x65,0x6c,0x73,0x65,0x0a,0x09,0x09,0x64,0x69,0x72,
+	0x20,0x3d,0x20,0x66,0x73,0x5f,0x73,0x74,0x72,0x6e,0x64,0x75,0x70,0x28,0x22,0x2e,
+	0x22,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x0a,0x09,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,
+	0x69,0x72,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x64,0x69,0x72,0x2c,
+	0x20,0x4f,0x5f,0x52,0x44,0x4f,0x4e,0x4c,0x59,0x20,0x7c,0x20,0x4f,0x5f,0x44,0x49,
+	0x52,0x45,0x43,0x54,0x4f,0x52,0x59,0x20,0x7c,0x20,0x4f,0x5f,0x43,0x4c,0x4f,0x45,
+	0x58,0x45,0x43,0x29,0x3b,0x0a,0x09,0x66,0x72,0x65,0x65,0x28,0x64,0x69,0x72,0x29,
+	0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,
+	0x66,0x64,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,
+	0x20,0x66,0x61,0x69,0x6c,0x3b,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,
+	0x6e,0x65,0x64,0x28,0x4f,0x5f,0x54,0x4d,0x50,0x46,0x49,0x4c,0x45,0x29,0x0a,0x09,
+	0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x61,
+	0x74,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,0x2c,0x20,0x22,
+	0x2e,0x22,0x2c,0x20,0x4f,0x5f,0x54,0x4d,0x50,0x46,0x49,0x4c,0x45,0x20,0x7c,0x20,
+	0x4f,0x5f,0x57,0x52,0x4f,0x4e,0x4c,0x59,0x20,0x7c,0x20,0x4f,0x5f,0x43,0x4c,0x4f,
+	0x45,0x58,0x45,0x43,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x6d,0x6f,0x64,0x65,0x29,
+	0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x20,
+	0x21,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x30,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x65,0x72,0x72,0x6e,0x6f,0x20,0x21,0x3d,
+	0x20,0x45,0x4f,0x50,0x4e,0x4f,0x54,0x53,0x55,0x50,0x50,0x20,0x26,0x26,0x20,0x65,
+	0x72,0x72,0x6e,0x6f,0x20,0x21,0x3d,0x20,0x45,0x49,0x53,0x44,0x49,0x52,0x20,0x26,
+	0x26,0x20,0x65,0x72,0x72,0x6e,0x6f,0x20,0x21,0x3d,0x20,0x45,0x49,0x4e,0x56,0x41,
+	0x4c,0x29,0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,0x20,0x66,0x61,0x69,0x6c,0x3b,0x0a,
+	0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x09,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,
+	0x64,0x20,0x3d,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6d,0x6b,
+	0x74,0x65,0x6d,0x70,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,
+	0x2c,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x6d,0x6f,
+	0x64,0x65,0x2c,0x20,0x26,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x29,0x3b,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x20,0x21,
+	0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+	0x3b,0x0a,0x0a,0x66,0x61,0x69,0x6c,0x3a,0x20,0x7b,0x0a,0x09,0x69,0x6e,0x74,0x20,
+	0x63,0x6f,0x64,0x65,0x20,0x3d,0x20,0x65,0x72,0x72,0x6e,0x6f,0x3b,0x0a,0x09,0x66,
+	0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x61,0x62,0x6f,0x72,0x74,0x28,0x66,
+	0x69,0x6c,0x65,0x29,0x3b,0x0a,0x09,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x20,0x63,
+	0x6f,0x64,0x65,0x3b,0x0a,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x65,0x72,0x72,
+	0x6e,0x6f,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,
+	0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x28,0x73,
+	0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x20,
+	0x2a,0x66,0x69,0x6c,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x72,0x65,
+	0x74,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x66,0x69,
+	0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x29,0x20,0x7b,0x0a,0x09,0x09,0x63,0x68,0x61,
+	0x72,0x20,0x70,0x72,0x6f,0x63,0x5b,0x36,0x34,0x5d,0x3b,0x0a,0x0a,0x09,0x09,0x73,
+	0x6e,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x70,0x72,0x6f,0x63,0x2c,0x20,0x73,0x69,
+	0x7a,0x65,0x6f,0x66,0x20,0x70,0x72,0x6f,0x63,0x2c,0x20,0x22,0x2f,0x70,0x72,0x6f,
+	0x63,0x2f,0x73,0x65,0x6c,0x66,0x2f,0x66,0x64,0x2f,0x25,0x64,0x22,0x2c,0x20,0x66,
+	0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x29,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x20,
+	0x3d,0x20,0x6c,0x69,0x6e,0x6b,0x61,0x74,0x28,0x41,0x54,0x5f,0x46,0x44,0x43,0x57,
+	0x44,0x2c,0x20,0x70,0x72,0x6f,0x63,0x2c,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,
+	0x69,0x72,0x66,0x64,0x2c,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,
+	0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x41,0x54,0x5f,0x53,0x59,0x4d,
+	0x4c,0x49,0x4e,0x4b,0x5f,0x46,0x4f,0x4c,0x4c,0x4f,0x57,0x29,0x3b,0x0a,0x09,0x09,
+	0x2f,0x2a,0x20,0x6c,0x69,0x6e,0x6b,0x61,0x74,0x20,0x63,0x61,0x6e,0x6e,0x6f,0x74,
+	0x20,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x2c,0x20,0x73,0x6f,0x20,0x6c,0x69,0x6e,
+	0x6b,0x20,0x62,0x65,0x73,0x69,0x64,0x65,0x20,0x69,0x74,0x20,0x61,0x6e,0x64,0x20,
+	0x72,0x65,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x76,0x65,0x72,0x20,0x2a,0x2f,0x0a,0x09,
+	0x09,0x69,0x66,0x20,0x28,0x72,0x65,0x74,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x20,0x26,
+	0x26,0x20,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x3d,0x20,0x45,0x45,0x58,0x49,0x53,
+	0x54,0x29,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,0x20,0x3d,0x20,0x66,0x73,0x5f,0x61,
+	0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x69,0x6e,0x6b,0x74,0x65,0x6d,0x70,0x28,0x70,
+	0x72,0x6f,0x63,0x2c,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,
+	0x2c,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x2c,0x0a,0x09,0x09,
+	0x09,0x09,0x09,0x09,0x20,0x26,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x29,
+	0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,
+	0x74,0x6d,0x70,0x20,0x26,0x26,0x20,0x72,0x65,0x74,0x20,0x3d,0x3d,0x20,0x30,0x29,
+	0x0a,0x09,0x09,0x72,0x65,0x74,0x20,0x3d,0x20,0x72,0x65,0x6e,0x61,0x6d,0x65,0x61,
+	0x74,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,0x2c,0x20,0x66,
+	0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x2c,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,
+	0x64,0x69,0x72,0x66,0x64,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x72,0x65,0x74,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x20,0x7b,
+	0x0a,0x09,0x09,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x3d,0x20,0x65,0x72,
+	0x72,0x6e,0x6f,0x3b,0x0a,0x09,0x09,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,
+	0x5f,0x61,0x62,0x6f,0x72,0x74,0x28,0x66,0x69,0x6c,0x65,0x29,0x3b,0x0a,0x09,0x09,
+	0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x20,0x63,0x6f,0x64,0x65,0x3b,0x0a,0x09,0x09,
+	0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x09,
+	0x7d,0x0a,0x0a,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,
+	0x66,0x64,0x29,0x3b,0x0a,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,0x69,0x6c,0x65,
+	0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,0x29,0x3b,0x0a,0x09,0x66,0x72,0x65,0x65,0x28,
+	0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x29,0x3b,0x0a,0x09,0x66,0x72,0x65,
+	0x65,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x09,
+	0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x20,0x3d,0x20,0x66,0x69,0x6c,0x65,0x2d,
+	0x3e,0x64,0x69,0x72,0x66,0x64,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x0a,0x09,0x66,0x69,
+	0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x20,0x3d,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,
+	0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x0a,0x09,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+	0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x61,0x62,0x6f,0x72,0x74,
+	0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,
+	0x63,0x20,0x2a,0x66,0x69,0x6c,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,
+	0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x20,0x26,0x26,0x20,0x66,0x69,0x6c,
+	0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,0x20,0x21,0x3d,0x20,0x2d,0x31,0x29,0x0a,
+	0x09,0x09,0x75,0x6e,0x6c,0x69,0x6e,0x6b,0x61,0x74,0x28,0x66,0x69,0x6c,0x65,0x2d,
+	0x3e,0x64,0x69,0x72,0x66,0x64,0x2c,0x20,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,
+	0x70,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,0x69,0x6c,0x65,
+	0x2d,0x3e,0x66,0x64,0x20,0x21,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x63,0x6c,
+	0x6f,0x73,0x65,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x29,0x3b,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,0x20,
+	0x21,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,
+	0x69,0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,0x29,0x3b,0x0a,0x09,0x66,0x72,
+	0x65,0x65,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x29,0x3b,0x0a,0x09,
+	0x66,0x72,0x65,0x65,0x28,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x29,
+	0x3b,0x0a,0x09,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x66,0x64,0x20,0x3d,0x20,0x66,0x69,
+	0x6c,0x65,0x2d,0x3e,0x64,0x69,0x72,0x66,0x64,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x0a,
+	0x09,0x66,0x69,0x6c,0x65,0x2d,0x3e,0x74,0x6d,0x70,0x20,0x3d,0x20,0x66,0x69,0x6c,
+	0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x77,0x72,0x69,0x74,0x65,0x5f,
+	0x61,0x74,0x6f,0x6d,0x69,0x63,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,
+	0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x61,
+	0x74,0x6f,0x6d,0x69,0x63,0x20,0x66,0x69,0x6c,0x65,0x3b,0x0a,0x0a,0x09,0x69,0x66,
+	0x20,0x28,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6f,0x70,0x65,0x6e,
+	0x28,0x26,0x66,0x69,0x6c,0x65,0x2c,0x20,0x70,0x61,0x74,0x68,0x2c,0x20,0x30,0x36,
+	0x36,0x36,0x29,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,
+	0x3b,0x0a,0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x3b,0x0a,
+	0x09,0x76,0x61,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x61,0x70,0x2c,0x20,0x66,0x6f,
+	0x72,0x6d,0x61,0x74,0x29,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x72,0x65,0x74,0x20,
+	0x3d,0x20,0x76,0x64,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x66,0x69,0x6c,0x65,0x2e,
+	0x66,0x64,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x70,0x29,0x3b,
+	0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x70,0x29,0x3b,0x0a,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x72,0x65,0x74,0x20,0x3c,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x69,0x6e,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x3d,0x20,0x65,0x72,0x72,0x6e,
+	0x6f,0x3b,0x0a,0x09,0x09,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x61,
+	0x62,0x6f,0x72,0x74,0x28,0x26,0x66,0x69,0x6c,0x65,0x29,0x3b,0x0a,0x09,0x09,0x65,
+	0x72,0x72,0x6e,0x6f,0x20,0x3d,0x20,0x63,0x6f,0x64,0x65,0x3b,0x0a,0x09,0x09,0x52,
+	0x45,0x54,0x55,0x52,0x4e,0x28,0x2d,0x31,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x63,0x6f,
+	0x6d,0x6d,0x69,0x74,0x28,0x26,0x66,0x69,0x6c,0x65,0x29,0x29,0x0a,0x09,0x09,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x72,0x65,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+	0x63,0x20,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x79,
+	0x70,0x65,0x28,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x20,0x6d,0x6f,0x64,0x65,0x29,0x0a,
+	0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,0x53,0x5f,0x49,0x53,0x52,0x45,0x47,0x28,0x6d,
+	0x6f,0x64,0x65,0x29,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,
+	0x53,0x5f,0x46,0x49,0x4c,0x45,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x53,0x5f,0x49,
+	0x53,0x44,0x49,0x52,0x28,0x6d,0x6f,0x64,0x65,0x29,0x29,0x0a,0x09,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x20,0x46,0x53,0x5f,0x44,0x49,0x52,0x3b,0x0a,0x09,0x69,0x66,
+	0x20,0x28,0x53,0x5f,0x49,0x53,0x4c,0x4e,0x4b,0x28,0x6d,0x6f,0x64,0x65,0x29,0x29,
+	0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x53,0x5f,0x4c,0x49,0x4e,
+	0x4b,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x53,0x5f,0x4f,0x54,
+	0x48,0x45,0x52,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,
+	0x6e,0x74,0x20,0x66,0x73,0x5f,0x64,0x69,0x72,0x65,0x6e,0x74,0x5f,0x74,0x79,0x70,
+	0x65,0x28,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,0x20,
+	0x74,0x79,0x70,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x77,0x69,0x74,0x63,0x68,0x20,
+	0x28,0x74,0x79,0x70,0x65,0x29,0x20,0x7b,0x0a,0x09,0x63,0x61,0x73,0x65,0x20,0x44,
+	0x54,0x5f,0x52,0x45,0x47,0x3a,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x46,0x53,0x5f,0x46,0x49,0x4c,0x45,0x3b,0x0a,0x09,0x63,0x61,0x73,0x65,0x20,0x44,
+	0x54,0x5f,0x44,0x49,0x52,0x3a,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x46,0x53,0x5f,0x44,0x49,0x52,0x3b,0x0a,0x09,0x63,0x61,0x73,0x65,0x20,0x44,0x54,
+	0x5f,0x4c,0x4e,0x4b,0x3a,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,
+	0x53,0x5f,0x4c,0x49,0x4e,0x4b,0x3b,0x0a,0x09,0x63,0x61,0x73,0x65,0x20,0x44,0x54,
+	0x5f,0x55,0x4e,0x4b,0x4e,0x4f,0x57,0x4e,0x3a,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x46,0x53,0x5f,0x55,0x4e,0x4b,0x4e,0x4f,0x57,0x4e,0x3b,0x0a,0x09,
+	0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x3a,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x46,0x53,0x5f,0x4f,0x54,0x48,0x45,0x52,0x3b,0x0a,0x09,0x7d,0x0a,0x7d,
+	0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x66,0x73,
+	0x5f,0x69,0x73,0x5f,0x64,0x6f,0x74,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x72,0x65,0x74,
+	0x75,0x72,0x6e,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,
+	0x2e,0x27,0x20,0x26,0x26,0x0a,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x28,0x6e,
+	0x61,0x6d,0x65,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x30,0x27,0x20,0x7c,
+	0x7c,0x20,0x28,0x6e,0x61,0x6d,0x65,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x2e,
+	0x27,0x20,0x26,0x26,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x32,0x5d,0x20,0x3d,0x3d,0x20,
+	0x27,0x5c,0x30,0x27,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+	0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x65,
+	0x72,0x72,0x6f,0x72,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,
+	0x61,0x6c,0x6b,0x65,0x72,0x20,0x2a,0x77,0x2c,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,
+	0x64,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x6e,0x6f,0x6e,0x65,0x20,
+	0x3d,0x20,0x30,0x3b,0x0a,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x63,0x6f,0x6d,
+	0x70,0x61,0x72,0x65,0x5f,0x65,0x78,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x73,0x74,
+	0x72,0x6f,0x6e,0x67,0x28,0x26,0x77,0x2d,0x3e,0x65,0x72,0x72,0x6f,0x72,0x2c,0x20,
+	0x26,0x6e,0x6f,0x6e,0x65,0x2c,0x20,0x63,0x6f,0x64,0x65,0x29,0x3b,0x0a,0x7d,0x0a,
+	0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,
+	0x77,0x61,0x6c,0x6b,0x5f,0x73,0x65,0x74,0x5f,0x70,0x61,0x74,0x68,0x28,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x74,0x61,
+	0x74,0x65,0x20,0x2a,0x73,0x74,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,
+	0x20,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x29,0x0a,0x7b,0x0a,
+	0x09,0x69,0x66,0x20,0x28,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x31,0x20,0x3e,0x20,0x73,
+	0x74,0x2d,0x3e,0x63,0x61,0x70,0x29,0x20,0x7b,0x0a,0x09,0x09,0x73,0x74,0x2d,0x3e,
+	0x63,0x61,0x70,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x32,0x35,0x36,0x3b,
+	0x0a,0x09,0x09,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x20,0x3d,0x20,0x78,0x72,
+	0x65,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x2c,
+	0x20,0x73,0x74,0x2d,0x3e,0x63,0x61,0x70,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x6d,
+	0x65,0x6d,0x63,0x70,0x79,0x28,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x2c,0x20,
+	0x70,0x61,0x74,0x68,0x2c,0x20,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x73,0x74,0x2d,
+	0x3e,0x70,0x61,0x74,0x68,0x5b,0x6c,0x65,0x6e,0x5d,0x20,0x3d,0x20,0x27,0x5c,0x30,
+	0x27,0x3b,0x0a,0x09,0x73,0x74,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x6c,0x65,
+	0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x75,0x73,0x68,0x5f,0x6e,
+	0x61,0x6d,0x65,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,
+	0x6c,0x6b,0x5f,0x73,0x74,0x61,0x74,0x65,0x20,0x2a,0x73,0x74,0x2c,0x20,0x63,0x6f,
+	0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x29,0x0a,
+	0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x20,0x3d,0x20,0x73,0x74,
+	0x72,0x6c,0x65,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x09,0x62,0x6f,0x6f,
+	0x6c,0x20,0x73,0x65,0x70,0x20,0x3d,0x20,0x73,0x74,0x2d,0x3e,0x6c,0x65,0x6e,0x20,
+	0x3e,0x20,0x30,0x20,0x26,0x26,0x20,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x5b,
+	0x73,0x74,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x2d,0x20,0x31,0x5d,0x20,0x21,0x3d,0x20,
+	0x27,0x2f,0x27,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x73,0x74,0x2d,0x3e,0x6c,
+	0x65,0x6e,0x20,0x2b,0x20,0x73,0x65,0x70,0x20,0x2b,0x20,0x6e,0x20,0x2b,0x20,0x31,
+	0x20,0x3e,0x20,0x73,0x74,0x2d,0x3e,0x63,0x61,0x70,0x29,0x20,0x7b,0x0a,0x09,0x09,
+	0x73,0x74,0x2d,0x3e,0x63,0x61,0x70,0x20,0x3d,0x20,0x28,0x73,0x74,0x2d,0x3e,0x6c,
+	0x65,0x6e,0x20,0x2b,0x20,0x73,0x65,0x70,0x20,0x2b,0x20,0x6e,0x20,0x2b,0x20,0x31,
+	0x29,0x20,0x2a,0x20,0x32,0x3b,0x0a,0x09,0x09,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,
+	0x68,0x20,0x3d,0x20,0x78,0x72,0x65,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x74,0x2d,
+	0x3e,0x70,0x61,0x74,0x68,0x2c,0x20,0x73,0x74,0x2d,0x3e,0x63,0x61,0x70,0x29,0x3b,
+	0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x73,0x65,0x70,0x29,0x0a,0x09,0x09,
+	0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x5b,0x73,0x74,0x2d,0x3e,0x6c,0x65,0x6e,
+	0x2b,0x2b,0x5d,0x20,0x3d,0x20,0x27,0x2f,0x27,0x3b,0x0a,0x09,0x6d,0x65,0x6d,0x63,
+	0x70,0x79,0x28,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x20,0x2b,0x20,0x73,0x74,
+	0x2d,0x3e,0x6c,0x65,0x6e,0x2c,0x20,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x6e,0x20,0x2b,
+	0x20,0x31,0x29,0x3b,0x0a,0x09,0x73,0x74,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x2b,0x3d,
+	0x20,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,
+	0x69,0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,0x72,0x65,0x6e,
+	0x74,0x5f,0x70,0x75,0x74,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,
+	0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x2a,0x70,0x29,0x0a,
+	0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x20,0x26,0x26,0x20,0x61,0x74,0x6f,0x6d,
+	0x69,0x63,0x5f,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x75,0x62,0x28,0x26,0x70,0x2d,
+	0x3e,0x72,0x65,0x66,0x73,0x2c,0x20,0x31,0x29,0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,
+	0x7b,0x0a,0x09,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x70,0x2d,0x3e,0x66,0x64,0x29,
+	0x3b,0x0a,0x09,0x09,0x66,0x72,0x65,0x65,0x28,0x70,0x29,0x3b,0x0a,0x09,0x7d,0x0a,
+	0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,
+	0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x65,0x6e,0x71,0x75,0x65,0x75,0x65,0x28,0x73,
+	0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,0x20,
+	0x2a,0x77,0x2c,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,
+	0x6c,0x6b,0x5f,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x2a,0x70,0x61,0x72,0x65,0x6e,
+	0x74,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,0x20,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x20,0x6c,0x65,0x6e,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,
+	0x61,0x6d,0x65,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+	0x64,0x65,0x70,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x6a,0x6f,0x62,0x20,0x2a,0x6a,0x6f,
+	0x62,0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x69,0x7a,0x65,
+	0x6f,0x66,0x20,0x2a,0x6a,0x6f,0x62,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x20,0x2b,0x20,
+	0x31,0x29,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x61,0x72,0x65,0x6e,0x74,
+	0x29,0x0a,0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,0x63,0x68,
+	0x5f,0x61,0x64,0x64,0x28,0x26,0x70,0x61,0x72,0x65,0x6e,0x74,0x2d,0x3e,0x72,0x65,
+	0x66,0x73,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x09,0x6a,0x6f,0x62,0x2d,0x3e,0x70,0x61,
+	0x72,0x65,0x6e,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x0a,0x09,
+	0x6a,0x6f,0x62,0x2d,0x3e,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x64,0x65,0x70,
+	0x74,0x68,0x3b,0x0a,0x09,0x6a,0x6f,0x62,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x20,0x3d,
+	0x20,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x09,0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x6a,
+	0x6f,0x62,0x2d,0x3e,0x70,0x61,0x74,0x68,0x2c,0x20,0x70,0x61,0x74,0x68,0x2c,0x20,
+	0x6c,0x65,0x6e,0x20,0x2b,0x20,0x31,0x29,0x3b,0x0a,0x0a,0x09,0x70,0x74,0x68,0x72,
+	0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x6c,0x6f,0x63,0x6b,0x28,0x26,
+	0x77,0x2d,0x3e,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x09,0x6a,0x6f,0x62,0x2d,0x3e,
+	0x6e,0x65,0x78,0x74,0x20,0x3d,0x20,0x77,0x2d,0x3e,0x6a,0x6f,0x62,0x73,0x3b,0x0a,
+	0x09,0x77,0x2d,0x3e,0x6a,0x6f,0x62,0x73,0x20,0x3d,0x20,0x6a,0x6f,0x62,0x3b,0x0a,
+	0x09,0x77,0x2d,0x3e,0x62,0x75,0x73,0x79,0x2b,0x2b,0x3b,0x0a,0x09,0x70,0x74,0x68,
+	0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x73,0x69,0x67,0x6e,0x61,0x6c,
+	0x28,0x26,0x77,0x2d,0x3e,0x63,0x6f,0x6e,0x64,0x29,0x3b,0x0a,0x09,0x70,0x74,0x68,
+	0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x75,0x6e,0x6c,0x6f,0x63,
+	0x6b,0x28,0x26,0x77,0x2d,0x3e,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x2f,0x2a,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x73,0x20,0x75,0x6e,0x74,0x69,0x6c,0x20,
+	0x61,0x20,0x6a,0x6f,0x62,0x20,0x69,0x73,0x20,0x61,0x76,0x61,0x69,0x6c,0x61,0x62,
+	0x6c,0x65,0x2c,0x20,0x6f,0x72,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x73,0x20,0x4e,
+	0x55,0x4c,0x4c,0x20,0x6f,0x6e,0x63,0x65,0x20,0x65,0x76,0x65,0x72,0x79,0x20,0x71,
+	0x75,0x65,0x75,0x65,0x64,0x20,0x61,0x6e,0x64,0x0a,0x20,0x2a,0x20,0x72,0x75,0x6e,
+	0x6e,0x69,0x6e,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x6f,0x72,0x79,0x20,0x69,
+	0x73,0x20,0x66,0x69,0x6e,0x69,0x73,0x68,0x65,0x64,0x2e,0x20,0x2a,0x2f,0x0a,0x73,
+	0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,
+	0x77,0x61,0x6c,0x6b,0x5f,0x6a,0x6f,0x62,0x20,0x2a,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x5f,0x64,0x65,0x71,0x75,0x65,0x75,0x65,0x28,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,0x20,0x2a,0x77,0x29,0x0a,0x7b,
+	0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,
+	0x5f,0x6a,0x6f,0x62,0x20,0x2a,0x6a,0x6f,0x62,0x3b,0x0a,0x0a,0x09,0x70,0x74,0x68,
+	0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x6c,0x6f,0x63,0x6b,0x28,
+	0x26,0x77,0x2d,0x3e,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x09,0x77,0x68,0x69,0x6c,
+	0x65,0x20,0x28,0x21,0x77,0x2d,0x3e,0x6a,0x6f,0x62,0x73,0x20,0x26,0x26,0x20,0x77,
+	0x2d,0x3e,0x62,0x75,0x73,0x79,0x20,0x3e,0x20,0x30,0x29,0x0a,0x09,0x09,0x70,0x74,
+	0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x77,0x61,0x69,0x74,0x28,
+	0x26,0x77,0x2d,0x3e,0x63,0x6f,0x6e,0x64,0x2c,0x20,0x26,0x77,0x2d,0x3e,0x6c,0x6f,
+	0x63,0x6b,0x29,0x3b,0x0a,0x09,0x6a,0x6f,0x62,0x20,0x3d,0x20,0x77,0x2d,0x3e,0x6a,
+	0x6f,0x62,0x73,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x6a,0x6f,0x62,0x29,0x0a,0x09,
+	0x09,0x77,0x2d,0x3e,0x6a,0x6f,0x62,0x73,0x20,0x3d,0x20,0x6a,0x6f,0x62,0x2d,0x3e,
+	0x6e,0x65,0x78,0x74,0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,
+	0x75,0x74,0x65,0x78,0x5f,0x75,0x6e,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x77,0x2d,0x3e,
+	0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x6a,0x6f,0x62,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,
+	0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x66,0x69,0x6e,0x69,
+	0x73,0x68,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x65,0x72,0x20,0x2a,0x77,0x29,0x0a,0x7b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,
+	0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x77,
+	0x2d,0x3e,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x2d,0x2d,
+	0x77,0x2d,0x3e,0x62,0x75,0x73,0x79,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x09,0x09,
+	0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x62,0x72,0x6f,
+	0x61,0x64,0x63,0x61,0x73,0x74,0x28,0x26,0x77,0x2d,0x3e,0x63,0x6f,0x6e,0x64,0x29,
+	0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,
+	0x5f,0x75,0x6e,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x77,0x2d,0x3e,0x6c,0x6f,0x63,0x6b,
+	0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x64,0x69,0x72,0x28,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x74,0x61,
+	0x74,0x65,0x20,0x2a,0x73,0x74,0x2c,0x20,0x69,0x6e,0x74,0x20,0x66,0x64,0x2c,0x20,
+	0x69,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,
+	0x5f,0x76,0x69,0x73,0x69,0x74,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,
+	0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x74,0x61,0x74,0x65,0x20,0x2a,0x73,0x74,0x2c,
+	0x20,0x69,0x6e,0x74,0x20,0x64,0x69,0x72,0x66,0x64,0x2c,0x0a,0x09,0x09,0x09,0x20,
+	0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,
+	0x65,0x2c,0x20,0x69,0x6e,0x74,0x20,0x74,0x79,0x70,0x65,0x2c,0x20,0x69,0x6e,0x74,
+	0x20,0x64,0x65,0x70,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,
+	0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,0x20,0x2a,0x77,0x20,0x3d,
+	0x20,0x73,0x74,0x2d,0x3e,0x77,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+	0x73,0x74,0x61,0x74,0x20,0x73,0x62,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,
+	0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x73,0x74,0x2d,0x3e,0x6c,0x65,0x6e,0x3b,
+	0x0a,0x09,0x69,0x6e,0x74,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x64,
+	0x3b,0x0a,0x0a,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x75,0x73,0x68,
+	0x5f,0x6e,0x61,0x6d,0x65,0x28,0x73,0x74,0x2c,0x20,0x6e,0x61,0x6d,0x65,0x29,0x3b,
+	0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x46,
+	0x53,0x5f,0x55,0x4e,0x4b,0x4e,0x4f,0x57,0x4e,0x20,0x26,0x26,0x0a,0x09,0x20,0x20,
+	0x20,0x20,0x66,0x73,0x74,0x61,0x74,0x61,0x74,0x28,0x64,0x69,0x72,0x66,0x64,0x2c,
+	0x20,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x26,0x73,0x62,0x2c,0x20,0x41,0x54,0x5f,0x53,
+	0x59,0x4d,0x4c,0x49,0x4e,0x4b,0x5f,0x4e,0x4f,0x46,0x4f,0x4c,0x4c,0x4f,0x57,0x29,
+	0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x09,0x09,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,
+	0x66,0x73,0x5f,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x79,0x70,0x65,0x28,0x73,0x62,0x2e,
+	0x73,0x74,0x5f,0x6d,0x6f,0x64,0x65,0x29,0x3b,0x0a,0x0a,0x09,0x73,0x74,0x72,0x75,
+	0x63,0x74,0x20,0x66,0x73,0x5f,0x65,0x6e,0x74,0x72,0x79,0x20,0x65,0x6e,0x74,0x72,
+	0x79,0x20,0x3d,0x20,0x7b,0x0a,0x09,0x09,0x2e,0x70,0x61,0x74,0x68,0x20,0x3d,0x20,
+	0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x2c,0x0a,0x09,0x09,0x2e,0x6e,0x61,0x6d,
+	0x65,0x20,0x3d,0x20,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x20,0x2b,0x20,0x73,
+	0x74,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x2d,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,
+	0x6e,0x61,0x6d,0x65,0x29,0x2c,0x0a,0x09,0x09,0x2e,0x64,0x69,0x72,0x66,0x64,0x20,
+	0x3d,0x20,0x64,0x69,0x72,0x66,0x64,0x2c,0x0a,0x09,0x09,0x2e,0x74,0x79,0x70,0x65,
+	0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x2c,0x0a,0x09,0x09,0x2e,0x64,0x65,0x70,0x74,
+	0x68,0x20,0x3d,0x20,0x64,0x65,0x70,0x74,0x68,0x2c,0x0a,0x09,0x7d,0x3b,0x0a,0x0a,
+	0x09,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x77,0x2d,0x3e,0x66,0x6e,0x28,
+	0x26,0x65,0x6e,0x74,0x72,0x79,0x2c,0x20,0x77,0x2d,0x3e,0x64,0x61,0x74,0x61,0x29,
+	0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x3d,
+	0x20,0x46,0x53,0x5f,0x57,0x41,0x4c,0x4b,0x5f,0x53,0x54,0x4f,0x50,0x29,0x0a,0x09,
+	0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x28,0x26,0x77,
+	0x2d,0x3e,0x73,0x74,0x6f,0x70,0x2c,0x20,0x74,0x72,0x75,0x65,0x29,0x3b,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x21,0x3d,0x20,0x46,0x53,
+	0x5f,0x57,0x41,0x4c,0x4b,0x5f,0x43,0x4f,0x4e,0x54,0x49,0x4e,0x55,0x45,0x20,0x7c,
+	0x7c,0x20,0x74,0x79,0x70,0x65,0x20,0x21,0x3d,0x20,0x46,0x53,0x5f,0x44,0x49,0x52,
+	0x29,0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x77,0x2d,0x3e,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x29,
+	0x20,0x7b,0x0a,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x65,0x6e,0x71,
+	0x75,0x65,0x75,0x65,0x28,0x77,0x2c,0x20,0x73,0x74,0x2d,0x3e,0x70,0x61,0x72,0x65,
+	0x6e,0x74,0x2c,0x20,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x2c,0x20,0x73,0x74,
+	0x2d,0x3e,0x6c,0x65,0x6e,0x2c,0x0a,0x09,0x09,0x09,0x09,0x28,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x29,0x28,0x65,0x6e,0x74,0x72,0x79,0x2e,0x6e,0x61,0x6d,0x65,0x20,0x2d,
+	0x20,0x73,0x74,0x2d,0x3e,0x70,0x61,0x74,0x68,0x29,0x2c,0x20,0x64,0x65,0x70,0x74,
+	0x68,0x20,0x2b,0x20,0x31,0x29,0x3b,0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,0x20,0x6f,
+	0x75,0x74,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,
+	0x65,0x6e,0x61,0x74,0x28,0x64,0x69,0x72,0x66,0x64,0x2c,0x20,0x6e,0x61,0x6d,0x65,
+	0x2c,0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x4f,0x5f,0x52,0x44,0x4f,0x4e,0x4c,0x59,
+	0x20,0x7c,0x20,0x4f,0x5f,0x44,0x49,0x52,0x45,0x43,0x54,0x4f,0x52,0x59,0x20,0x7c,
+	0x20,0x4f,0x5f,0x4e,0x4f,0x46,0x4f,0x4c,0x4c,0x4f,0x57,0x20,0x7c,0x20,0x4f,0x5f,
+	0x43,0x4c,0x4f,0x45,0x58,0x45,0x43,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x66,
+	0x64,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x73,0x5f,
+	0x77,0x61,0x6c,0x6b,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,0x77,0x2c,0x20,0x65,0x72,
+	0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x09,0x09,0x67,0x6f,0x74,0x6f,0x20,0x6f,0x75,0x74,
+	0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x64,0x69,
+	0x72,0x28,0x73,0x74,0x2c,0x20,0x66,0x64,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x20,
+	0x2b,0x20,0x31,0x29,0x3b,0x0a,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,0x64,0x29,
+	0x3b,0x0a,0x0a,0x6f,0x75,0x74,0x3a,0x0a,0x09,0x73,0x74,0x2d,0x3e,0x6c,0x65,0x6e,
+	0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x09,0x73,0x74,0x2d,0x3e,0x70,0x61,
+	0x74,0x68,0x5b,0x62,0x61,0x73,0x65,0x5d,0x20,0x3d,0x20,0x27,0x5c,0x30,0x27,0x3b,
+	0x0a,0x7d,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,
+	0x5f,0x5f,0x6c,0x69,0x6e,0x75,0x78,0x5f,0x5f,0x29,0x0a,0x73,0x74,0x61,0x74,0x69,
+	0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x64,
+	0x69,0x72,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x5f,0x73,0x74,0x61,0x74,0x65,0x20,0x2a,0x73,0x74,0x2c,0x20,0x69,0x6e,0x74,
+	0x20,0x66,0x64,0x2c,0x20,0x69,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x29,0x0a,
+	0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x62,0x75,0x66,0x20,0x3d,0x20,0x78,
+	0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x46,0x53,0x5f,0x57,0x41,0x4c,0x4b,0x5f,0x42,
+	0x55,0x46,0x53,0x49,0x5a,0x45,0x29,0x3b,0x0a,0x09,0x6c,0x6f,0x6e,0x67,0x20,0x6e,
+	0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x21,
+	0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x28,0x26,0x73,0x74,0x2d,
+	0x3e,0x77,0x2d,0x3e,0x73,0x74,0x6f,0x70,0x29,0x20,0x26,0x26,0x0a,0x09,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x28,0x6e,0x20,0x3d,0x20,0x73,0x79,0x73,0x63,0x61,0x6c,
+	0x6c,0x28,0x53,0x59,0x53,0x5f,0x67,0x65,0x74,0x64,0x65,0x6e,0x74,0x73,0x36,0x34,
+	0x2c,0x20,0x66,0x64,0x2c,0x20,0x62,0x75,0x66,0x2c,0x20,0x46,0x53,0x5f,0x57,0x41,
+	0x4c,0x4b,0x5f,0x42,0x55,0x46,0x53,0x49,0x5a,0x45,0x29,0x29,0x20,0x3e,0x20,0x30,
+	0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x6f,0x72,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x20,
+	0x6f,0x66,0x66,0x20,0x3d,0x20,0x30,0x3b,0x20,0x6f,0x66,0x66,0x20,0x3c,0x20,0x6e,
+	0x20,0x26,0x26,0x20,0x21,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,
+	0x28,0x26,0x73,0x74,0x2d,0x3e,0x77,0x2d,0x3e,0x73,0x74,0x6f,0x70,0x29,0x3b,0x29,
+	0x20,0x7b,0x0a,0x09,0x09,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,
+	0x64,0x69,0x72,0x65,0x6e,0x74,0x36,0x34,0x20,0x2a,0x64,0x20,0x3d,0x20,0x28,0x76,
+	0x6f,0x69,0x64,0x20,0x2a,0x29,0x28,0x62,0x75,0x66,0x20,0x2b,0x20,0x6f,0x66,0x66,
+	0x29,0x3b,0x0a,0x0a,0x09,0x09,0x09,0x6f,0x66,0x66,0x20,0x2b,0x3d,0x20,0x64,0x2d,
+	0x3e,0x64,0x5f,0x72,0x65,0x63,0x6c,0x65,0x6e,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,
+	0x20,0x28,0x66,0x73,0x5f,0x69,0x73,0x5f,0x64,0x6f,0x74,0x28,0x64,0x2d,0x3e,0x64,
+	0x5f,0x6e,0x61,0x6d,0x65,0x29,0x29,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x74,
+	0x69,0x6e,0x75,0x65,0x3b,0x0a,0x09,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,
+	0x5f,0x76,0x69,0x73,0x69,0x74,0x28,0x73,0x74,0x2c,0x20,0x66,0x64,0x2c,0x20,0x64,
+	0x2d,0x3e,0x64,0x5f,0x6e,0x61,0x6d,0x65,0x2c,0x0a,0x09,0x09,0x09,0x09,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x66,0x73,0x5f,0x64,0x69,0x72,0x65,0x6e,0x74,0x5f,0x74,0x79,
+	0x70,0x65,0x28,0x64,0x2d,0x3e,0x64,0x5f,0x74,0x79,0x70,0x65,0x29,0x2c,0x20,0x64,
+	0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x7d,0x0a,0x09,0x69,
+	0x66,0x20,0x28,0x6e,0x20,0x3c,0x20,0x30,0x29,0x0a,0x09,0x09,0x66,0x73,0x5f,0x77,
+	0x61,0x6c,0x6b,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,0x73,0x74,0x2d,0x3e,0x77,0x2c,
+	0x20,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x0a,0x09,0x66,0x72,0x65,0x65,0x28,
+	0x62,0x75,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x23,0x65,0x6c,0x73,0x65,0x0a,0x73,0x74,
+	0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x5f,0x64,0x69,0x72,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,
+	0x77,0x61,0x6c,0x6b,0x5f,0x73,0x74,0x61,0x74,0x65,0x20,0x2a,0x73,0x74,0x2c,0x20,
+	0x69,0x6e,0x74,0x20,0x66,0x64,0x2c,0x20,0x69,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,
+	0x68,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x69,0x72,
+	0x65,0x6e,0x74,0x20,0x2a,0x64,0x3b,0x0a,0x09,0x44,0x49,0x52,0x20,0x2a,0x64,0x69,
+	0x72,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x64,0x75,0x70,0x66,0x64,0x20,0x3d,0x20,
+	0x64,0x75,0x70,0x28,0x66,0x64,0x29,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x64,
+	0x75,0x70,0x66,0x64,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x20,0x7c,0x7c,0x20,0x21,0x28,
+	0x64,0x69,0x72,0x20,0x3d,0x20,0x66,0x64,0x6f,0x70,0x65,0x6e,0x64,0x69,0x72,0x28,
+	0x64,0x75,0x70,0x66,0x64,0x29,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x73,0x5f,
+	0x77,0x61,0x6c,0x6b,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,0x73,0x74,0x2d,0x3e,0x77,
+	0x2c,0x20,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,
+	0x64,0x75,0x70,0x66,0x64,0x20,0x21,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x09,
+	0x63,0x6c,0x6f,0x73,0x65,0x28,0x64,0x75,0x70,0x66,0x64,0x29,0x3b,0x0a,0x09,0x09,
+	0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x77,0x68,0x69,
+	0x6c,0x65,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,
+	0x28,0x26,0x73,0x74,0x2d,0x3e,0x77,0x2d,0x3e,0x73,0x74,0x6f,0x70,0x29,0x20,0x26,
+	0x26,0x20,0x28,0x64,0x20,0x3d,0x20,0x72,0x65,0x61,0x64,0x64,0x69,0x72,0x28,0x64,
+	0x69,0x72,0x29,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x66,0x73,
+	0x5f,0x69,0x73,0x5f,0x64,0x6f,0x74,0x28,0x64,0x2d,0x3e,0x64,0x5f,0x6e,0x61,0x6d,
+	0x65,0x29,0x29,0x0a,0x09,0x09,0x09,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,
+	0x0a,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x76,0x69,0x73,0x69,0x74,
+	0x28,0x73,0x74,0x2c,0x20,0x66,0x64,0x2c,0x20,0x64,0x2d,0x3e,0x64,0x5f,0x6e,0x61,
+	0x6d,0x65,0x2c,0x20,0x46,0x53,0x5f,0x55,0x4e,0x4b,0x4e,0x4f,0x57,0x4e,0x2c,0x20,
+	0x64,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x63,0x6c,0x6f,
+	0x73,0x65,0x64,0x69,0x72,0x28,0x64,0x69,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x23,0x65,
+	0x6e,0x64,0x69,0x66,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x2a,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x77,0x6f,0x72,0x6b,0x65,
+	0x72,0x28,0x76,0x6f,0x69,0x64,0x20,0x2a,0x61,0x72,0x67,0x29,0x0a,0x7b,0x0a,0x09,
+	0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,
+	0x20,0x2a,0x77,0x20,0x3d,0x20,0x61,0x72,0x67,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,
+	0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x74,0x61,0x74,0x65,
+	0x20,0x73,0x74,0x20,0x3d,0x20,0x7b,0x20,0x2e,0x77,0x20,0x3d,0x20,0x77,0x20,0x7d,
+	0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x5f,0x6a,0x6f,0x62,0x20,0x2a,0x6a,0x6f,0x62,0x3b,0x0a,0x09,0x69,0x6e,0x74,
+	0x20,0x66,0x6c,0x61,0x67,0x73,0x20,0x3d,0x20,0x4f,0x5f,0x52,0x44,0x4f,0x4e,0x4c,
+	0x59,0x20,0x7c,0x20,0x4f,0x5f,0x44,0x49,0x52,0x45,0x43,0x54,0x4f,0x52,0x59,0x20,
+	0x7c,0x20,0x4f,0x5f,0x43,0x4c,0x4f,0x45,0x58,0x45,0x43,0x2c,0x20,0x66,0x64,0x3b,
+	0x0a,0x0a,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x6a,0x6f,0x62,0x20,0x3d,
+	0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x64,0x65,0x71,0x75,0x65,0x75,0x65,
+	0x28,0x77,0x29,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x2f,0x2a,0x20,0x53,0x75,0x62,
+	0x64,0x69,0x72,0x65,0x63,0x74,0x6f,0x72,0x69,0x65,0x73,0x20,0x61,0x72,0x65,0x20,
+	0x6f,0x70,0x65,0x6e,0x65,0x64,0x20,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x20,
+	0x74,0x6f,0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x2c,
+	0x20,0x6c,0x69,0x6b,0x65,0x20,0x74,0x68,0x65,0x0a,0x09,0x09,0x20,0x2a,0x20,0x73,
+	0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x20,0x77,0x61,0x6c,0x6b,0x3b,0x20,
+	0x6f,0x6e,0x6c,0x79,0x20,0x74,0x68,0x65,0x20,0x72,0x6f,0x6f,0x74,0x20,0x6d,0x61,
+	0x79,0x20,0x62,0x65,0x20,0x61,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x69,0x63,0x20,
+	0x6c,0x69,0x6e,0x6b,0x2e,0x20,0x2a,0x2f,0x0a,0x09,0x09,0x66,0x64,0x20,0x3d,0x20,
+	0x2d,0x31,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,0x69,
+	0x63,0x5f,0x6c,0x6f,0x61,0x64,0x28,0x26,0x77,0x2d,0x3e,0x73,0x74,0x6f,0x70,0x29,
+	0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x6a,0x6f,0x62,0x2d,0x3e,
+	0x70,0x61,0x72,0x65,0x6e,0x74,0x29,0x0a,0x09,0x09,0x09,0x09,0x66,0x64,0x20,0x3d,
+	0x20,0x6f,0x70,0x65,0x6e,0x61,0x74,0x28,0x6a,0x6f,0x62,0x2d,0x3e,0x70,0x61,0x72,
+	0x65,0x6e,0x74,0x2d,0x3e,0x66,0x64,0x2c,0x0a,0x09,0x09,0x09,0x09,0x09,0x20,0x20,
+	0x20,0x20,0x6a,0x6f,0x62,0x2d,0x3e,0x70,0x61,0x74,0x68,0x20,0x2b,0x20,0x6a,0x6f,
+	0x62,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x2c,0x0a,0x09,0x09,0x09,0x09,0x09,0x20,0x20,
+	0x20,0x20,0x66,0x6c,0x61,0x67,0x73,0x20,0x7c,0x20,0x4f,0x5f,0x4e,0x4f,0x46,0x4f,
+	0x4c,0x4c,0x4f,0x57,0x29,0x3b,0x0a,0x09,0x09,0x09,0x65,0x6c,0x73,0x65,0x0a,0x09,
+	0x09,0x09,0x09,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x6a,0x6f,0x62,
+	0x2d,0x3e,0x70,0x61,0x74,0x68,0x2c,0x20,0x66,0x6c,0x61,0x67,0x73,0x29,0x3b,0x0a,
+	0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x66,0x64,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,
+	0x0a,0x09,0x09,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x65,0x72,0x72,
+	0x6f,0x72,0x28,0x77,0x2c,0x20,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x09,0x09,
+	0x7d,0x0a,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,0x72,0x65,
+	0x6e,0x74,0x5f,0x70,0x75,0x74,0x28,0x6a,0x6f,0x62,0x2d,0x3e,0x70,0x61,0x72,0x65,
+	0x6e,0x74,0x29,0x3b,0x0a,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x66,0x64,0x20,0x21,
+	0x3d,0x20,0x2d,0x31,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x73,0x74,0x2e,0x70,0x61,
+	0x72,0x65,0x6e,0x74,0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,
+	0x69,0x7a,0x65,0x6f,0x66,0x20,0x2a,0x73,0x74,0x2e,0x70,0x61,0x72,0x65,0x6e,0x74,
+	0x29,0x3b,0x0a,0x09,0x09,0x09,0x73,0x74,0x2e,0x70,0x61,0x72,0x65,0x6e,0x74,0x2d,
+	0x3e,0x66,0x64,0x20,0x3d,0x20,0x66,0x64,0x3b,0x0a,0x09,0x09,0x09,0x61,0x74,0x6f,
+	0x6d,0x69,0x63,0x5f,0x69,0x6e,0x69,0x74,0x28,0x26,0x73,0x74,0x2e,0x70,0x61,0x72,
+	0x65,0x6e,0x74,0x2d,0x3e,0x72,0x65,0x66,0x73,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x09,
+	0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x65,0x74,0x5f,0x70,0x61,
+	0x74,0x68,0x28,0x26,0x73,0x74,0x2c,0x20,0x6a,0x6f,0x62,0x2d,0x3e,0x70,0x61,0x74,
+	0x68,0x2c,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,0x6a,0x6f,0x62,0x2d,0x3e,0x70,
+	0x61,0x74,0x68,0x29,0x29,0x3b,0x0a,0x09,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x5f,0x64,0x69,0x72,0x28,0x26,0x73,0x74,0x2c,0x20,0x66,0x64,0x2c,0x20,0x6a,
+	0x6f,0x62,0x2d,0x3e,0x64,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x09,0x09,0x09,0x66,
+	0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,0x72,0x65,0x6e,0x74,0x5f,0x70,0x75,
+	0x74,0x28,0x73,0x74,0x2e,0x70,0x61,0x72,0x65,0x6e,0x74,0x29,0x3b,0x0a,0x09,0x09,
+	0x09,0x73,0x74,0x2e,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x3d,0x20,0x4e,0x55,0x4c,
+	0x4c,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x0a,0x09,0x09,0x66,0x72,0x65,0x65,0x28,0x6a,
+	0x6f,0x62,0x29,0x3b,0x0a,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x66,
+	0x69,0x6e,0x69,0x73,0x68,0x28,0x77,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x66,
+	0x72,0x65,0x65,0x28,0x73,0x74,0x2e,0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x09,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+	0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x66,0x73,0x5f,0x77,0x61,
+	0x6c,0x6b,0x5f,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x28,0x73,0x74,0x72,0x75,
+	0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,0x20,0x2a,0x77,0x2c,
+	0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,
+	0x68,0x29,0x0a,0x7b,0x0a,0x09,0x6c,0x6f,0x6e,0x67,0x20,0x6e,0x63,0x70,0x75,0x20,
+	0x3d,0x20,0x73,0x79,0x73,0x63,0x6f,0x6e,0x66,0x28,0x5f,0x53,0x43,0x5f,0x4e,0x50,
+	0x52,0x4f,0x43,0x45,0x53,0x53,0x4f,0x52,0x53,0x5f,0x4f,0x4e,0x4c,0x4e,0x29,0x3b,
+	0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x73,0x20,0x3d,0x20,0x6e,0x63,0x70,0x75,0x20,0x3e,0x20,0x31,0x20,0x3f,0x20,0x28,
+	0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x6e,0x63,0x70,0x75,0x20,0x3a,0x20,0x31,0x3b,
+	0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x74,0x20,0x2a,0x74,0x68,0x72,
+	0x65,0x61,0x64,0x73,0x20,0x3d,0x20,0x78,0x63,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x6e,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x2c,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,
+	0x2a,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x29,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x20,0x73,0x74,0x61,0x72,0x74,0x65,0x64,0x20,0x3d,0x20,0x30,0x3b,0x0a,
+	0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,
+	0x69,0x6e,0x69,0x74,0x28,0x26,0x77,0x2d,0x3e,0x6c,0x6f,0x63,0x6b,0x2c,0x20,0x4e,
+	0x55,0x4c,0x4c,0x29,0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,
+	0x6f,0x6e,0x64,0x5f,0x69,0x6e,0x69,0x74,0x28,0x26,0x77,0x2d,0x3e,0x63,0x6f,0x6e,
+	0x64,0x2c,0x20,0x4e,0x55,0x4c,0x4c,0x29,0x3b,0x0a,0x09,0x66,0x73,0x5f,0x77,0x61,
+	0x6c,0x6b,0x5f,0x65,0x6e,0x71,0x75,0x65,0x75,0x65,0x28,0x77,0x2c,0x20,0x4e,0x55,
+	0x4c,0x4c,0x2c,0x20,0x70,0x61,0x74,0x68,0x2c,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,
+	0x28,0x70,0x61,0x74,0x68,0x29,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x0a,
+	0x09,0x66,0x6f,0x72,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x69,0x20,0x3d,
+	0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x6e,0x74,0x68,0x72,0x65,0x61,0x64,0x73,
+	0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x21,
+	0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x72,0x65,0x61,0x74,0x65,0x28,0x26,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x5b,0x73,0x74,0x61,0x72,0x74,0x65,0x64,0x5d,
+	0x2c,0x20,0x4e,0x55,0x4c,0x4c,0x2c,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,
+	0x77,0x6f,0x72,0x6b,0x65,0x72,0x2c,0x20,0x77,0x29,0x29,0x0a,0x09,0x09,0x09,0x73,
+	0x74,0x61,0x72,0x74,0x65,0x64,0x2b,0x2b,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,
+	0x20,0x28,0x73,0x74,0x61,0x72,0x74,0x65,0x64,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,
+	0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x77,0x6f,0x72,0x6b,0x65,0x72,
+	0x28,0x77,0x29,0x3b,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x73,0x74,0x61,
+	0x72,0x74,0x65,0x64,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x09,0x09,0x70,0x74,0x68,
+	0x72,0x65,0x61,0x64,0x5f,0x6a,0x6f,0x69,0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x73,0x5b,0x69,0x5d,0x2c,0x20,0x4e,0x55,0x4c,0x4c,0x29,0x3b,0x0a,0x0a,0x09,0x70,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x64,0x65,0x73,0x74,
+	0x72,0x6f,0x79,0x28,0x26,0x77,0x2d,0x3e,0x63,0x6f,0x6e,0x64,0x29,0x3b,0x0a,0x09,
+	0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x64,0x65,
+	0x73,0x74,0x72,0x6f,0x79,0x28,0x26,0x77,0x2d,0x3e,0x6c,0x6f,0x63,0x6b,0x29,0x3b,
+	0x0a,0x09,0x66,0x72,0x65,0x65,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x29,0x3b,
+	0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x28,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,
+	0x2c,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x66,0x6e,0x20,0x66,0x6e,0x2c,
+	0x20,0x76,0x6f,0x69,0x64,0x20,0x2a,0x64,0x61,0x74,0x61,0x2c,0x20,0x69,0x6e,0x74,
+	0x20,0x66,0x6c,0x61,0x67,0x73,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,
+	0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x65,0x72,0x20,0x77,0x20,0x3d,0x20,
+	0x7b,0x0a,0x09,0x09,0x2e,0x66,0x6e,0x20,0x3d,0x20,0x66,0x6e,0x2c,0x0a,0x09,0x09,
+	0x2e,0x64,0x61,0x74,0x61,0x20,0x3d,0x20,0x64,0x61,0x74,0x61,0x2c,0x0a,0x09,0x09,
+	0x2e,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x20,0x3d,0x20,0x66,0x6c,0x61,0x67,
+	0x73,0x20,0x26,0x20,0x46,0x53,0x5f,0x57,0x41,0x4c,0x4b,0x5f,0x50,0x41,0x52,0x41,
+	0x4c,0x4c,0x45,0x4c,0x2c,0x0a,0x09,0x7d,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,
+	0x74,0x20,0x73,0x74,0x61,0x74,0x20,0x73,0x62,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,
+	0x61,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x66,0x64,0x3b,0x0a,0x0a,0x09,0x69,0x66,
+	0x20,0x28,0x73,0x74,0x61,0x74,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x26,0x73,0x62,
+	0x29,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x52,0x45,0x54,0x55,0x52,
+	0x4e,0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x0a,0x09,0x73,0x74,0x72,0x75,
+	0x63,0x74,0x20,0x66,0x73,0x5f,0x65,0x6e,0x74,0x72,0x79,0x20,0x72,0x6f,0x6f,0x74,
+	0x20,0x3d,0x20,0x7b,0x0a,0x09,0x09,0x2e,0x70,0x61,0x74,0x68,0x20,0x3d,0x20,0x70,
+	0x61,0x74,0x68,0x2c,0x0a,0x09,0x09,0x2e,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x70,
+	0x61,0x74,0x68,0x2c,0x0a,0x09,0x09,0x2e,0x64,0x69,0x72,0x66,0x64,0x20,0x3d,0x20,
+	0x41,0x54,0x5f,0x46,0x44,0x43,0x57,0x44,0x2c,0x0a,0x09,0x09,0x2e,0x74,0x79,0x70,
+	0x65,0x20,0x3d,0x20,0x66,0x73,0x5f,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x79,0x70,0x65,
+	0x28,0x73,0x62,0x2e,0x73,0x74,0x5f,0x6d,0x6f,0x64,0x65,0x29,0x2c,0x0a,0x09,0x09,
+	0x2e,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x30,0x2c,0x0a,0x09,0x7d,0x3b,0x0a,
+	0x0a,0x09,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6e,0x28,0x26,0x72,
+	0x6f,0x6f,0x74,0x2c,0x20,0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x21,0x3d,0x20,0x46,0x53,0x5f,0x57,0x41,
+	0x4c,0x4b,0x5f,0x43,0x4f,0x4e,0x54,0x49,0x4e,0x55,0x45,0x20,0x7c,0x7c,0x20,0x72,
+	0x6f,0x6f,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x21,0x3d,0x20,0x46,0x53,0x5f,0x44,
+	0x49,0x52,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x77,0x2e,0x70,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,
+	0x29,0x20,0x7b,0x0a,0x09,0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x70,0x61,
+	0x72,0x61,0x6c,0x6c,0x65,0x6c,0x28,0x26,0x77,0x2c,0x20,0x70,0x61,0x74,0x68,0x29,
+	0x3b,0x0a,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x09,0x09,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x74,0x61,
+	0x74,0x65,0x20,0x73,0x74,0x20,0x3d,0x20,0x7b,0x20,0x2e,0x77,0x20,0x3d,0x20,0x26,
+	0x77,0x20,0x7d,0x3b,0x0a,0x0a,0x09,0x09,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,0x65,
+	0x6e,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x4f,0x5f,0x52,0x44,0x4f,0x4e,0x4c,0x59,
+	0x20,0x7c,0x20,0x4f,0x5f,0x44,0x49,0x52,0x45,0x43,0x54,0x4f,0x52,0x59,0x20,0x7c,
+	0x20,0x4f,0x5f,0x43,0x4c,0x4f,0x45,0x58,0x45,0x43,0x29,0x3b,0x0a,0x09,0x09,0x69,
+	0x66,0x20,0x28,0x66,0x64,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x09,
+	0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x65,0x72,0x72,0x6e,0x6f,0x29,0x3b,0x0a,0x09,
+	0x09,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x73,0x65,0x74,0x5f,0x70,0x61,0x74,
+	0x68,0x28,0x26,0x73,0x74,0x2c,0x20,0x70,0x61,0x74,0x68,0x2c,0x20,0x73,0x74,0x72,
+	0x6c,0x65,0x6e,0x28,0x70,0x61,0x74,0x68,0x29,0x29,0x3b,0x0a,0x09,0x09,0x66,0x73,
+	0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x64,0x69,0x72,0x28,0x26,0x73,0x74,0x2c,0x20,0x66,
+	0x64,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x09,0x09,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,
+	0x64,0x29,0x3b,0x0a,0x09,0x09,0x66,0x72,0x65,0x65,0x28,0x73,0x74,0x2e,0x70,0x61,
+	0x74,0x68,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x61,0x74,
+	0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x28,0x26,0x77,0x2e,0x65,0x72,0x72,
+	0x6f,0x72,0x29,0x29,0x0a,0x09,0x09,0x52,0x45,0x54,0x55,0x52,0x4e,0x28,0x61,0x74,
+	0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x28,0x26,0x77,0x2e,0x65,0x72,0x72,
+	0x6f,0x72,0x29,0x29,0x3b,0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+	0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,
+	0x69,0x6c,0x65,0x20,0x66,0x73,0x2e,0x63,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file5[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x66,
+	0x73,0x20,0x2d,0x20,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x66,0x69,0x6c,
+	0x65,0x20,0x73,0x79,0x73,0x74,0x65,0x6d,0x20,0x72,0x65,0x6c,0x61,0x74,0x65,0x64,
+	0x20,0x69,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,
+	0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,
+	0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,
+	0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,
+	0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,
+	0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,
+	0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,
+	0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,
+	0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,
+	0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,
+	0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,
+	0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,
+	0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,
+	0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,
+	0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,
+	0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,
+	0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,
+	0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,
+	0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,
+	0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,
+	0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,
+	0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,
+	0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,
+	0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,
+	0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,
+	0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,
+	0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,
+	0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,
+	0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,
+	0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,
+	0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,
+	0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,
+	0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,
+	0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,
+	0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,
+	0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,
+	0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,
+	0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,
+	0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,
+	0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,
+	0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,
+	0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,
+	0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,
+	0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,
+	0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,
+	0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,
+	0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,
+	0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,
+	0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,
+	0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,
+	0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,
+	0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,
+	0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,
+	0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,
+	0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,
+	0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,
+	0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,
+	0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,
+	0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,
+	0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,
+	0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,
+	0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,
+	0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,
+	0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,
+	0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,
+	0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,
+	0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,
+	0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,
+	0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,
+	0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,
+	0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,
+	0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,
+	0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,
+	0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,
+	0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,
+	0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,
+	0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,
+	0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,
+	0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,
+	0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,
+	0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,
+	0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,
+	0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,
+	0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,
+	0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,
+	0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,
+	0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,
+	0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,
+	0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,
+	0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,
+	0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,
+	0x65,0x66,0x20,0x66,0x73,0x5f,0x48,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+	0x66,0x73,0x5f,0x48,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,
+	0x73,0x74,0x64,0x62,0x6f,0x6f,0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x64,0x65,0x66,0x2e,0x68,0x3e,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,
+	0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x79,0x73,0x2f,
+	0x74,0x79,0x70,0x65,0x73,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x74,0x69,0x6d,0x65,0x2e,0x68,0x3e,0x0a,0x0a,0x65,0x6e,0x75,0x6d,
+	0x20,0x7b,0x20,0x46,0x53,0x5f,0x55,0x4e,0x4b,0x4e,0x4f,0x57,0x4e,0x2c,0x20,0x46,
+	0x53,0x5f,0x46,0x49,0x4c,0x45,0x2c,0x20,0x46,0x53,0x5f,0x44,0x49,0x52,0x2c,0x20,
+	0x46,0x53,0x5f,0x4c,0x49,0x4e,0x4b,0x2c,0x20,0x46,0x53,0x5f,0x4f,0x54,0x48,0x45,
+	0x52,0x20,0x7d,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,
+	0x6b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x73,0x3a,
+	0x20,0x6b,0x65,0x65,0x70,0x20,0x77,0x61,0x6c,0x6b,0x69,0x6e,0x67,0x2c,0x20,0x73,
+	0x6b,0x69,0x70,0x20,0x74,0x68,0x69,0x73,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x6f,
+	0x72,0x79,0x27,0x73,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x2c,0x20,0x6f,
+	0x72,0x0a,0x20,0x2a,0x20,0x65,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x77,0x61,0x6c,
+	0x6b,0x2e,0x20,0x2a,0x2f,0x0a,0x65,0x6e,0x75,0x6d,0x20,0x7b,0x20,0x46,0x53,0x5f,
+	0x57,0x41,0x4c,0x4b,0x5f,0x43,0x4f,0x4e,0x54,0x49,0x4e,0x55,0x45,0x2c,0x20,0x46,
+	0x53,0x5f,0x57,0x41,0x4c,0x4b,0x5f,0x50,0x52,0x55,0x4e,0x45,0x2c,0x20,0x46,0x53,
+	0x5f,0x57,0x41,0x4c,0x4b,0x5f,0x53,0x54,0x4f,0x50,0x20,0x7d,0x3b,0x0a,0x0a,0x2f,
+	0x2a,0x20,0x56,0x69,0x73,0x69,0x74,0x20,0x74,0x68,0x65,0x20,0x73,0x75,0x62,0x64,
+	0x69,0x72,0x65,0x63,0x74,0x6f,0x72,0x69,0x65,0x73,0x20,0x6f,0x6e,0x20,0x77,0x6f,
+	0x72,0x6b,0x65,0x72,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x3b,0x20,0x74,0x68,
+	0x65,0x20,0x63,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x20,0x6d,0x75,0x73,0x74,0x20,
+	0x74,0x68,0x65,0x6e,0x20,0x62,0x65,0x0a,0x20,0x2a,0x20,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x2d,0x73,0x61,0x66,0x65,0x20,0x61,0x6e,0x64,0x20,0x65,0x6e,0x74,0x72,0x69,
+	0x65,0x73,0x20,0x61,0x72,0x72,0x69,0x76,0x65,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x20,
+	0x70,0x61,0x72,0x74,0x69,0x63,0x75,0x6c,0x61,0x72,0x20,0x6f,0x72,0x64,0x65,0x72,
+	0x2e,0x20,0x2a,0x2f,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x46,0x53,0x5f,
+	0x57,0x41,0x4c,0x4b,0x5f,0x50,0x41,0x52,0x41,0x4c,0x4c,0x45,0x4c,0x20,0x30,0x78,
+	0x31,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x65,0x6e,0x74,
+	0x72,0x79,0x20,0x7b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x70,0x61,0x74,0x68,0x3b,0x20,0x2f,0x2a,0x20,0x72,0x6f,0x6f,0x74,0x2d,
+	0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x20,0x70,0x61,0x74,0x68,0x2c,0x20,0x76,
+	0x61,0x6c,0x69,0x64,0x20,0x64,0x75,0x72,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,
+	0x63,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x20,0x2a,0x2f,0x0a,0x09,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x3b,0x20,0x2f,
+	0x2a,0x20,0x66,0x69,0x6e,0x61,0x6c,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+	0x74,0x20,0x6f,0x66,0x20,0x70,0x61,0x74,0x68,0x20,0x2a,0x2f,0x0a,0x09,0x69,0x6e,
+	0x74,0x20,0x64,0x69,0x72,0x66,0x64,0x3b,0x20,0x2f,0x2a,0x20,0x6f,0x70,0x65,0x6e,
+	0x20,0x64,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x6f,0x72,0x20,0x6f,0x66,0x20,0x74,
+	0x68,0x65,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x64,0x69,
+	0x72,0x65,0x63,0x74,0x6f,0x72,0x79,0x20,0x2a,0x2f,0x0a,0x09,0x69,0x6e,0x74,0x20,
+	0x74,0x79,0x70,0x65,0x3b,0x20,0x2f,0x2a,0x20,0x46,0x53,0x5f,0x46,0x49,0x4c,0x45,
+	0x2c,0x20,0x46,0x53,0x5f,0x44,0x49,0x52,0x2c,0x20,0x2e,0x2e,0x2e,0x20,0x73,0x79,
+	0x6d,0x62,0x6f,0x6c,0x69,0x63,0x20,0x6c,0x69,0x6e,0x6b,0x73,0x20,0x61,0x72,0x65,
+	0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x65,0x64,0x20,0x2a,0x2f,
+	0x0a,0x09,0x69,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x3b,0x20,0x2f,0x2a,0x20,
+	0x30,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x72,0x6f,0x6f,0x74,0x20,0x2a,
+	0x2f,0x0a,0x7d,0x3b,0x0a,0x0a,0x74,0x79,0x70,0x65,0x64,0x65,0x66,0x20,0x69,0x6e,
+	0x74,0x20,0x28,0x2a,0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x5f,0x66,0x6e,0x29,0x28,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,
+	0x65,0x6e,0x74,0x72,0x79,0x20,0x2a,0x65,0x6e,0x74,0x72,0x79,0x2c,0x20,0x76,0x6f,
+	0x69,0x64,0x20,0x2a,0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x46,
+	0x69,0x65,0x6c,0x64,0x73,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x65,0x64,0x20,
+	0x66,0x72,0x6f,0x6d,0x20,0x66,0x73,0x5f,0x73,0x74,0x61,0x74,0x5f,0x6d,0x61,0x6e,
+	0x79,0x3b,0x20,0x74,0x68,0x65,0x20,0x6f,0x74,0x68,0x65,0x72,0x73,0x20,0x61,0x72,
+	0x65,0x20,0x6c,0x65,0x66,0x74,0x20,0x7a,0x65,0x72,0x6f,0x65,0x64,0x2e,0x20,0x2a,
+	0x2f,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,
+	0x54,0x5f,0x54,0x59,0x50,0x45,0x20,0x30,0x78,0x31,0x0a,0x23,0x64,0x65,0x66,0x69,
+	0x6e,0x65,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x4d,0x4f,0x44,0x45,0x20,
+	0x30,0x78,0x32,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x46,0x53,0x5f,0x53,
+	0x54,0x41,0x54,0x5f,0x53,0x49,0x5a,0x45,0x20,0x30,0x78,0x34,0x0a,0x23,0x64,0x65,
+	0x66,0x69,0x6e,0x65,0x20,0x46,0x53,0x5f,0x53,0x54,0x41,0x54,0x5f,0x4d,0x54,0x49,
+	0x4d,0x45,0x20,0x30,0x78,0x38,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,
+	0x73,0x5f,0x73,0x74,0x61,0x74,0x20,0x7b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x65,0x72,
+	0x72,0x6f,0x72,0x3b,0x20,0x2f,0x2a,0x20,0x65,0x72,0x72,0x6e,0x6f,0x20,0x66,0x6f,
+	0x72,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x61,0x74,0x68,0x2c,0x20,0x30,0x20,0x69,
+	0x66,0x20,0x69,0x74,0x20,0x77,0x61,0x73,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x2a,
+	0x2f,0x0a,0x09,0x69,0x6e,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0x20,0x2f,0x2a,0x20,
+	0x46,0x53,0x5f,0x46,0x49,0x4c,0x45,0x2c,0x20,0x46,0x53,0x5f,0x44,0x49,0x52,0x2c,
+	0x20,0x2e,0x2e,0x2e,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x69,0x63,0x20,0x6c,0x69,
+	0x6e,0x6b,0x73,0x20,0x61,0x72,0x65,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x6c,0x6c,
+	0x6f,0x77,0x65,0x64,0x20,0x2a,0x2f,0x0a,0x09,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x20,
+	0x6d,0x6f,0x64,0x65,0x3b,0x20,0x2f,0x2a,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,
+	0x69,0x6f,0x6e,0x20,0x62,0x69,0x74,0x73,0x20,0x2a,0x2f,0x0a,0x09,0x6f,0x66,0x66,
+	0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x74,0x69,0x6d,0x65,0x73,0x70,0x65,0x63,0x20,0x6d,0x74,0x69,0x6d,0x65,0x3b,
+	0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x73,0x5f,0x72,0x65,
+	0x61,0x64,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,
+	0x61,0x74,0x68,0x29,0x3b,0x0a,0x0a,0x62,0x6f,0x6f,0x6c,0x20,0x66,0x73,0x5f,0x65,
+	0x78,0x69,0x73,0x74,0x73,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x66,0x73,0x5f,0x73,0x74,0x61,0x74,0x5f,0x6d,0x61,0x6e,0x79,0x28,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x2a,
+	0x70,0x61,0x74,0x68,0x73,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x2c,
+	0x20,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x69,0x6e,0x74,0x20,0x77,0x61,
+	0x6e,0x74,0x2c,0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x66,0x73,0x5f,0x73,0x74,0x61,0x74,0x20,0x2a,0x6f,0x75,0x74,0x29,0x3b,0x0a,
+	0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,
+	0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x3b,0x0a,0x69,0x6e,0x74,0x20,0x66,
+	0x73,0x5f,0x64,0x65,0x6c,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,
+	0x6e,0x65,0x77,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x77,0x72,
+	0x69,0x74,0x65,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x70,0x61,0x74,0x68,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x3b,0x0a,
+	0x0a,0x2f,0x2a,0x20,0x43,0x6f,0x70,0x69,0x65,0x73,0x20,0x66,0x72,0x6f,0x6d,0x20,
+	0x74,0x6f,0x20,0x74,0x6f,0x2c,0x20,0x63,0x72,0x65,0x61,0x74,0x69,0x6e,0x67,0x20,
+	0x69,0x74,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x73,0x6f,0x75,0x72,
+	0x63,0x65,0x27,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,
+	0x62,0x69,0x74,0x73,0x2e,0x20,0x4f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x0a,0x20,0x2a,
+	0x20,0x73,0x79,0x73,0x74,0x65,0x6d,0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x72,0x65,
+	0x66,0x6c,0x69,0x6e,0x6b,0x73,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x20,
+	0x73,0x68,0x61,0x72,0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x73,0x6f,0x75,0x72,0x63,
+	0x65,0x27,0x73,0x20,0x65,0x78,0x74,0x65,0x6e,0x74,0x73,0x2c,0x20,0x6f,0x74,0x68,
+	0x65,0x72,0x77,0x69,0x73,0x65,0x20,0x74,0x68,0x65,0x0a,0x20,0x2a,0x20,0x6b,0x65,
+	0x72,0x6e,0x65,0x6c,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x77,0x69,0x74,0x68,
+	0x20,0x63,0x6f,0x70,0x79,0x5f,0x66,0x69,0x6c,0x65,0x5f,0x72,0x61,0x6e,0x67,0x65,
+	0x3b,0x20,0x70,0x6c,0x61,0x69,0x6e,0x20,0x72,0x65,0x61,0x64,0x2f,0x77,0x72,0x69,
+	0x74,0x65,0x20,0x69,0x73,0x20,0x74,0x68,0x65,0x20,0x6c,0x61,0x73,0x74,0x20,0x72,
+	0x65,0x73,0x6f,0x72,0x74,0x2e,0x20,0x2a,0x2f,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,
+	0x5f,0x63,0x6f,0x70,0x79,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x66,0x72,0x6f,0x6d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x74,0x6f,0x29,0x3b,0x0a,0x0a,0x46,0x49,0x4c,0x45,0x20,0x2a,
+	0x66,0x73,0x5f,0x74,0x65,0x6d,0x70,0x28,0x29,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x57,
+	0x72,0x69,0x74,0x65,0x73,0x20,0x67,0x6f,0x20,0x74,0x6f,0x20,0x61,0x6e,0x20,0x75,
+	0x6e,0x6e,0x61,0x6d,0x65,0x64,0x20,0x4f,0x5f,0x54,0x4d,0x50,0x46,0x49,0x4c,0x45,
+	0x20,0x28,0x6f,0x72,0x20,0x61,0x20,0x68,0x69,0x64,0x64,0x65,0x6e,0x20,0x74,0x65,
+	0x6d,0x70,0x6f,0x72,0x61,0x72,0x79,0x20,0x6e,0x61,0x6d,0x65,0x20,0x77,0x68,0x65,
+	0x72,0x65,0x20,0x74,0x68,0x61,0x74,0x0a,0x20,0x2a,0x20,0x69,0x73,0x20,0x75,0x6e,
+	0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0x29,0x20,0x69,0x6e,0x20,0x74,0x68,
+	0x65,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x27,0x73,0x20,0x64,0x69,0x72,0x65,0x63,
+	0x74,0x6f,0x72,0x79,0x3b,0x20,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x20,0x70,0x75,0x62,
+	0x6c,0x69,0x73,0x68,0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x6e,0x69,0x73,
+	0x68,0x65,0x64,0x0a,0x20,0x2a,0x20,0x66,0x69,0x6c,0x65,0x20,0x75,0x6e,0x64,0x65,
+	0x72,0x20,0x69,0x74,0x73,0x20,0x66,0x69,0x6e,0x61,0x6c,0x20,0x6e,0x61,0x6d,0x65,
+	0x20,0x69,0x6e,0x20,0x6f,0x6e,0x65,0x20,0x73,0x74,0x65,0x70,0x2c,0x20,0x73,0x6f,
+	0x20,0x72,0x65,0x61,0x64,0x65,0x72,0x73,0x20,0x6e,0x65,0x76,0x65,0x72,0x20,0x73,
+	0x65,0x65,0x20,0x69,0x74,0x20,0x70,0x61,0x72,0x74,0x69,0x61,0x6c,0x6c,0x79,0x0a,
+	0x20,0x2a,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x2e,0x20,0x2a,0x2f,0x0a,0x73,
+	0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x20,
+	0x7b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x66,0x64,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,
+	0x64,0x69,0x72,0x66,0x64,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,
+	0x6d,0x65,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x6d,0x70,0x3b,0x0a,
+	0x7d,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,
+	0x63,0x5f,0x6f,0x70,0x65,0x6e,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,
+	0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x20,0x2a,0x66,0x69,0x6c,0x65,0x2c,0x20,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,
+	0x20,0x6d,0x6f,0x64,0x65,0x5f,0x74,0x20,0x6d,0x6f,0x64,0x65,0x29,0x3b,0x0a,0x69,
+	0x6e,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x63,0x6f,0x6d,
+	0x6d,0x69,0x74,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,
+	0x6f,0x6d,0x69,0x63,0x20,0x2a,0x66,0x69,0x6c,0x65,0x29,0x3b,0x0a,0x76,0x6f,0x69,
+	0x64,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x61,0x62,0x6f,0x72,
+	0x74,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x61,0x74,0x6f,0x6d,
+	0x69,0x63,0x20,0x2a,0x66,0x69,0x6c,0x65,0x29,0x3b,0x0a,0x69,0x6e,0x74,0x20,0x66,
+	0x73,0x5f,0x77,0x72,0x69,0x74,0x65,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x28,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,
+	0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,
+	0x66,0x73,0x5f,0x77,0x61,0x6c,0x6b,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x70,0x61,0x74,0x68,0x2c,0x20,0x66,0x73,0x5f,0x77,0x61,0x6c,
+	0x6b,0x5f,0x66,0x6e,0x20,0x66,0x6e,0x2c,0x20,0x76,0x6f,0x69,0x64,0x20,0x2a,0x64,
+	0x61,0x74,0x61,0x2c,0x20,0x69,0x6e,0x74,0x20,0x66,0x6c,0x61,0x67,0x73,0x29,0x3b,
+	0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,
+	0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x66,0x73,0x2e,0x68,0x20,0x2a,0x2f,
+	0x0a,
+	0
+};
+
+static const char file6[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x6c,
+	0x6f,0x67,0x20,0x2d,0x20,0x41,0x73,0x79,0x6e,0x63,0x68,0x72,0x6f,0x6e,0x6f,0x75,
+	0x73,0x20,0x6c,0x6f,0x67,0x67,0x69,0x6e,0x67,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x43,0x4f,0x4e,0x46,0x49,0x47,0x55,0x52,0x41,0x54,0x49,0x4f,0x4e,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x20,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x42,0x79,0x74,0x65,
+	0x73,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x65,0x64,0x20,0x70,0x65,0x72,0x20,0x70,
+	0x72,0x6f,0x64,0x75,0x63,0x69,0x6e,0x67,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x2c,
+	0x20,0x61,0x20,0x70,0x6f,0x77,0x65,0x72,0x20,0x6f,0x66,0x20,0x74,0x77,0x6f,0x20,
+	0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x36,0x35,0x35,0x33,0x36,0x29,0x3b,0x20,0x61,0x20,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x77,0x68,0x6f,0x73,0x65,0x20,0x72,0x69,0x6e,
+	0x67,0x20,0x69,0x73,0x20,0x66,0x75,0x6c,0x6c,0x20,0x77,0x61,0x69,0x74,0x73,0x20,
+	0x66,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x77,0x72,0x69,0x74,0x65,0x72,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+	0x4c,0x4f,0x47,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4c,0x6f,0x6e,0x67,0x65,0x73,
+	0x74,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x69,0x6e,0x20,0x62,0x79,0x74,
+	0x65,0x73,0x20,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x31,0x30,0x32,0x34,
+	0x29,0x3b,0x20,0x6c,0x6f,0x6e,0x67,0x65,0x72,0x20,0x6f,0x6e,0x65,0x73,0x20,0x61,
+	0x72,0x65,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x64,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,
+	0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,
+	0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,
+	0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,
+	0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,
+	0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,
+	0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,
+	0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,
+	0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,
+	0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,
+	0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,
+	0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,
+	0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,
+	0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,
+	0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,
+	0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,
+	0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,
+	0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,
+	0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,
+	0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,
+	0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,
+	0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,
+	0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,
+	0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,
+	0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,
+	0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,
+	0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,
+	0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,
+	0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,
+	0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,
+	0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,
+	0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,
+	0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,
+	0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+	0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,
+	0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,
+	0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,
+	0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,
+	0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,
+	0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,
+	0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,
+	0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,
+	0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,
+	0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,
+	0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,
+	0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,
+	0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,
+	0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,
+	0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,
+	0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,
+	0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,
+	0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,
+	0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,
+	0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+	0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,
+	0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,
+	0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,
+	0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,
+	0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,
+	0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,
+	0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,
+	0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,
+	0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,
+	0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,
+	0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,
+	0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,
+	0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,
+	0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,
+	0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,
+	0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,
+	0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,
+	0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,
+	0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,
+	0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,
+	0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,
+	0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,
+	0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,
+	0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,
+	0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,
+	0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,
+	0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,
+	0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,
+	0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,
+	0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,
+	0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,
+	0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x20,0x5f,0x47,0x4e,0x55,0x5f,0x53,0x4f,0x55,0x52,0x43,0x45,0x0a,0x0a,0x23,0x69,
+	0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x65,0x72,0x72,0x6e,0x6f,0x2e,0x68,0x3e,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x70,0x74,0x68,0x72,0x65,
+	0x61,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,
+	0x73,0x63,0x68,0x65,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x74,0x64,0x61,0x72,0x67,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x61,0x74,0x6f,0x6d,0x69,0x63,
+	0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,
+	0x64,0x62,0x6f,0x6f,0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6e,0x74,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0x0a,
+	0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,
+	0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,
+	0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+	0x20,0x3c,0x74,0x69,0x6d,0x65,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+	0x64,0x65,0x20,0x3c,0x75,0x6e,0x69,0x73,0x74,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x6c,0x6f,0x67,0x2e,0x68,0x22,0x0a,
+	0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,
+	0x47,0x5f,0x53,0x49,0x5a,0x45,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4c,
+	0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x36,0x35,0x35,
+	0x33,0x36,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,
+	0x65,0x66,0x20,0x4c,0x4f,0x47,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,0x0a,
+	0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4c,0x4f,0x47,0x5f,0x4c,0x49,0x4e,0x45,
+	0x5f,0x4d,0x41,0x58,0x20,0x31,0x30,0x32,0x34,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,
+	0x0a,0x0a,0x23,0x69,0x66,0x20,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,
+	0x49,0x5a,0x45,0x20,0x26,0x20,0x28,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,
+	0x53,0x49,0x5a,0x45,0x20,0x2d,0x20,0x31,0x29,0x0a,0x23,0x65,0x72,0x72,0x6f,0x72,
+	0x20,0x22,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,
+	0x6d,0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x61,0x20,0x70,0x6f,0x77,0x65,0x72,0x20,
+	0x6f,0x66,0x20,0x74,0x77,0x6f,0x22,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,
+	0x23,0x69,0x66,0x20,0x4c,0x4f,0x47,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,
+	0x20,0x2b,0x20,0x34,0x20,0x3e,0x20,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,
+	0x53,0x49,0x5a,0x45,0x0a,0x23,0x65,0x72,0x72,0x6f,0x72,0x20,0x22,0x4c,0x4f,0x47,
+	0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x6d,0x75,0x73,0x74,0x20,
+	0x68,0x6f,0x6c,0x64,0x20,0x61,0x74,0x20,0x6c,0x65,0x61,0x73,0x74,0x20,0x6f,0x6e,
+	0x65,0x20,0x4c,0x4f,0x47,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,0x20,0x6d,
+	0x65,0x73,0x73,0x61,0x67,0x65,0x22,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,
+	0x2f,0x2a,0x20,0x68,0x6f,0x77,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,
+	0x77,0x72,0x69,0x74,0x65,0x72,0x20,0x73,0x6c,0x65,0x65,0x70,0x73,0x20,0x77,0x68,
+	0x65,0x6e,0x20,0x65,0x76,0x65,0x72,0x79,0x20,0x72,0x69,0x6e,0x67,0x20,0x69,0x73,
+	0x20,0x65,0x6d,0x70,0x74,0x79,0x20,0x2a,0x2f,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,
+	0x65,0x20,0x4c,0x4f,0x47,0x5f,0x49,0x44,0x4c,0x45,0x5f,0x4e,0x53,0x20,0x31,0x30,
+	0x30,0x30,0x30,0x30,0x30,0x30,0x0a,0x0a,0x2f,0x2a,0x20,0x52,0x65,0x63,0x6f,0x72,
+	0x64,0x73,0x20,0x61,0x72,0x65,0x20,0x61,0x20,0x75,0x69,0x6e,0x74,0x33,0x32,0x5f,
+	0x74,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x65,
+	0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x61,
+	0x6e,0x64,0x20,0x6d,0x61,0x79,0x20,0x77,0x72,0x61,0x70,0x20,0x61,0x72,0x6f,0x75,
+	0x6e,0x64,0x0a,0x20,0x2a,0x20,0x74,0x68,0x65,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,
+	0x20,0x64,0x61,0x74,0x61,0x2e,0x20,0x68,0x65,0x61,0x64,0x20,0x69,0x73,0x20,0x77,
+	0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x79,0x20,0x74,
+	0x68,0x65,0x20,0x6f,0x77,0x6e,0x69,0x6e,0x67,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x20,0x61,0x6e,0x64,0x20,0x74,0x61,0x69,0x6c,0x20,0x6f,0x6e,0x6c,0x79,0x0a,0x20,
+	0x2a,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x77,0x72,0x69,0x74,0x65,0x72,0x3b,
+	0x20,0x65,0x61,0x63,0x68,0x20,0x69,0x73,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,0x68,
+	0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x20,
+	0x6f,0x72,0x64,0x65,0x72,0x2e,0x20,0x62,0x75,0x73,0x79,0x20,0x69,0x73,0x20,0x73,
+	0x65,0x74,0x20,0x77,0x68,0x69,0x6c,0x65,0x0a,0x20,0x2a,0x20,0x74,0x68,0x65,0x20,
+	0x6f,0x77,0x6e,0x65,0x72,0x20,0x69,0x73,0x20,0x70,0x75,0x73,0x68,0x69,0x6e,0x67,
+	0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x61,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,
+	0x6f,0x70,0x20,0x63,0x61,0x6e,0x20,0x77,0x61,0x69,0x74,0x20,0x66,0x6f,0x72,0x20,
+	0x74,0x68,0x65,0x20,0x70,0x75,0x73,0x68,0x20,0x74,0x6f,0x20,0x6c,0x61,0x6e,0x64,
+	0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,
+	0x72,0x69,0x6e,0x67,0x20,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,
+	0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x6e,0x65,0x78,0x74,0x3b,0x0a,0x09,
+	0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x62,0x6f,0x6f,0x6c,0x20,0x63,0x6c,0x6f,0x73,
+	0x65,0x64,0x3b,0x0a,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x62,0x6f,0x6f,0x6c,
+	0x20,0x62,0x75,0x73,0x79,0x3b,0x0a,0x09,0x5f,0x41,0x6c,0x69,0x67,0x6e,0x61,0x73,
+	0x28,0x36,0x34,0x29,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,0x6e,0x74,
+	0x5f,0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x68,0x65,0x61,0x64,0x3b,0x0a,
+	0x09,0x5f,0x41,0x6c,0x69,0x67,0x6e,0x61,0x73,0x28,0x36,0x34,0x29,0x20,0x61,0x74,
+	0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,0x6e,0x74,0x5f,0x66,0x61,0x73,0x74,0x36,0x34,
+	0x5f,0x74,0x20,0x74,0x61,0x69,0x6c,0x3b,0x0a,0x09,0x5f,0x41,0x6c,0x69,0x67,0x6e,
+	0x61,0x73,0x28,0x36,0x34,0x29,0x20,0x63,0x68,0x61,0x72,0x20,0x64,0x61,0x74,0x61,
+	0x5b,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x5d,0x3b,
+	0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,
+	0x62,0x61,0x74,0x63,0x68,0x20,0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x6c,0x65,0x6e,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x64,0x61,0x74,0x61,0x5b,
+	0x36,0x35,0x35,0x33,0x36,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x5f,0x41,0x74,0x6f,
+	0x6d,0x69,0x63,0x20,0x65,0x6e,0x75,0x6d,0x20,0x6c,0x6f,0x67,0x5f,0x6c,0x65,0x76,
+	0x65,0x6c,0x20,0x6c,0x6f,0x67,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3d,0x20,0x4c,
+	0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x49,0x4e,0x46,0x4f,0x3b,0x0a,0x0a,
+	0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x7b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x70,0x72,0x65,0x66,0x69,0x78,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x20,0x6c,0x65,0x6e,0x3b,0x0a,0x7d,0x20,0x6c,0x6f,0x67,0x5f,0x6c,0x65,
+	0x76,0x65,0x6c,0x73,0x5b,0x5d,0x20,0x3d,0x20,0x7b,0x0a,0x09,0x5b,0x4c,0x4f,0x47,
+	0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x44,0x45,0x42,0x55,0x47,0x5d,0x20,0x3d,0x20,
+	0x7b,0x20,0x22,0x64,0x65,0x62,0x75,0x67,0x3a,0x20,0x22,0x2c,0x20,0x37,0x20,0x7d,
+	0x2c,0x0a,0x09,0x5b,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x49,0x4e,
+	0x46,0x4f,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x22,0x69,0x6e,0x66,0x6f,0x3a,0x20,0x22,
+	0x2c,0x20,0x36,0x20,0x7d,0x2c,0x0a,0x09,0x5b,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,
+	0x45,0x4c,0x5f,0x57,0x41,0x52,0x4e,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x22,0x77,0x61,
+	0x72,0x6e,0x69,0x6e,0x67,0x3a,0x20,0x22,0x2c,0x20,0x39,0x20,0x7d,0x2c,0x0a,0x09,
+	0x5b,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x45,0x52,0x52,0x4f,0x52,
+	0x5d,0x20,0x3d,0x20,0x7b,0x20,0x22,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x22,0x2c,
+	0x20,0x37,0x20,0x7d,0x2c,0x0a,0x7d,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x50,0x72,0x6f,
+	0x64,0x75,0x63,0x65,0x72,0x73,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x70,0x75,0x73,0x68,
+	0x20,0x6f,0x6e,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x68,0x65,0x61,0x64,0x3b,0x20,
+	0x74,0x68,0x65,0x20,0x77,0x72,0x69,0x74,0x65,0x72,0x20,0x61,0x6c,0x6f,0x6e,0x65,
+	0x20,0x75,0x6e,0x6c,0x69,0x6e,0x6b,0x73,0x20,0x61,0x6e,0x64,0x20,0x66,0x72,0x65,
+	0x65,0x73,0x20,0x74,0x68,0x65,0x0a,0x20,0x2a,0x20,0x72,0x69,0x6e,0x67,0x73,0x20,
+	0x6f,0x66,0x20,0x65,0x78,0x69,0x74,0x65,0x64,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x73,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x5f,0x41,0x74,
+	0x6f,0x6d,0x69,0x63,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,
+	0x72,0x69,0x6e,0x67,0x20,0x2a,0x29,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,
+	0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x5f,0x54,0x68,0x72,0x65,0x61,
+	0x64,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,
+	0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,
+	0x67,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x5f,0x54,0x68,0x72,0x65,0x61,
+	0x64,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6c,0x6f,0x67,
+	0x5f,0x72,0x69,0x6e,0x67,0x5f,0x66,0x61,0x69,0x6c,0x65,0x64,0x3b,0x0a,0x73,0x74,
+	0x61,0x74,0x69,0x63,0x20,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6f,0x6e,0x63,
+	0x65,0x5f,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x6f,0x6e,0x63,0x65,0x20,0x3d,0x20,0x50,
+	0x54,0x48,0x52,0x45,0x41,0x44,0x5f,0x4f,0x4e,0x43,0x45,0x5f,0x49,0x4e,0x49,0x54,
+	0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x70,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x5f,0x6b,0x65,0x79,0x5f,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,
+	0x6b,0x65,0x79,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x62,0x6f,0x6f,0x6c,
+	0x20,0x6c,0x6f,0x67,0x5f,0x68,0x61,0x76,0x65,0x5f,0x6b,0x65,0x79,0x3b,0x0a,0x0a,
+	0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x66,
+	0x64,0x20,0x3d,0x20,0x53,0x54,0x44,0x45,0x52,0x52,0x5f,0x46,0x49,0x4c,0x45,0x4e,
+	0x4f,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,
+	0x5f,0x62,0x6f,0x6f,0x6c,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,0x69,0x6e,
+	0x67,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x70,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x5f,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x77,0x72,0x69,0x74,0x65,0x72,0x5f,0x74,
+	0x68,0x72,0x65,0x61,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x70,0x74,
+	0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x74,0x20,0x6c,0x6f,
+	0x67,0x5f,0x6c,0x6f,0x63,0x6b,0x20,0x3d,0x20,0x50,0x54,0x48,0x52,0x45,0x41,0x44,
+	0x5f,0x4d,0x55,0x54,0x45,0x58,0x5f,0x49,0x4e,0x49,0x54,0x49,0x41,0x4c,0x49,0x5a,
+	0x45,0x52,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x70,0x74,0x68,0x72,0x65,
+	0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x77,0x61,
+	0x6b,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x70,0x74,0x68,0x72,0x65,
+	0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x66,0x6c,
+	0x75,0x73,0x68,0x65,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x62,0x6f,
+	0x6f,0x6c,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,0x70,0x69,0x6e,0x67,0x3b,
+	0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,
+	0x20,0x6c,0x6f,0x6e,0x67,0x20,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x5f,
+	0x72,0x65,0x71,0x2c,0x20,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x5f,0x64,
+	0x6f,0x6e,0x65,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x6c,0x6f,0x67,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x28,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x62,0x75,0x66,0x2c,0x20,0x73,0x69,
+	0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x29,0x0a,0x7b,0x0a,0x09,0x77,0x68,0x69,
+	0x6c,0x65,0x20,0x28,0x6c,0x65,0x6e,0x20,0x3e,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x20,0x3d,0x20,0x77,0x72,0x69,
+	0x74,0x65,0x28,0x6c,0x6f,0x67,0x5f,0x66,0x64,0x2c,0x20,0x62,0x75,0x66,0x2c,0x20,
+	0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x6e,0x20,0x3c,0x20,
+	0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x65,0x72,0x72,0x6e,
+	0x6f,0x20,0x3d,0x3d,0x20,0x45,0x49,0x4e,0x54,0x52,0x29,0x0a,0x09,0x09,0x09,0x09,
+	0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x09,0x09,0x09,0x72,0x65,0x74,
+	0x75,0x72,0x6e,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x62,0x75,0x66,0x20,0x2b,
+	0x3d,0x20,0x6e,0x3b,0x0a,0x09,0x09,0x6c,0x65,0x6e,0x20,0x2d,0x3d,0x20,0x28,0x73,
+	0x69,0x7a,0x65,0x5f,0x74,0x29,0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x7d,0x0a,0x0a,0x73,
+	0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,0x5f,0x72,
+	0x69,0x6e,0x67,0x5f,0x63,0x6c,0x6f,0x73,0x65,0x28,0x76,0x6f,0x69,0x64,0x20,0x2a,
+	0x70,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,
+	0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x72,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x0a,0x09,
+	0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x3b,
+	0x0a,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,
+	0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x63,0x6c,0x6f,0x73,
+	0x65,0x64,0x2c,0x20,0x74,0x72,0x75,0x65,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,
+	0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x29,0x3b,
+	0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x54,0x68,0x65,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6e,0x65,0x76,0x65,0x72,0x20,
+	0x64,0x65,0x73,0x74,0x72,0x6f,0x79,0x65,0x64,0x3a,0x20,0x61,0x20,0x70,0x72,0x6f,
+	0x64,0x75,0x63,0x65,0x72,0x20,0x6d,0x61,0x79,0x20,0x73,0x74,0x69,0x6c,0x6c,0x20,
+	0x62,0x65,0x20,0x73,0x69,0x67,0x6e,0x61,0x6c,0x6c,0x69,0x6e,0x67,0x0a,0x20,0x2a,
+	0x20,0x77,0x61,0x6b,0x65,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6c,0x6f,0x67,0x5f,
+	0x73,0x74,0x6f,0x70,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x73,0x2e,0x20,0x2a,0x2f,
+	0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,
+	0x5f,0x69,0x6e,0x69,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,0x0a,0x09,0x70,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x61,0x74,0x74,0x72,0x5f,
+	0x74,0x20,0x61,0x74,0x74,0x72,0x3b,0x0a,0x0a,0x09,0x6c,0x6f,0x67,0x5f,0x68,0x61,
+	0x76,0x65,0x5f,0x6b,0x65,0x79,0x20,0x3d,0x20,0x70,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x5f,0x6b,0x65,0x79,0x5f,0x63,0x72,0x65,0x61,0x74,0x65,0x28,0x26,0x6c,0x6f,0x67,
+	0x5f,0x72,0x69,0x6e,0x67,0x5f,0x6b,0x65,0x79,0x2c,0x20,0x6c,0x6f,0x67,0x5f,0x72,
+	0x69,0x6e,0x67,0x5f,0x63,0x6c,0x6f,0x73,0x65,0x29,0x20,0x3d,0x3d,0x20,0x30,0x3b,
+	0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x61,0x74,
+	0x74,0x72,0x5f,0x69,0x6e,0x69,0x74,0x28,0x26,0x61,0x74,0x74,0x72,0x29,0x3b,0x0a,
+	0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x61,0x74,0x74,
+	0x72,0x5f,0x73,0x65,0x74,0x63,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x61,0x74,0x74,0x72,
+	0x2c,0x20,0x43,0x4c,0x4f,0x43,0x4b,0x5f,0x4d,0x4f,0x4e,0x4f,0x54,0x4f,0x4e,0x49,
+	0x43,0x29,0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,
+	0x64,0x5f,0x69,0x6e,0x69,0x74,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x77,0x61,0x6b,0x65,
+	0x2c,0x20,0x26,0x61,0x74,0x74,0x72,0x29,0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,
+	0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x61,0x74,0x74,0x72,0x5f,0x64,0x65,0x73,0x74,
+	0x72,0x6f,0x79,0x28,0x26,0x61,0x74,0x74,0x72,0x29,0x3b,0x0a,0x09,0x70,0x74,0x68,
+	0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x69,0x6e,0x69,0x74,0x28,0x26,
+	0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x65,0x64,0x2c,0x20,0x4e,0x55,0x4c,
+	0x4c,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x6c,
+	0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,0x6e,0x65,0x77,0x28,0x76,0x6f,0x69,0x64,
+	0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,
+	0x72,0x69,0x6e,0x67,0x20,0x2a,0x72,0x20,0x3d,0x20,0x61,0x6c,0x69,0x67,0x6e,0x65,
+	0x64,0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x5f,0x41,0x6c,0x69,0x67,0x6e,0x6f,0x66,
+	0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,
+	0x29,0x2c,0x0a,0x09,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x73,0x69,0x7a,0x65,0x6f,
+	0x66,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,
+	0x67,0x29,0x29,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x72,0x20,0x7c,0x7c,
+	0x20,0x21,0x6c,0x6f,0x67,0x5f,0x68,0x61,0x76,0x65,0x5f,0x6b,0x65,0x79,0x20,0x7c,
+	0x7c,0x20,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x73,0x65,0x74,0x73,0x70,0x65,
+	0x63,0x69,0x66,0x69,0x63,0x28,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,0x6b,
+	0x65,0x79,0x2c,0x20,0x72,0x29,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x66,0x72,0x65,0x65,0x28,0x72,0x29,0x3b,0x0a,0x09,0x09,0x6c,0x6f,0x67,0x5f,
+	0x72,0x69,0x6e,0x67,0x5f,0x66,0x61,0x69,0x6c,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,
+	0x75,0x65,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x4e,0x55,0x4c,
+	0x4c,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x72,0x2d,0x3e,0x63,0x6c,0x6f,0x73,0x65,0x64,
+	0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x09,0x72,0x2d,0x3e,0x62,0x75,
+	0x73,0x79,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x09,0x72,0x2d,0x3e,
+	0x68,0x65,0x61,0x64,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x09,0x72,0x2d,0x3e,0x74,0x61,
+	0x69,0x6c,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x72,0x2d,0x3e,0x6e,0x65,0x78,
+	0x74,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x28,
+	0x26,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x73,0x29,0x3b,0x0a,0x09,0x77,0x68,
+	0x69,0x6c,0x65,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x63,0x6f,0x6d,
+	0x70,0x61,0x72,0x65,0x5f,0x65,0x78,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x77,0x65,
+	0x61,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x73,0x2c,0x20,0x26,
+	0x72,0x2d,0x3e,0x6e,0x65,0x78,0x74,0x2c,0x20,0x72,0x29,0x29,0x0a,0x09,0x09,0x3b,
+	0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,
+	0x67,0x20,0x3d,0x20,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x76,0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,0x63,
+	0x6f,0x70,0x79,0x5f,0x69,0x6e,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,
+	0x67,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x72,0x2c,0x20,0x75,0x69,0x6e,0x74,0x5f,
+	0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x61,0x74,0x2c,0x0a,0x09,0x09,0x09,
+	0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x76,0x6f,0x69,0x64,0x20,
+	0x2a,0x73,0x72,0x63,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x29,0x0a,
+	0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6f,0x66,0x66,0x20,0x3d,0x20,
+	0x61,0x74,0x20,0x26,0x20,0x28,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,
+	0x49,0x5a,0x45,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x20,0x6b,0x20,0x3d,0x20,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,
+	0x49,0x5a,0x45,0x20,0x2d,0x20,0x6f,0x66,0x66,0x20,0x3c,0x20,0x6e,0x20,0x3f,0x20,
+	0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x2d,0x20,
+	0x6f,0x66,0x66,0x20,0x3a,0x20,0x6e,0x3b,0x0a,0x0a,0x09,0x6d,0x65,0x6d,0x63,0x70,
+	0x79,0x28,0x72,0x2d,0x3e,0x64,0x61,0x74,0x61,0x20,0x2b,0x20,0x6f,0x66,0x66,0x2c,
+	0x20,0x73,0x72,0x63,0x2c,0x20,0x6b,0x29,0x3b,0x0a,0x09,0x6d,0x65,0x6d,0x63,0x70,
+	0x79,0x28,0x72,0x2d,0x3e,0x64,0x61,0x74,0x61,0x2c,0x20,0x28,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x73,0x72,0x63,0x20,0x2b,0x20,0x6b,
+	0x2c,0x20,0x6e,0x20,0x2d,0x20,0x6b,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,
+	0x67,0x5f,0x63,0x6f,0x70,0x79,0x5f,0x6f,0x75,0x74,0x28,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,
+	0x20,0x2a,0x72,0x2c,0x20,0x75,0x69,0x6e,0x74,0x5f,0x66,0x61,0x73,0x74,0x36,0x34,
+	0x5f,0x74,0x20,0x61,0x74,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x76,0x6f,0x69,0x64,0x20,0x2a,0x64,0x73,0x74,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6f,
+	0x66,0x66,0x20,0x3d,0x20,0x61,0x74,0x20,0x26,0x20,0x28,0x4c,0x4f,0x47,0x5f,0x52,
+	0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x09,
+	0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6b,0x20,0x3d,0x20,0x4c,0x4f,0x47,0x5f,0x52,
+	0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x2d,0x20,0x6f,0x66,0x66,0x20,0x3c,
+	0x20,0x6e,0x20,0x3f,0x20,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,
+	0x5a,0x45,0x20,0x2d,0x20,0x6f,0x66,0x66,0x20,0x3a,0x20,0x6e,0x3b,0x0a,0x0a,0x09,
+	0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x64,0x73,0x74,0x2c,0x20,0x72,0x2d,0x3e,0x64,
+	0x61,0x74,0x61,0x20,0x2b,0x20,0x6f,0x66,0x66,0x2c,0x20,0x6b,0x29,0x3b,0x0a,0x09,
+	0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x64,
+	0x73,0x74,0x20,0x2b,0x20,0x6b,0x2c,0x20,0x72,0x2d,0x3e,0x64,0x61,0x74,0x61,0x2c,
+	0x20,0x6e,0x20,0x2d,0x20,0x6b,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x54,
+	0x68,0x65,0x20,0x77,0x72,0x69,0x74,0x65,0x72,0x20,0x6f,0x75,0x74,0x6c,0x69,0x76,
+	0x65,0x73,0x20,0x65,0x76,0x65,0x72,0x79,0x20,0x62,0x75,0x73,0x79,0x20,0x72,0x69,
+	0x6e,0x67,0x2c,0x20,0x73,0x6f,0x20,0x77,0x61,0x69,0x74,0x69,0x6e,0x67,0x20,0x66,
+	0x6f,0x72,0x20,0x72,0x6f,0x6f,0x6d,0x20,0x63,0x61,0x6e,0x6e,0x6f,0x74,0x20,0x68,
+	0x61,0x6e,0x67,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,
+	0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,0x5f,0x70,0x75,0x73,0x68,0x28,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x72,0x2c,
+	0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6c,0x69,0x6e,
+	0x65,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x32,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x29,
+	0x0a,0x7b,0x0a,0x09,0x75,0x69,0x6e,0x74,0x5f,0x66,0x61,0x73,0x74,0x36,0x34,0x5f,
+	0x74,0x20,0x68,0x65,0x61,0x64,0x20,0x3d,0x0a,0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,
+	0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,
+	0x26,0x72,0x2d,0x3e,0x68,0x65,0x61,0x64,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,
+	0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,
+	0x0a,0x09,0x75,0x69,0x6e,0x74,0x5f,0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,
+	0x6e,0x65,0x65,0x64,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6c,0x65,
+	0x6e,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x3b,0x0a,0x09,0x75,0x69,0x6e,0x74,0x5f,0x66,
+	0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x75,0x73,0x65,0x64,0x20,0x3d,0x0a,0x09,
+	0x09,0x68,0x65,0x61,0x64,0x20,0x2d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,
+	0x6f,0x61,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,
+	0x3e,0x74,0x61,0x69,0x6c,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,
+	0x64,0x65,0x72,0x5f,0x61,0x63,0x71,0x75,0x69,0x72,0x65,0x29,0x3b,0x0a,0x0a,0x09,
+	0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,
+	0x53,0x49,0x5a,0x45,0x20,0x2d,0x20,0x75,0x73,0x65,0x64,0x20,0x3c,0x20,0x6e,0x65,
+	0x65,0x64,0x29,0x20,0x7b,0x0a,0x09,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,
+	0x63,0x6f,0x6e,0x64,0x5f,0x73,0x69,0x67,0x6e,0x61,0x6c,0x28,0x26,0x6c,0x6f,0x67,
+	0x5f,0x77,0x61,0x6b,0x65,0x29,0x3b,0x0a,0x09,0x09,0x73,0x63,0x68,0x65,0x64,0x5f,
+	0x79,0x69,0x65,0x6c,0x64,0x28,0x29,0x3b,0x0a,0x09,0x09,0x75,0x73,0x65,0x64,0x20,
+	0x3d,0x20,0x68,0x65,0x61,0x64,0x20,0x2d,0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x78,
+	0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x74,0x61,0x69,0x6c,0x2c,
+	0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x61,0x63,
+	0x71,0x75,0x69,0x72,0x65,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x6c,0x6f,0x67,
+	0x5f,0x72,0x69,0x6e,0x67,0x5f,0x63,0x6f,0x70,0x79,0x5f,0x69,0x6e,0x28,0x72,0x2c,
+	0x20,0x68,0x65,0x61,0x64,0x2c,0x20,0x26,0x6c,0x65,0x6e,0x2c,0x20,0x73,0x69,0x7a,
+	0x65,0x6f,0x66,0x20,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x6c,0x6f,0x67,0x5f,0x72,
+	0x69,0x6e,0x67,0x5f,0x63,0x6f,0x70,0x79,0x5f,0x69,0x6e,0x28,0x72,0x2c,0x20,0x68,
+	0x65,0x61,0x64,0x20,0x2b,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6c,0x65,0x6e,
+	0x2c,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x61,
+	0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,0x78,0x70,0x6c,
+	0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x68,0x65,0x61,0x64,0x2c,0x20,0x68,
+	0x65,0x61,0x64,0x20,0x2b,0x20,0x6e,0x65,0x65,0x64,0x2c,0x20,0x6d,0x65,0x6d,0x6f,
+	0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,
+	0x29,0x3b,0x0a,0x0a,0x09,0x2f,0x2a,0x20,0x57,0x61,0x6b,0x65,0x20,0x74,0x68,0x65,
+	0x20,0x77,0x72,0x69,0x74,0x65,0x72,0x20,0x65,0x61,0x72,0x6c,0x79,0x20,0x6f,0x6e,
+	0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x6e,0x67,0x20,0x69,0x73,0x20,0x68,
+	0x61,0x6c,0x66,0x20,0x66,0x75,0x6c,0x6c,0x2c,0x20,0x72,0x61,0x74,0x68,0x65,0x72,
+	0x20,0x74,0x68,0x61,0x6e,0x20,0x6f,0x6e,0x0a,0x09,0x20,0x2a,0x20,0x65,0x76,0x65,
+	0x72,0x79,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2e,0x20,0x2a,0x2f,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x75,0x73,0x65,0x64,0x20,0x3c,0x20,0x4c,0x4f,0x47,0x5f,0x52,
+	0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x2f,0x20,0x32,0x20,0x26,0x26,0x20,
+	0x75,0x73,0x65,0x64,0x20,0x2b,0x20,0x6e,0x65,0x65,0x64,0x20,0x3e,0x3d,0x20,0x4c,
+	0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x2f,0x20,0x32,
+	0x29,0x0a,0x09,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,
+	0x5f,0x73,0x69,0x67,0x6e,0x61,0x6c,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x77,0x61,0x6b,
+	0x65,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,0x5f,
+	0x77,0x72,0x69,0x74,0x65,0x28,0x65,0x6e,0x75,0x6d,0x20,0x6c,0x6f,0x67,0x5f,0x6c,
+	0x65,0x76,0x65,0x6c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,
+	0x2e,0x2e,0x2e,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x6c,0x69,0x6e,
+	0x65,0x5b,0x4c,0x4f,0x47,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,0x5d,0x3b,
+	0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x3b,0x0a,0x09,0x69,
+	0x6e,0x74,0x20,0x6e,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,
+	0x6e,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3c,
+	0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x78,0x70,
+	0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x65,0x76,0x65,0x6c,
+	0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,
+	0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x20,0x7c,0x7c,0x0a,0x09,0x20,0x20,0x20,0x20,
+	0x6c,0x65,0x76,0x65,0x6c,0x20,0x3e,0x3d,0x20,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,
+	0x45,0x4c,0x5f,0x4f,0x46,0x46,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,
+	0x3b,0x0a,0x0a,0x09,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x6c,0x6f,0x67,0x5f,0x6c,0x65,
+	0x76,0x65,0x6c,0x73,0x5b,0x6c,0x65,0x76,0x65,0x6c,0x5d,0x2e,0x6c,0x65,0x6e,0x3b,
+	0x0a,0x09,0x6d,0x65,0x6d,0x63,0x70,0x79,0x28,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x6c,
+	0x6f,0x67,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x73,0x5b,0x6c,0x65,0x76,0x65,0x6c,0x5d,
+	0x2e,0x70,0x72,0x65,0x66,0x69,0x78,0x2c,0x20,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,
+	0x76,0x61,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x61,0x70,0x2c,0x20,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x29,0x3b,0x0a,0x09,0x6e,0x20,0x3d,0x20,0x76,0x73,0x6e,0x70,0x72,
+	0x69,0x6e,0x74,0x66,0x28,0x6c,0x69,0x6e,0x65,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x2c,
+	0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6c,0x69,0x6e,0x65,0x20,0x2d,0x20,0x6c,
+	0x65,0x6e,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x70,0x29,0x3b,
+	0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x70,0x29,0x3b,0x0a,0x09,0x69,
+	0x66,0x20,0x28,0x6e,0x20,0x3c,0x20,0x30,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x3b,0x0a,0x09,0x6c,0x65,0x6e,0x20,0x2b,0x3d,0x20,0x28,0x73,0x69,0x7a,
+	0x65,0x5f,0x74,0x29,0x6e,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x6c,0x65,0x6e,0x20,
+	0x3e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6c,0x69,0x6e,0x65,0x20,0x2d,0x20,
+	0x31,0x29,0x0a,0x09,0x09,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,
+	0x66,0x20,0x6c,0x69,0x6e,0x65,0x20,0x2d,0x20,0x31,0x3b,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x6c,0x69,0x6e,0x65,0x5b,0x6c,0x65,0x6e,0x20,0x2d,0x20,0x31,0x5d,0x20,0x21,
+	0x3d,0x20,0x27,0x5c,0x6e,0x27,0x29,0x0a,0x09,0x09,0x6c,0x69,0x6e,0x65,0x5b,0x6c,
+	0x65,0x6e,0x2b,0x2b,0x5d,0x20,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x3b,0x0a,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,
+	0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x75,
+	0x6e,0x6e,0x69,0x6e,0x67,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,
+	0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x29,0x20,0x7b,0x0a,
+	0x09,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,
+	0x67,0x20,0x2a,0x72,0x20,0x3d,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x3b,
+	0x0a,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x72,0x20,0x7c,0x7c,0x20,0x28,0x21,0x6c,
+	0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,0x66,0x61,0x69,0x6c,0x65,0x64,0x20,0x26,
+	0x26,0x20,0x28,0x72,0x20,0x3d,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,
+	0x6e,0x65,0x77,0x28,0x29,0x29,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x62,0x6f,
+	0x6f,0x6c,0x20,0x71,0x75,0x65,0x75,0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,
+	0x65,0x3b,0x0a,0x0a,0x09,0x09,0x09,0x2f,0x2a,0x20,0x50,0x61,0x69,0x72,0x73,0x20,
+	0x77,0x69,0x74,0x68,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,0x20,0x63,0x6c,
+	0x65,0x61,0x72,0x69,0x6e,0x67,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,0x69,
+	0x6e,0x67,0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x74,0x68,0x65,0x0a,0x09,0x09,
+	0x09,0x20,0x2a,0x20,0x77,0x72,0x69,0x74,0x65,0x72,0x20,0x63,0x68,0x65,0x63,0x6b,
+	0x73,0x20,0x62,0x75,0x73,0x79,0x3a,0x20,0x6f,0x6e,0x65,0x20,0x6f,0x66,0x20,0x74,
+	0x68,0x65,0x6d,0x20,0x73,0x65,0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x6f,0x74,0x68,
+	0x65,0x72,0x2e,0x20,0x2a,0x2f,0x0a,0x09,0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,
+	0x5f,0x73,0x74,0x6f,0x72,0x65,0x28,0x26,0x72,0x2d,0x3e,0x62,0x75,0x73,0x79,0x2c,
+	0x20,0x74,0x72,0x75,0x65,0x29,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x61,
+	0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x28,0x26,0x6c,0x6f,0x67,0x5f,
+	0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,
+	0x6c,0x6f,0x67,0x5f,0x70,0x75,0x73,0x68,0x28,0x72,0x2c,0x20,0x6c,0x69,0x6e,0x65,
+	0x2c,0x20,0x28,0x75,0x69,0x6e,0x74,0x33,0x32,0x5f,0x74,0x29,0x6c,0x65,0x6e,0x29,
+	0x3b,0x0a,0x09,0x09,0x09,0x09,0x71,0x75,0x65,0x75,0x65,0x64,0x20,0x3d,0x20,0x74,
+	0x72,0x75,0x65,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x61,0x74,0x6f,
+	0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+	0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x62,0x75,0x73,0x79,0x2c,0x20,0x66,0x61,0x6c,
+	0x73,0x65,0x2c,0x0a,0x09,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,
+	0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x65,
+	0x61,0x73,0x65,0x29,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x71,0x75,0x65,
+	0x75,0x65,0x64,0x29,0x0a,0x09,0x09,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+	0x0a,0x09,0x09,0x7d,0x0a,0x09,0x7d,0x0a,0x09,0x6c,0x6f,0x67,0x5f,0x64,0x69,0x72,
+	0x65,0x63,0x74,0x28,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x6c,0x65,0x6e,0x29,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x6c,
+	0x6f,0x67,0x5f,0x62,0x61,0x74,0x63,0x68,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x73,
+	0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x62,0x61,0x74,0x63,0x68,0x20,
+	0x2a,0x62,0x29,0x0a,0x7b,0x0a,0x09,0x6c,0x6f,0x67,0x5f,0x64,0x69,0x72,0x65,0x63,
+	0x74,0x28,0x62,0x2d,0x3e,0x64,0x61,0x74,0x61,0x2c,0x20,0x62,0x2d,0x3e,0x6c,0x65,
+	0x6e,0x29,0x3b,0x0a,0x09,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x30,0x3b,
+	0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x20,0x6c,0x6f,0x67,0x5f,0x64,0x72,0x61,0x69,0x6e,0x5f,0x72,0x69,0x6e,0x67,
+	0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,
+	0x20,0x2a,0x72,0x2c,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,
+	0x62,0x61,0x74,0x63,0x68,0x20,0x2a,0x62,0x29,0x0a,0x7b,0x0a,0x09,0x75,0x69,0x6e,
+	0x74,0x5f,0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x68,0x65,0x61,0x64,0x20,
+	0x3d,0x0a,0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,
+	0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x68,0x65,0x61,
+	0x64,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,
+	0x61,0x63,0x71,0x75,0x69,0x72,0x65,0x29,0x3b,0x0a,0x09,0x75,0x69,0x6e,0x74,0x5f,
+	0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x74,0x61,0x69,0x6c,0x20,0x3d,0x0a,
+	0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x78,
+	0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x74,0x61,0x69,0x6c,0x2c,
+	0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,
+	0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x77,0x68,0x69,
+	0x6c,0x65,0x20,0x28,0x74,0x61,0x69,0x6c,0x20,0x21,0x3d,0x20,0x68,0x65,0x61,0x64,
+	0x29,0x20,0x7b,0x0a,0x09,0x09,0x75,0x69,0x6e,0x74,0x33,0x32,0x5f,0x74,0x20,0x6c,
+	0x65,0x6e,0x3b,0x0a,0x0a,0x09,0x09,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,
+	0x63,0x6f,0x70,0x79,0x5f,0x6f,0x75,0x74,0x28,0x72,0x2c,0x20,0x74,0x61,0x69,0x6c,
+	0x2c,0x20,0x26,0x6c,0x65,0x6e,0x2c,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6c,
+	0x65,0x6e,0x29,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x73,0x69,0x7a,0x65,0x6f,
+	0x66,0x20,0x62,0x2d,0x3e,0x64,0x61,0x74,0x61,0x20,0x2d,0x20,0x62,0x2d,0x3e,0x6c,
+	0x65,0x6e,0x20,0x3c,0x20,0x6c,0x65,0x6e,0x29,0x0a,0x09,0x09,0x09,0x6c,0x6f,0x67,
+	0x5f,0x62,0x61,0x74,0x63,0x68,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x62,0x29,0x3b,
+	0x0a,0x09,0x09,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x5f,0x63,0x6f,0x70,0x79,
+	0x5f,0x6f,0x75,0x74,0x28,0x72,0x2c,0x20,0x74,0x61,0x69,0x6c,0x20,0x2b,0x20,0x73,
+	0x69,0x7a,0x65,0x6f,0x66,0x20,0x6c,0x65,0x6e,0x2c,0x20,0x62,0x2d,0x3e,0x64,0x61,
+	0x74,0x61,0x20,0x2b,0x20,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x2c,0x20,0x6c,0x65,0x6e,
+	0x29,0x3b,0x0a,0x09,0x09,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x2b,0x3d,0x20,0x6c,
+	0x65,0x6e,0x3b,0x0a,0x09,0x09,0x74,0x61,0x69,0x6c,0x20,0x2b,0x3d,0x20,0x73,0x69,
+	0x7a,0x65,0x6f,0x66,0x20,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x3b,0x0a,
+	0x09,0x09,0x63,0x6f,0x75,0x6e,0x74,0x2b,0x2b,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x61,
+	0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,0x78,0x70,0x6c,
+	0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x74,0x61,0x69,0x6c,0x2c,0x20,0x74,
+	0x61,0x69,0x6c,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,
+	0x72,0x5f,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,
+	0x75,0x72,0x6e,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,
+	0x20,0x44,0x72,0x61,0x69,0x6e,0x73,0x20,0x65,0x76,0x65,0x72,0x79,0x20,0x72,0x69,
+	0x6e,0x67,0x20,0x69,0x6e,0x74,0x6f,0x20,0x62,0x2c,0x20,0x77,0x72,0x69,0x74,0x65,
+	0x73,0x20,0x77,0x68,0x61,0x74,0x20,0x69,0x73,0x20,0x6c,0x65,0x66,0x74,0x20,0x6f,
+	0x76,0x65,0x72,0x2c,0x20,0x61,0x6e,0x64,0x20,0x66,0x72,0x65,0x65,0x73,0x20,0x74,
+	0x68,0x65,0x20,0x72,0x69,0x6e,0x67,0x73,0x0a,0x20,0x2a,0x20,0x6f,0x66,0x20,0x65,
+	0x78,0x69,0x74,0x65,0x64,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x20,0x6f,0x6e,
+	0x63,0x65,0x20,0x74,0x68,0x65,0x79,0x20,0x61,0x72,0x65,0x20,0x65,0x6d,0x70,0x74,
+	0x79,0x2e,0x20,0x54,0x68,0x65,0x20,0x6c,0x69,0x73,0x74,0x20,0x68,0x65,0x61,0x64,
+	0x20,0x69,0x73,0x20,0x6e,0x65,0x76,0x65,0x72,0x20,0x75,0x6e,0x6c,0x69,0x6e,0x6b,
+	0x65,0x64,0x2c,0x0a,0x20,0x2a,0x20,0x73,0x69,0x6e,0x63,0x65,0x20,0x70,0x72,0x6f,
+	0x64,0x75,0x63,0x65,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x70,0x75,
+	0x73,0x68,0x69,0x6e,0x67,0x20,0x6f,0x6e,0x74,0x6f,0x20,0x69,0x74,0x2e,0x20,0x2a,
+	0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x6c,0x6f,0x67,0x5f,0x64,0x72,0x61,0x69,0x6e,0x28,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x6c,0x6f,0x67,0x5f,0x62,0x61,0x74,0x63,0x68,0x20,0x2a,0x62,0x29,0x0a,0x7b,
+	0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,
+	0x67,0x20,0x2a,0x70,0x72,0x65,0x76,0x20,0x3d,0x20,0x4e,0x55,0x4c,0x4c,0x2c,0x20,
+	0x2a,0x72,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,
+	0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x73,0x29,0x3b,0x0a,0x09,0x73,
+	0x69,0x7a,0x65,0x5f,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x30,0x3b,
+	0x0a,0x0a,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x72,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,
+	0x20,0x2a,0x6e,0x65,0x78,0x74,0x20,0x3d,0x20,0x72,0x2d,0x3e,0x6e,0x65,0x78,0x74,
+	0x3b,0x0a,0x09,0x09,0x62,0x6f,0x6f,0x6c,0x20,0x63,0x6c,0x6f,0x73,0x65,0x64,0x20,
+	0x3d,0x0a,0x09,0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,
+	0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x63,0x6c,
+	0x6f,0x73,0x65,0x64,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,
+	0x65,0x72,0x5f,0x61,0x63,0x71,0x75,0x69,0x72,0x65,0x29,0x3b,0x0a,0x0a,0x09,0x09,
+	0x63,0x6f,0x75,0x6e,0x74,0x20,0x2b,0x3d,0x20,0x6c,0x6f,0x67,0x5f,0x64,0x72,0x61,
+	0x69,0x6e,0x5f,0x72,0x69,0x6e,0x67,0x28,0x72,0x2c,0x20,0x62,0x29,0x3b,0x0a,0x09,
+	0x09,0x69,0x66,0x20,0x28,0x63,0x6c,0x6f,0x73,0x65,0x64,0x20,0x26,0x26,0x20,0x70,
+	0x72,0x65,0x76,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x70,0x72,0x65,0x76,0x2d,0x3e,
+	0x6e,0x65,0x78,0x74,0x20,0x3d,0x20,0x6e,0x65,0x78,0x74,0x3b,0x0a,0x09,0x09,0x09,
+	0x66,0x72,0x65,0x65,0x28,0x72,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,
+	0x65,0x20,0x7b,0x0a,0x09,0x09,0x09,0x70,0x72,0x65,0x76,0x20,0x3d,0x20,0x72,0x3b,
+	0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x72,0x20,0x3d,0x20,0x6e,0x65,0x78,0x74,0x3b,
+	0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x20,
+	0x3e,0x20,0x30,0x29,0x0a,0x09,0x09,0x6c,0x6f,0x67,0x5f,0x62,0x61,0x74,0x63,0x68,
+	0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x62,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6c,0x6f,0x67,0x5f,0x61,0x6e,0x79,
+	0x5f,0x62,0x75,0x73,0x79,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,0x0a,0x09,0x66,
+	0x6f,0x72,0x20,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x72,
+	0x69,0x6e,0x67,0x20,0x2a,0x72,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+	0x6c,0x6f,0x61,0x64,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x69,0x6e,0x67,0x73,0x29,
+	0x3b,0x20,0x72,0x3b,0x20,0x72,0x20,0x3d,0x20,0x72,0x2d,0x3e,0x6e,0x65,0x78,0x74,
+	0x29,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,
+	0x6f,0x61,0x64,0x28,0x26,0x72,0x2d,0x3e,0x62,0x75,0x73,0x79,0x29,0x29,0x0a,0x09,
+	0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x09,
+	0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x7d,0x0a,
+	0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x2a,0x6c,0x6f,
+	0x67,0x5f,0x77,0x72,0x69,0x74,0x65,0x72,0x28,0x76,0x6f,0x69,0x64,0x20,0x2a,0x61,
+	0x72,0x67,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,
+	0x67,0x5f,0x62,0x61,0x74,0x63,0x68,0x20,0x2a,0x62,0x20,0x3d,0x20,0x61,0x72,0x67,
+	0x3b,0x0a,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,
+	0x78,0x5f,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,0x63,0x6b,
+	0x29,0x3b,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x3b,0x3b,0x29,0x20,0x7b,0x0a,0x09,
+	0x09,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x77,
+	0x61,0x6e,0x74,0x20,0x3d,0x20,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x5f,
+	0x72,0x65,0x71,0x3b,0x0a,0x09,0x09,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x74,0x6f,0x70,
+	0x20,0x3d,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,0x70,0x69,0x6e,0x67,0x3b,
+	0x0a,0x09,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,
+	0x0a,0x0a,0x09,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,
+	0x78,0x5f,0x75,0x6e,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,
+	0x63,0x6b,0x29,0x3b,0x0a,0x09,0x09,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x6c,
+	0x6f,0x67,0x5f,0x64,0x72,0x61,0x69,0x6e,0x28,0x62,0x29,0x3b,0x0a,0x09,0x09,0x70,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x6c,0x6f,0x63,
+	0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x0a,0x09,
+	0x09,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x5f,0x64,0x6f,0x6e,0x65,0x20,
+	0x3d,0x20,0x77,0x61,0x6e,0x74,0x3b,0x0a,0x09,0x09,0x70,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x62,0x72,0x6f,0x61,0x64,0x63,0x61,0x73,0x74,
+	0x28,0x26,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x65,0x64,0x29,0x3b,0x0a,
+	0x09,0x09,0x69,0x66,0x20,0x28,0x73,0x74,0x6f,0x70,0x29,0x20,0x7b,0x0a,0x09,0x09,
+	0x09,0x2f,0x2a,0x20,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,
+	0x69,0x73,0x20,0x61,0x6c,0x72,0x65,0x61,0x64,0x79,0x20,0x66,0x61,0x6c,0x73,0x65,
+	0x2c,0x20,0x73,0x6f,0x20,0x6e,0x6f,0x20,0x70,0x75,0x73,0x68,0x20,0x63,0x61,0x6e,
+	0x20,0x73,0x74,0x61,0x72,0x74,0x3b,0x0a,0x09,0x09,0x09,0x20,0x2a,0x20,0x6c,0x65,
+	0x74,0x20,0x74,0x68,0x65,0x20,0x6f,0x6e,0x65,0x73,0x20,0x69,0x6e,0x20,0x66,0x6c,
+	0x69,0x67,0x68,0x74,0x20,0x6c,0x61,0x6e,0x64,0x20,0x61,0x6e,0x64,0x20,0x64,0x72,
+	0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x6d,0x20,0x74,0x6f,0x6f,0x2e,0x20,0x2a,0x2f,
+	0x0a,0x09,0x09,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,
+	0x78,0x5f,0x75,0x6e,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,
+	0x63,0x6b,0x29,0x3b,0x0a,0x09,0x09,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6c,
+	0x6f,0x67,0x5f,0x61,0x6e,0x79,0x5f,0x62,0x75,0x73,0x79,0x28,0x29,0x29,0x20,0x7b,
+	0x0a,0x09,0x09,0x09,0x09,0x6c,0x6f,0x67,0x5f,0x64,0x72,0x61,0x69,0x6e,0x28,0x62,
+	0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x73,0x63,0x68,0x65,0x64,0x5f,0x79,0x69,0x65,
+	0x6c,0x64,0x28,0x29,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x6c,0x6f,
+	0x67,0x5f,0x64,0x72,0x61,0x69,0x6e,0x28,0x62,0x29,0x3b,0x0a,0x09,0x09,0x09,0x70,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x6c,0x6f,0x63,
+	0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x09,0x09,
+	0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,0x69,0x66,
+	0x20,0x28,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x3d,0x20,0x30,0x20,0x26,0x26,0x20,
+	0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x5f,0x72,0x65,0x71,0x20,0x3d,0x3d,
+	0x20,0x77,0x61,0x6e,0x74,0x20,0x26,0x26,0x20,0x21,0x6c,0x6f,0x67,0x5f,0x73,0x74,
+	0x6f,0x70,0x70,0x69,0x6e,0x67,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x74,0x69,0x6d,0x65,0x73,0x70,0x65,0x63,0x20,0x74,0x73,0x3b,
+	0x0a,0x0a,0x09,0x09,0x09,0x63,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x65,0x74,0x74,0x69,
+	0x6d,0x65,0x28,0x43,0x4c,0x4f,0x43,0x4b,0x5f,0x4d,0x4f,0x4e,0x4f,0x54,0x4f,0x4e,
+	0x49,0x43,0x2c,0x20,0x26,0x74,0x73,0x29,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,
+	0x28,0x74,0x73,0x2e,0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,0x20,0x3c,0x20,0x31,0x30,
+	0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x20,0x2d,0x20,0x4c,0x4f,0x47,0x5f,0x49,
+	0x44,0x4c,0x45,0x5f,0x4e,0x53,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x74,0x73,
+	0x2e,0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,0x20,0x2b,0x3d,0x20,0x4c,0x4f,0x47,0x5f,
+	0x49,0x44,0x4c,0x45,0x5f,0x4e,0x53,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x20,0x65,0x6c,
+	0x73,0x65,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x74,0x73,0x2e,0x74,0x76,0x5f,0x73,
+	0x65,0x63,0x2b,0x2b,0x3b,0x0a,0x09,0x09,0x09,0x09,0x74,0x73,0x2e,0x74,0x76,0x5f,
+	0x6e,0x73,0x65,0x63,0x20,0x2d,0x3d,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x30,0x30,0x20,0x2d,0x20,0x4c,0x4f,0x47,0x5f,0x49,0x44,0x4c,0x45,0x5f,0x4e,0x53,
+	0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x70,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x74,0x69,0x6d,0x65,0x64,0x77,0x61,0x69,0x74,
+	0x28,0x26,0x6c,0x6f,0x67,0x5f,0x77,0x61,0x6b,0x65,0x2c,0x20,0x26,0x6c,0x6f,0x67,
+	0x5f,0x6c,0x6f,0x63,0x6b,0x2c,0x20,0x26,0x74,0x73,0x29,0x3b,0x0a,0x09,0x09,0x7d,
+	0x0a,0x09,0x7d,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,
+	0x65,0x78,0x5f,0x75,0x6e,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,
+	0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x09,0x66,0x72,0x65,0x65,0x28,0x62,0x29,0x3b,0x0a,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x7d,0x0a,
+	0x0a,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x69,
+	0x6e,0x74,0x20,0x66,0x64,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x62,0x6f,0x6f,0x6c,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,
+	0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x62,0x61,
+	0x74,0x63,0x68,0x20,0x2a,0x62,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x65,0x72,0x72,
+	0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,
+	0x6f,0x61,0x64,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,
+	0x29,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x09,
+	0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6f,0x6e,0x63,0x65,0x28,0x26,0x6c,0x6f,
+	0x67,0x5f,0x6f,0x6e,0x63,0x65,0x2c,0x20,0x6c,0x6f,0x67,0x5f,0x69,0x6e,0x69,0x74,
+	0x29,0x3b,0x0a,0x09,0x62,0x20,0x3d,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,
+	0x69,0x7a,0x65,0x6f,0x66,0x20,0x2a,0x62,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,
+	0x21,0x62,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,
+	0x0a,0x09,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,
+	0x6c,0x6f,0x67,0x5f,0x66,0x64,0x20,0x3d,0x20,0x66,0x64,0x3b,0x0a,0x09,0x6c,0x6f,
+	0x67,0x5f,0x73,0x74,0x6f,0x70,0x70,0x69,0x6e,0x67,0x20,0x3d,0x20,0x66,0x61,0x6c,
+	0x73,0x65,0x3b,0x0a,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,
+	0x65,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x2c,0x20,
+	0x74,0x72,0x75,0x65,0x29,0x3b,0x0a,0x09,0x65,0x72,0x72,0x20,0x3d,0x20,0x70,0x74,
+	0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x72,0x65,0x61,0x74,0x65,0x28,0x26,0x6c,0x6f,
+	0x67,0x5f,0x77,0x72,0x69,0x74,0x65,0x72,0x5f,0x74,0x68,0x72,0x65,0x61,0x64,0x2c,
+	0x20,0x4e,0x55,0x4c,0x4c,0x2c,0x20,0x6c,0x6f,0x67,0x5f,0x77,0x72,0x69,0x74,0x65,
+	0x72,0x2c,0x20,0x62,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x65,0x72,0x72,0x20,
+	0x21,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,
+	0x5f,0x73,0x74,0x6f,0x72,0x65,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,
+	0x69,0x6e,0x67,0x2c,0x20,0x66,0x61,0x6c,0x73,0x65,0x29,0x3b,0x0a,0x09,0x09,0x66,
+	0x72,0x65,0x65,0x28,0x62,0x29,0x3b,0x0a,0x09,0x09,0x65,0x72,0x72,0x6e,0x6f,0x20,
+	0x3d,0x20,0x65,0x72,0x72,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x2d,0x31,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x72,0x65,0x67,
+	0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x29,0x0a,0x09,0x09,0x72,0x65,0x67,0x69,0x73,
+	0x74,0x65,0x72,0x65,0x64,0x20,0x3d,0x20,0x61,0x74,0x65,0x78,0x69,0x74,0x28,0x6c,
+	0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,0x29,0x20,0x3d,0x3d,0x20,0x30,0x3b,0x0a,0x09,
+	0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+	0x64,0x20,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x76,0x6f,0x69,0x64,
+	0x29,0x0a,0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,0x69,0x63,
+	0x5f,0x6c,0x6f,0x61,0x64,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,0x69,
+	0x6e,0x67,0x29,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,
+	0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x6c,0x6f,
+	0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x09,
+	0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x77,0x61,
+	0x6e,0x74,0x20,0x3d,0x20,0x2b,0x2b,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,
+	0x5f,0x72,0x65,0x71,0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x63,
+	0x6f,0x6e,0x64,0x5f,0x73,0x69,0x67,0x6e,0x61,0x6c,0x28,0x26,0x6c,0x6f,0x67,0x5f,
+	0x77,0x61,0x6b,0x65,0x29,0x3b,0x0a,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6c,
+	0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x5f,0x64,0x6f,0x6e,0x65,0x20,0x3c,0x20,
+	0x77,0x61,0x6e,0x74,0x20,0x26,0x26,0x20,0x21,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,
+	0x70,0x70,0x69,0x6e,0x67,0x29,0x0a,0x09,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,
+	0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x77,0x61,0x69,0x74,0x28,0x26,0x6c,0x6f,0x67,0x5f,
+	0x66,0x6c,0x75,0x73,0x68,0x65,0x64,0x2c,0x20,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,
+	0x63,0x6b,0x29,0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,
+	0x74,0x65,0x78,0x5f,0x75,0x6e,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,
+	0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x45,0x76,0x65,
+	0x72,0x79,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x71,0x75,0x65,0x75,0x65,
+	0x64,0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,
+	0x70,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x73,0x20,0x69,0x73,0x20,0x77,0x72,0x69,
+	0x74,0x74,0x65,0x6e,0x2e,0x20,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x73,0x20,0x74,
+	0x68,0x61,0x74,0x0a,0x20,0x2a,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x72,
+	0x65,0x61,0x64,0x73,0x20,0x6c,0x6f,0x67,0x20,0x66,0x72,0x6f,0x6d,0x20,0x74,0x68,
+	0x65,0x20,0x6d,0x6f,0x6d,0x65,0x6e,0x74,0x20,0x69,0x74,0x20,0x69,0x73,0x20,0x63,
+	0x61,0x6c,0x6c,0x65,0x64,0x20,0x67,0x6f,0x20,0x73,0x74,0x72,0x61,0x69,0x67,0x68,
+	0x74,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x64,0x2c,0x20,0x73,0x6f,0x0a,
+	0x20,0x2a,0x20,0x74,0x68,0x65,0x79,0x20,0x6d,0x61,0x79,0x20,0x61,0x70,0x70,0x65,
+	0x61,0x72,0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x6f,0x6c,0x64,0x65,0x72,0x20,
+	0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x73,0x20,0x73,0x74,0x69,0x6c,0x6c,0x20,0x69,
+	0x6e,0x20,0x74,0x68,0x6f,0x73,0x65,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x27,
+	0x20,0x72,0x69,0x6e,0x67,0x73,0x2e,0x20,0x2a,0x2f,0x0a,0x76,0x6f,0x69,0x64,0x20,
+	0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x65,0x78,
+	0x63,0x68,0x61,0x6e,0x67,0x65,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x72,0x75,0x6e,0x6e,
+	0x69,0x6e,0x67,0x2c,0x20,0x66,0x61,0x6c,0x73,0x65,0x29,0x29,0x0a,0x09,0x09,0x72,
+	0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,
+	0x6d,0x75,0x74,0x65,0x78,0x5f,0x6c,0x6f,0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,
+	0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,0x09,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,
+	0x70,0x69,0x6e,0x67,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x09,0x70,0x74,
+	0x68,0x72,0x65,0x61,0x64,0x5f,0x63,0x6f,0x6e,0x64,0x5f,0x73,0x69,0x67,0x6e,0x61,
+	0x6c,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x77,0x61,0x6b,0x65,0x29,0x3b,0x0a,0x09,0x70,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6d,0x75,0x74,0x65,0x78,0x5f,0x75,0x6e,0x6c,
+	0x6f,0x63,0x6b,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x6f,0x63,0x6b,0x29,0x3b,0x0a,
+	0x09,0x70,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6a,0x6f,0x69,0x6e,0x28,0x6c,0x6f,
+	0x67,0x5f,0x77,0x72,0x69,0x74,0x65,0x72,0x5f,0x74,0x68,0x72,0x65,0x61,0x64,0x2c,
+	0x20,0x4e,0x55,0x4c,0x4c,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,
+	0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x6c,0x6f,0x67,0x2e,0x63,0x20,
+	0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file7[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x6c,
+	0x6f,0x67,0x20,0x2d,0x20,0x41,0x73,0x79,0x6e,0x63,0x68,0x72,0x6f,0x6e,0x6f,0x75,
+	0x73,0x20,0x6c,0x6f,0x67,0x67,0x69,0x6e,0x67,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x43,0x4f,0x4e,0x46,0x49,0x47,0x55,0x52,0x41,0x54,0x49,0x4f,0x4e,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x20,0x4c,0x4f,0x47,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x42,0x79,0x74,0x65,
+	0x73,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x65,0x64,0x20,0x70,0x65,0x72,0x20,0x70,
+	0x72,0x6f,0x64,0x75,0x63,0x69,0x6e,0x67,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x2c,
+	0x20,0x61,0x20,0x70,0x6f,0x77,0x65,0x72,0x20,0x6f,0x66,0x20,0x74,0x77,0x6f,0x20,
+	0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x36,0x35,0x35,0x33,0x36,0x29,0x3b,0x20,0x61,0x20,
+	0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x77,0x68,0x6f,0x73,0x65,0x20,0x72,0x69,0x6e,
+	0x67,0x20,0x69,0x73,0x20,0x66,0x75,0x6c,0x6c,0x20,0x77,0x61,0x69,0x74,0x73,0x20,
+	0x66,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x77,0x72,0x69,0x74,0x65,0x72,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+	0x4c,0x4f,0x47,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4c,0x6f,0x6e,0x67,0x65,0x73,
+	0x74,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x69,0x6e,0x20,0x62,0x79,0x74,
+	0x65,0x73,0x20,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x31,0x30,0x32,0x34,
+	0x29,0x3b,0x20,0x6c,0x6f,0x6e,0x67,0x65,0x72,0x20,0x6f,0x6e,0x65,0x73,0x20,0x61,
+	0x72,0x65,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x64,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,
+	0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,
+	0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,
+	0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,
+	0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,
+	0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,
+	0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,
+	0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,
+	0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,
+	0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,
+	0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,
+	0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,
+	0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,
+	0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,
+	0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,
+	0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,
+	0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,
+	0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,
+	0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,
+	0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,
+	0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,
+	0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,
+	0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,
+	0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,
+	0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,
+	0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,
+	0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,
+	0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,
+	0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,
+	0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,
+	0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,
+	0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,
+	0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,
+	0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,
+	0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+	0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,
+	0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,
+	0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,
+	0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,
+	0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,
+	0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,
+	0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,
+	0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,
+	0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,
+	0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,
+	0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,
+	0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,
+	0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,
+	0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,
+	0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,
+	0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,
+	0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,
+	0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,
+	0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,
+	0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+	0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,
+	0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,
+	0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,
+	0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,
+	0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,
+	0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,
+	0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,
+	0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,
+	0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,
+	0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,
+	0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,
+	0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,
+	0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,
+	0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,
+	0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,
+	0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,
+	0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,
+	0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,
+	0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,
+	0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,
+	0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,
+	0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,
+	0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,
+	0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,
+	0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,
+	0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,
+	0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,
+	0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,
+	0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,
+	0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,
+	0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,
+	0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,
+	0x20,0x4c,0x4f,0x47,0x5f,0x48,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4c,
+	0x4f,0x47,0x5f,0x48,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,
+	0x73,0x74,0x64,0x61,0x74,0x6f,0x6d,0x69,0x63,0x2e,0x68,0x3e,0x0a,0x0a,0x65,0x6e,
+	0x75,0x6d,0x20,0x6c,0x6f,0x67,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x20,0x7b,0x0a,0x09,
+	0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x44,0x45,0x42,0x55,0x47,0x2c,
+	0x0a,0x09,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x49,0x4e,0x46,0x4f,
+	0x2c,0x0a,0x09,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x57,0x41,0x52,
+	0x4e,0x2c,0x0a,0x09,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x45,0x52,
+	0x52,0x4f,0x52,0x2c,0x0a,0x09,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,
+	0x4f,0x46,0x46,0x0a,0x7d,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x4d,0x65,0x73,0x73,0x61,
+	0x67,0x65,0x73,0x20,0x62,0x65,0x6c,0x6f,0x77,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,
+	0x65,0x76,0x65,0x6c,0x20,0x61,0x72,0x65,0x20,0x73,0x6b,0x69,0x70,0x70,0x65,0x64,
+	0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x6c,0x6f,0x67,0x5f,0x2a,0x66,0x20,0x6d,
+	0x61,0x63,0x72,0x6f,0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x20,0x73,0x69,0x6e,
+	0x67,0x6c,0x65,0x0a,0x20,0x2a,0x20,0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,0x2c,0x20,
+	0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x61,0x6e,0x79,0x20,0x61,0x72,0x67,0x75,0x6d,
+	0x65,0x6e,0x74,0x20,0x69,0x73,0x20,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,0x65,0x64,
+	0x2e,0x20,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x73,0x20,0x74,0x6f,0x20,0x4c,0x4f,
+	0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x49,0x4e,0x46,0x4f,0x2e,0x0a,0x20,0x2a,
+	0x20,0x49,0x74,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x63,0x68,0x61,0x6e,0x67,
+	0x65,0x64,0x20,0x61,0x74,0x20,0x61,0x6e,0x79,0x20,0x74,0x69,0x6d,0x65,0x20,0x77,
+	0x68,0x69,0x6c,0x65,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x73,0x20,0x6c,0x6f,0x67,0x3b,0x20,0x74,0x68,0x65,0x79,0x20,0x72,0x65,0x61,
+	0x64,0x20,0x69,0x74,0x20,0x77,0x69,0x74,0x68,0x0a,0x20,0x2a,0x20,0x61,0x20,0x72,
+	0x65,0x6c,0x61,0x78,0x65,0x64,0x20,0x6c,0x6f,0x61,0x64,0x2c,0x20,0x73,0x6f,0x20,
+	0x61,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x73,0x68,0x6f,0x77,0x73,0x20,0x75,
+	0x70,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x6f,0x72,0x64,0x65,0x72,0x69,
+	0x6e,0x67,0x20,0x61,0x6e,0x79,0x74,0x68,0x69,0x6e,0x67,0x20,0x65,0x6c,0x73,0x65,
+	0x2e,0x20,0x2a,0x2f,0x0a,0x65,0x78,0x74,0x65,0x72,0x6e,0x20,0x5f,0x41,0x74,0x6f,
+	0x6d,0x69,0x63,0x20,0x65,0x6e,0x75,0x6d,0x20,0x6c,0x6f,0x67,0x5f,0x6c,0x65,0x76,
+	0x65,0x6c,0x20,0x6c,0x6f,0x67,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x3b,0x0a,0x0a,0x2f,
+	0x2a,0x20,0x45,0x61,0x63,0x68,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6f,
+	0x72,0x6d,0x61,0x74,0x73,0x20,0x69,0x6e,0x74,0x6f,0x20,0x69,0x74,0x73,0x20,0x6f,
+	0x77,0x6e,0x20,0x73,0x69,0x6e,0x67,0x6c,0x65,0x2d,0x70,0x72,0x6f,0x64,0x75,0x63,
+	0x65,0x72,0x20,0x72,0x69,0x6e,0x67,0x3b,0x20,0x61,0x20,0x62,0x61,0x63,0x6b,0x67,
+	0x72,0x6f,0x75,0x6e,0x64,0x0a,0x20,0x2a,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+	0x73,0x74,0x61,0x72,0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x6c,0x6f,0x67,0x5f,0x73,
+	0x74,0x61,0x72,0x74,0x20,0x64,0x72,0x61,0x69,0x6e,0x73,0x20,0x74,0x68,0x65,0x20,
+	0x72,0x69,0x6e,0x67,0x73,0x20,0x61,0x6e,0x64,0x20,0x77,0x72,0x69,0x74,0x65,0x73,
+	0x20,0x74,0x6f,0x20,0x66,0x64,0x20,0x69,0x6e,0x20,0x6c,0x61,0x72,0x67,0x65,0x0a,
+	0x20,0x2a,0x20,0x62,0x61,0x74,0x63,0x68,0x65,0x73,0x2e,0x20,0x42,0x65,0x66,0x6f,
+	0x72,0x65,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x61,0x72,0x74,0x2c,0x20,0x61,0x6e,
+	0x64,0x20,0x66,0x72,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x6d,0x6f,0x6d,0x65,0x6e,
+	0x74,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,0x20,0x69,0x73,0x20,0x63,0x61,
+	0x6c,0x6c,0x65,0x64,0x2c,0x0a,0x20,0x2a,0x20,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,
+	0x73,0x20,0x61,0x72,0x65,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x64,0x69,
+	0x72,0x65,0x63,0x74,0x6c,0x79,0x2e,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x61,0x72,
+	0x74,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x73,0x20,0x6c,0x6f,0x67,0x5f,
+	0x73,0x74,0x6f,0x70,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x74,0x65,0x78,0x69,0x74,
+	0x2e,0x20,0x2a,0x2f,0x0a,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x61,
+	0x72,0x74,0x28,0x69,0x6e,0x74,0x20,0x66,0x64,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,
+	0x20,0x6c,0x6f,0x67,0x5f,0x73,0x74,0x6f,0x70,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,
+	0x0a,0x76,0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,
+	0x76,0x6f,0x69,0x64,0x29,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6c,0x6f,0x67,
+	0x5f,0x77,0x72,0x69,0x74,0x65,0x28,0x65,0x6e,0x75,0x6d,0x20,0x6c,0x6f,0x67,0x5f,
+	0x6c,0x65,0x76,0x65,0x6c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x2c,0x20,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,
+	0x20,0x2e,0x2e,0x2e,0x29,0x0a,0x09,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+	0x74,0x65,0x5f,0x5f,0x28,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,0x70,0x72,0x69,
+	0x6e,0x74,0x66,0x2c,0x20,0x32,0x2c,0x20,0x33,0x29,0x29,0x29,0x3b,0x0a,0x0a,0x23,
+	0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4c,0x4f,0x47,0x5f,0x41,0x54,0x28,0x6c,0x65,
+	0x76,0x65,0x6c,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5c,0x0a,0x09,0x64,0x6f,0x20,
+	0x7b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x5c,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x28,0x6c,0x65,0x76,0x65,0x6c,0x29,0x20,
+	0x3e,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,0x65,
+	0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x6c,0x6f,0x67,0x5f,0x6c,0x65,0x76,
+	0x65,0x6c,0x2c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5c,
+	0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x6d,0x65,0x6d,0x6f,0x72,
+	0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,
+	0x29,0x20,0x5c,0x0a,0x09,0x09,0x09,0x6c,0x6f,0x67,0x5f,0x77,0x72,0x69,0x74,0x65,
+	0x28,0x6c,0x65,0x76,0x65,0x6c,0x2c,0x20,0x5f,0x5f,0x56,0x41,0x5f,0x41,0x52,0x47,
+	0x53,0x5f,0x5f,0x29,0x3b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5c,0x0a,0x09,0x7d,0x20,0x77,
+	0x68,0x69,0x6c,0x65,0x20,0x28,0x30,0x29,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,
+	0x65,0x20,0x6c,0x6f,0x67,0x5f,0x64,0x65,0x62,0x75,0x67,0x66,0x28,0x2e,0x2e,0x2e,
+	0x29,0x20,0x4c,0x4f,0x47,0x5f,0x41,0x54,0x28,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,
+	0x45,0x4c,0x5f,0x44,0x45,0x42,0x55,0x47,0x2c,0x20,0x5f,0x5f,0x56,0x41,0x5f,0x41,
+	0x52,0x47,0x53,0x5f,0x5f,0x29,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x6c,
+	0x6f,0x67,0x5f,0x69,0x6e,0x66,0x6f,0x66,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x4c,0x4f,
+	0x47,0x5f,0x41,0x54,0x28,0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x49,
+	0x4e,0x46,0x4f,0x2c,0x20,0x5f,0x5f,0x56,0x41,0x5f,0x41,0x52,0x47,0x53,0x5f,0x5f,
+	0x29,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x6c,0x6f,0x67,0x5f,0x77,0x61,
+	0x72,0x6e,0x66,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x4c,0x4f,0x47,0x5f,0x41,0x54,0x28,
+	0x4c,0x4f,0x47,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x5f,0x57,0x41,0x52,0x4e,0x2c,0x20,
+	0x5f,0x5f,0x56,0x41,0x5f,0x41,0x52,0x47,0x53,0x5f,0x5f,0x29,0x0a,0x23,0x64,0x65,
+	0x66,0x69,0x6e,0x65,0x20,0x6c,0x6f,0x67,0x5f,0x65,0x72,0x72,0x6f,0x72,0x66,0x28,
+	0x2e,0x2e,0x2e,0x29,0x20,0x4c,0x4f,0x47,0x5f,0x41,0x54,0x28,0x4c,0x4f,0x47,0x5f,
+	0x4c,0x45,0x56,0x45,0x4c,0x5f,0x45,0x52,0x52,0x4f,0x52,0x2c,0x20,0x5f,0x5f,0x56,
+	0x41,0x5f,0x41,0x52,0x47,0x53,0x5f,0x5f,0x29,0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,
+	0x66,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,
+	0x65,0x20,0x6c,0x6f,0x67,0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file8[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x70,
+	0x72,0x6f,0x67,0x69,0x6e,0x66,0x6f,0x20,0x2d,0x20,0x50,0x72,0x6f,0x67,0x72,0x61,
+	0x6d,0x20,0x69,0x6e,0x66,0x6f,0x72,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x75,
+	0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2c,0x20,0x6d,0x61,0x63,0x72,0x6f,0x73,0x2c,
+	0x20,0x61,0x6e,0x64,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,
+	0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,
+	0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,
+	0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,
+	0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,
+	0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,
+	0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,
+	0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,
+	0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,
+	0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,
+	0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,
+	0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,
+	0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,
+	0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+	0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+	0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,
+	0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,
+	0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,
+	0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,
+	0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,
+	0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,
+	0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,
+	0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,
+	0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,
+	0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,
+	0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,
+	0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,
+	0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,
+	0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,
+	0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,
+	0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,
+	0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,
+	0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,
+	0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,
+	0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,
+	0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,
+	0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,
+	0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,
+	0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,
+	0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,
+	0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,
+	0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,
+	0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,
+	0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,
+	0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,
+	0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,
+	0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,
+	0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,
+	0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,
+	0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,
+	0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,
+	0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,
+	0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,
+	0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,
+	0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,
+	0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,
+	0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,
+	0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,
+	0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,
+	0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,
+	0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,
+	0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,
+	0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,
+	0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,
+	0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,
+	0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,
+	0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,
+	0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,
+	0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,
+	0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,
+	0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,
+	0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,
+	0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,
+	0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,
+	0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,
+	0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,
+	0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,
+	0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,
+	0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,
+	0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,
+	0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,
+	0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+	0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,
+	0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,
+	0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,
+	0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,
+	0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,
+	0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x68,
+	0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6c,0x69,0x62,0x67,
+	0x65,0x6e,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,
+	0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,
+	0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x70,0x72,0x6f,0x67,
+	0x69,0x6e,0x66,0x6f,0x2e,0x68,0x22,0x0a,0x0a,0x2f,0x2a,0x20,0x54,0x4f,0x44,0x4f,
+	0x28,0x76,0x78,0x2d,0x63,0x6c,0x75,0x74,0x63,0x68,0x29,0x3a,0x20,0x64,0x65,0x66,
+	0x61,0x75,0x6c,0x74,0x20,0x74,0x68,0x69,0x73,0x20,0x74,0x6f,0x20,0x61,0x72,0x67,
+	0x76,0x5b,0x30,0x5d,0x20,0x2a,0x2f,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x70,0x72,0x6f,0x67,0x5f,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,
+	0x22,0x22,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x73,0x65,0x74,0x5f,0x70,0x72,
+	0x6f,0x67,0x5f,0x6e,0x61,0x6d,0x65,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,
+	0x6d,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x70,0x72,0x6f,0x67,0x5f,0x6e,0x61,0x6d,0x65,
+	0x20,0x3d,0x20,0x70,0x72,0x6f,0x67,0x5f,0x6e,0x61,0x6d,0x65,0x20,0x3f,0x20,0x62,
+	0x61,0x73,0x65,0x6e,0x61,0x6d,0x65,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x3a,0x20,
+	0x22,0x22,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x6d,0x69,0x74,
+	0x5f,0x74,0x72,0x79,0x5f,0x68,0x65,0x6c,0x70,0x28,0x29,0x0a,0x7b,0x0a,0x09,0x70,
+	0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x54,0x72,0x79,0x20,0x27,0x25,0x73,0x20,0x2d,
+	0x2d,0x68,0x65,0x6c,0x70,0x27,0x20,0x66,0x6f,0x72,0x20,0x6d,0x6f,0x72,0x65,0x20,
+	0x69,0x6e,0x66,0x6f,0x72,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,
+	0x70,0x72,0x6f,0x67,0x5f,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
+	0x6f,0x69,0x64,0x20,0x65,0x6d,0x69,0x74,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,
+	0x28,0x29,0x0a,0x7b,0x0a,0x09,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x5c,0x0a,
+	0x25,0x73,0x20,0x25,0x73,0x20,0x25,0x64,0x5c,0x6e,0x5c,0x0a,0x43,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x43,0x29,0x20,0x25,0x64,0x20,0x47,0x43,0x4b,
+	0x2e,0x5c,0x6e,0x5c,0x0a,0x54,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x66,0x72,0x65,
+	0x65,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x3a,0x20,0x79,0x6f,0x75,0x20,
+	0x61,0x72,0x65,0x20,0x66,0x72,0x65,0x65,0x20,0x74,0x6f,0x20,0x63,0x68,0x61,0x6e,
+	0x67,0x65,0x20,0x61,0x6e,0x64,0x20,0x72,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,
+	0x75,0x74,0x65,0x20,0x69,0x74,0x2e,0x5c,0x6e,0x5c,0x0a,0x54,0x68,0x65,0x72,0x65,
+	0x20,0x69,0x73,0x20,0x4e,0x4f,0x20,0x57,0x41,0x52,0x52,0x4e,0x54,0x59,0x2c,0x20,
+	0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x65,0x78,0x74,0x65,0x6e,0x74,0x20,0x70,0x65,
+	0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x6c,0x61,0x77,0x2e,0x5c,
+	0x6e,0x5c,0x0a,0x22,0x2c,0x0a,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,
+	0x6f,0x67,0x5f,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x56,0x45,0x52,0x53,0x49,0x4f,0x4e,
+	0x2c,0x20,0x70,0x72,0x6f,0x67,0x5f,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x2c,0x20,0x59,
+	0x45,0x41,0x52,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+	0x73,0x65,0x5f,0x73,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x5f,0x6f,0x70,0x74,0x69,
+	0x6f,0x6e,0x73,0x28,0x69,0x6e,0x74,0x20,0x61,0x72,0x67,0x63,0x2c,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x2a,0x61,0x72,0x67,0x76,0x2c,0x20,0x76,0x6f,0x69,0x64,0x20,
+	0x28,0x2a,0x70,0x72,0x69,0x6e,0x74,0x5f,0x68,0x65,0x6c,0x70,0x29,0x28,0x29,0x2c,
+	0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x76,0x6f,0x69,0x64,0x20,0x28,0x2a,0x70,0x72,
+	0x69,0x6e,0x74,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x29,0x28,0x29,0x29,0x0a,
+	0x7b,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,
+	0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x61,0x72,0x67,0x63,0x3b,0x20,0x2b,0x2b,0x69,
+	0x29,0x20,0x7b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x21,0x73,0x74,0x72,0x63,0x6d,
+	0x70,0x28,0x61,0x72,0x67,0x76,0x5b,0x69,0x5d,0x2c,0x20,0x22,0x2d,0x2d,0x68,0x65,
+	0x6c,0x70,0x22,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x70,0x72,0x69,0x6e,0x74,
+	0x5f,0x68,0x65,0x6c,0x70,0x28,0x29,0x3b,0x0a,0x09,0x09,0x09,0x65,0x78,0x69,0x74,
+	0x28,0x45,0x58,0x49,0x54,0x5f,0x53,0x55,0x43,0x43,0x45,0x53,0x53,0x29,0x3b,0x0a,
+	0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x21,0x73,0x74,
+	0x72,0x63,0x6d,0x70,0x28,0x61,0x72,0x67,0x76,0x5b,0x69,0x5d,0x2c,0x20,0x22,0x2d,
+	0x2d,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x22,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,
+	0x09,0x70,0x72,0x69,0x6e,0x74,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x28,0x29,
+	0x3b,0x0a,0x09,0x09,0x09,0x65,0x78,0x69,0x74,0x28,0x45,0x58,0x49,0x54,0x5f,0x53,
+	0x55,0x43,0x43,0x45,0x53,0x53,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x7d,0x0a,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,
+	0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x70,0x72,0x6f,
+	0x67,0x69,0x6e,0x66,0x6f,0x2e,0x63,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file9[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x70,
+	0x72,0x6f,0x67,0x69,0x6e,0x66,0x6f,0x20,0x2d,0x20,0x50,0x72,0x6f,0x67,0x72,0x61,
+	0x6d,0x20,0x69,0x6e,0x66,0x6f,0x72,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x75,
+	0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2c,0x20,0x6d,0x61,0x63,0x72,0x6f,0x73,0x2c,
+	0x20,0x61,0x6e,0x64,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,
+	0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,
+	0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,
+	0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,
+	0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,
+	0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,
+	0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,
+	0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,
+	0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,
+	0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,
+	0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,
+	0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,
+	0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,
+	0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+	0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+	0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,
+	0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,
+	0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,
+	0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,
+	0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,
+	0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,
+	0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,
+	0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,
+	0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,
+	0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,
+	0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,
+	0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,
+	0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,
+	0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,
+	0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,
+	0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,
+	0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,
+	0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,
+	0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,
+	0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,
+	0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,
+	0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,
+	0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,
+	0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,
+	0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,
+	0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,
+	0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,
+	0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,
+	0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,
+	0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,
+	0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,
+	0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,
+	0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,
+	0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,
+	0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,
+	0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,
+	0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,
+	0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,
+	0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,
+	0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,
+	0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,
+	0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,
+	0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,
+	0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,
+	0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,
+	0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,
+	0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,
+	0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,
+	0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,
+	0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,
+	0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,
+	0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,
+	0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,
+	0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,
+	0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,
+	0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,
+	0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,
+	0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,
+	0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,
+	0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,
+	0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,
+	0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,
+	0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,
+	0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,
+	0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,
+	0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,
+	0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+	0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,
+	0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,
+	0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,
+	0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,
+	0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,
+	0x66,0x6e,0x64,0x65,0x66,0x20,0x70,0x72,0x6f,0x67,0x69,0x6e,0x66,0x6f,0x5f,0x48,
+	0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x70,0x72,0x6f,0x67,0x69,0x6e,0x66,
+	0x6f,0x5f,0x48,0x0a,0x0a,0x65,0x78,0x74,0x65,0x72,0x6e,0x20,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x72,0x6f,0x67,0x5f,0x6e,0x61,0x6d,
+	0x65,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0x20,0x69,
+	0x6e,0x20,0x74,0x68,0x65,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2e,0x63,0x20,
+	0x74,0x68,0x65,0x20,0x62,0x75,0x69,0x6c,0x64,0x20,0x67,0x65,0x6e,0x65,0x72,0x61,
+	0x74,0x65,0x73,0x2c,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x6f,0x6e,0x6c,0x79,0x20,
+	0x63,0x68,0x61,0x6e,0x67,0x65,0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,
+	0x0a,0x20,0x2a,0x20,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x2c,0x20,0x73,0x6f,0x20,0x6e,
+	0x6f,0x74,0x68,0x69,0x6e,0x67,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x73,0x20,0x72,
+	0x65,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x64,0x20,0x66,0x6f,0x72,0x20,0x61,0x20,
+	0x6e,0x65,0x77,0x20,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x2e,0x20,0x2a,0x2f,0x0a,0x65,
+	0x78,0x74,0x65,0x72,0x6e,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x20,
+	0x70,0x72,0x6f,0x67,0x5f,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x3b,0x0a,0x0a,0x76,0x6f,
+	0x69,0x64,0x20,0x73,0x65,0x74,0x5f,0x70,0x72,0x6f,0x67,0x5f,0x6e,0x61,0x6d,0x65,
+	0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x0a,0x76,
+	0x6f,0x69,0x64,0x20,0x65,0x6d,0x69,0x74,0x5f,0x74,0x72,0x79,0x5f,0x68,0x65,0x6c,
+	0x70,0x28,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x65,0x6d,0x69,0x74,0x5f,0x76,
+	0x65,0x72,0x73,0x69,0x6f,0x6e,0x28,0x29,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x70,
+	0x61,0x72,0x73,0x65,0x5f,0x73,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x5f,0x6f,0x70,
+	0x74,0x69,0x6f,0x6e,0x73,0x28,0x69,0x6e,0x74,0x20,0x61,0x72,0x67,0x63,0x2c,0x20,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x61,0x72,0x67,0x76,0x2c,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x28,0x2a,0x70,0x72,0x69,0x6e,0x74,0x5f,0x68,0x65,0x6c,0x70,0x29,0x28,
+	0x29,0x2c,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x76,0x6f,0x69,0x64,0x20,0x28,0x2a,
+	0x70,0x72,0x69,0x6e,0x74,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x29,0x28,0x29,
+	0x29,0x3b,0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x2f,0x2a,0x20,0x65,
+	0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x70,0x72,0x6f,0x67,0x69,
+	0x6e,0x66,0x6f,0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file10[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x73,
+	0x61,0x79,0x20,0x2d,0x20,0x50,0x72,0x6f,0x76,0x69,0x64,0x65,0x73,0x20,0x70,0x72,
+	0x69,0x6e,0x74,0x69,0x6e,0x67,0x20,0x61,0x6e,0x64,0x20,0x73,0x6f,0x6d,0x65,0x20,
+	0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x75,0x74,0x69,0x6c,0x69,0x65,0x73,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x4f,0x4e,0x46,0x49,0x47,0x55,0x52,0x41,
+	0x54,0x49,0x4f,0x4e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,
+	0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x41,0x59,0x5f,0x46,0x50,0x53,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4d,0x61,0x78,0x69,0x6d,
+	0x75,0x6d,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x20,0x6c,0x69,0x6e,0x65,0x20,0x72,
+	0x65,0x64,0x72,0x61,0x77,0x73,0x20,0x70,0x65,0x72,0x20,0x73,0x65,0x63,0x6f,0x6e,
+	0x64,0x20,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x33,0x30,0x29,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,
+	0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,
+	0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,
+	0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,
+	0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,
+	0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,
+	0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,
+	0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,
+	0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,
+	0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,
+	0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,
+	0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,
+	0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,
+	0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+	0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+	0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,
+	0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,
+	0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,
+	0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,
+	0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,
+	0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,
+	0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,
+	0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,
+	0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,
+	0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,
+	0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,
+	0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,
+	0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,
+	0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,
+	0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,
+	0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,
+	0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,
+	0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,
+	0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,
+	0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,
+	0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,
+	0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,
+	0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,
+	0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,
+	0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,
+	0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,
+	0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,
+	0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,
+	0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,
+	0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,
+	0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,
+	0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,
+	0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,
+	0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,
+	0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,
+	0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,
+	0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,
+	0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,
+	0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,
+	0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,
+	0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,
+	0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,
+	0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,
+	0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,
+	0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,
+	0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,
+	0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,
+	0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,
+	0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,
+	0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,
+	0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,
+	0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,
+	0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,
+	0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,
+	0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,
+	0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,
+	0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,
+	0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,
+	0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,
+	0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,
+	0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,
+	0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,
+	0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,
+	0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,
+	0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,
+	0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,
+	0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+	0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,
+	0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,
+	0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,
+	0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,
+	0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x64,
+	0x65,0x66,0x69,0x6e,0x65,0x20,0x5f,0x58,0x4f,0x50,0x45,0x4e,0x5f,0x53,0x4f,0x55,
+	0x52,0x43,0x45,0x20,0x37,0x30,0x30,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x22,0x73,0x61,0x79,0x2e,0x68,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x67,0x6e,0x61,0x6c,0x2e,0x68,0x3e,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x61,0x72,0x67,0x2e,
+	0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,
+	0x62,0x6f,0x6f,0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+	0x20,0x3c,0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
+	0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x79,0x73,
+	0x2f,0x69,0x6f,0x63,0x74,0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+	0x64,0x65,0x20,0x3c,0x74,0x69,0x6d,0x65,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,
+	0x6c,0x75,0x64,0x65,0x20,0x3c,0x75,0x6e,0x69,0x73,0x74,0x64,0x2e,0x68,0x3e,0x0a,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x78,0x6d,0x65,0x6d,0x2e,
+	0x68,0x22,0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x53,0x41,0x59,0x5f,
+	0x46,0x50,0x53,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x41,0x59,0x5f,
+	0x46,0x50,0x53,0x20,0x33,0x30,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x23,
+	0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x41,0x59,0x5f,0x4c,0x49,0x4e,0x45,0x5f,
+	0x4d,0x41,0x58,0x20,0x35,0x31,0x32,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x76,0x6f,0x6c,0x61,0x74,0x69,0x6c,0x65,0x20,0x73,0x69,0x67,0x5f,0x61,0x74,0x6f,
+	0x6d,0x69,0x63,0x5f,0x74,0x20,0x77,0x69,0x6e,0x63,0x68,0x5f,0x70,0x65,0x6e,0x64,
+	0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x69,0x67,0x61,0x63,0x74,0x69,0x6f,0x6e,
+	0x20,0x77,0x69,0x6e,0x63,0x68,0x5f,0x6f,0x6c,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,
+	0x69,0x63,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x77,0x69,0x6e,0x73,0x69,0x7a,
+	0x65,0x20,0x77,0x69,0x6e,0x73,0x7a,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x62,0x6f,0x6f,0x6c,0x20,0x77,0x69,0x6e,0x73,0x7a,0x5f,0x76,0x61,0x6c,0x69,0x64,
+	0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x74,0x72,0x75,0x63,0x74,
+	0x20,0x7b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x64,0x6f,0x6e,0x65,0x3b,
+	0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x3b,0x0a,
+	0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6c,0x61,0x62,
+	0x65,0x6c,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x69,0x6d,0x65,
+	0x73,0x70,0x65,0x63,0x20,0x6c,0x61,0x73,0x74,0x3b,0x0a,0x09,0x62,0x6f,0x6f,0x6c,
+	0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x3b,0x0a,0x7d,0x20,0x70,0x72,0x6f,0x67,0x72,
+	0x65,0x73,0x73,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x73,0x61,0x79,0x5f,0x77,0x69,0x6e,0x63,0x68,0x28,0x69,0x6e,0x74,0x20,
+	0x73,0x69,0x67,0x2c,0x20,0x73,0x69,0x67,0x69,0x6e,0x66,0x6f,0x5f,0x74,0x20,0x2a,
+	0x69,0x6e,0x66,0x6f,0x2c,0x20,0x76,0x6f,0x69,0x64,0x20,0x2a,0x63,0x74,0x78,0x29,
+	0x0a,0x7b,0x0a,0x09,0x77,0x69,0x6e,0x63,0x68,0x5f,0x70,0x65,0x6e,0x64,0x69,0x6e,
+	0x67,0x20,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x77,0x69,0x6e,0x63,
+	0x68,0x5f,0x6f,0x6c,0x64,0x2e,0x73,0x61,0x5f,0x66,0x6c,0x61,0x67,0x73,0x20,0x26,
+	0x20,0x53,0x41,0x5f,0x53,0x49,0x47,0x49,0x4e,0x46,0x4f,0x29,0x0a,0x09,0x09,0x77,
+	0x69,0x6e,0x63,0x68,0x5f,0x6f,0x6c,0x64,0x2e,0x73,0x61,0x5f,0x73,0x69,0x67,0x61,
+	0x63,0x74,0x69,0x6f,0x6e,0x28,0x73,0x69,0x67,0x2c,0x20,0x69,0x6e,0x66,0x6f,0x2c,
+	0x20,0x63,0x74,0x78,0x29,0x3b,0x0a,0x09,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,
+	0x28,0x77,0x69,0x6e,0x63,0x68,0x5f,0x6f,0x6c,0x64,0x2e,0x73,0x61,0x5f,0x68,0x61,
+	0x6e,0x64,0x6c,0x65,0x72,0x20,0x21,0x3d,0x20,0x53,0x49,0x47,0x5f,0x44,0x46,0x4c,
+	0x20,0x26,0x26,0x0a,0x09,0x09,0x20,0x77,0x69,0x6e,0x63,0x68,0x5f,0x6f,0x6c,0x64,
+	0x2e,0x73,0x61,0x5f,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x20,0x21,0x3d,0x20,0x53,
+	0x49,0x47,0x5f,0x49,0x47,0x4e,0x29,0x0a,0x09,0x09,0x77,0x69,0x6e,0x63,0x68,0x5f,
+	0x6f,0x6c,0x64,0x2e,0x73,0x61,0x5f,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x28,0x73,
+	0x69,0x67,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x54,0x68,0x65,0x20,0x77,
+	0x69,0x6e,0x64,0x6f,0x77,0x20,0x73,0x69,0x7a,0x65,0x20,0x69,0x73,0x20,0x6f,0x6e,
+	0x6c,0x79,0x20,0x71,0x75,0x65,0x72,0x69,0x65,0x64,0x20,0x61,0x67,0x61,0x69,0x6e,
+	0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x61,0x20,0x53,0x49,0x47,0x57,0x49,0x4e,0x43,
+	0x48,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x62,0x6f,0x6f,
+	0x6c,0x20,0x73,0x61,0x79,0x5f,0x77,0x69,0x6e,0x73,0x69,0x7a,0x65,0x28,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x77,0x69,0x6e,0x73,0x69,0x7a,0x65,0x20,0x2a,0x77,0x29,
+	0x0a,0x7b,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x62,0x6f,0x6f,0x6c,0x20,
+	0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,
+	0x65,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x69,0x6e,0x73,0x74,0x61,0x6c,
+	0x6c,0x65,0x64,0x29,0x20,0x7b,0x0a,0x09,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+	0x73,0x69,0x67,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x61,0x20,0x3d,0x20,0x7b,
+	0x20,0x30,0x20,0x7d,0x3b,0x0a,0x09,0x09,0x73,0x61,0x2e,0x73,0x61,0x5f,0x73,0x69,
+	0x67,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x61,0x79,0x5f,0x77,0x69,
+	0x6e,0x63,0x68,0x3b,0x0a,0x09,0x09,0x73,0x69,0x67,0x65,0x6d,0x70,0x74,0x79,0x73,
+	0x65,0x74,0x28,0x26,0x73,0x61,0x2e,0x73,0x61,0x5f,0x6d,0x61,0x73,0x6b,0x29,0x3b,
+	0x0a,0x09,0x09,0x73,0x61,0x2e,0x73,0x61,0x5f,0x66,0x6c,0x61,0x67,0x73,0x20,0x3d,
+	0x20,0x53,0x41,0x5f,0x52,0x45,0x53,0x54,0x41,0x52,0x54,0x20,0x7c,0x20,0x53,0x41,
+	0x5f,0x53,0x49,0x47,0x49,0x4e,0x46,0x4f,0x3b,0x0a,0x09,0x09,0x73,0x69,0x67,0x61,
+	0x63,0x74,0x69,0x6f,0x6e,0x28,0x53,0x49,0x47,0x57,0x49,0x4e,0x43,0x48,0x2c,0x20,
+	0x26,0x73,0x61,0x2c,0x20,0x26,0x77,0x69,0x6e,0x63,0x68,0x5f,0x6f,0x6c,0x64,0x29,
+	0x3b,0x0a,0x09,0x09,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x65,0x64,0x20,0x3d,0x20,
+	0x74,0x72,0x75,0x65,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x77,
+	0x69,0x6e,0x63,0x68,0x5f,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x29,0x20,0x7b,0x0a,
+	0x09,0x09,0x77,0x69,0x6e,0x63,0x68,0x5f,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x20,
+	0x3d,0x20,0x30,0x3b,0x0a,0x09,0x09,0x77,0x69,0x6e,0x73,0x7a,0x5f,0x76,0x61,0x6c,
+	0x69,0x64,0x20,0x3d,0x20,0x69,0x6f,0x63,0x74,0x6c,0x28,0x53,0x54,0x44,0x4f,0x55,
+	0x54,0x5f,0x46,0x49,0x4c,0x45,0x4e,0x4f,0x2c,0x20,0x54,0x49,0x4f,0x43,0x47,0x57,
+	0x49,0x4e,0x53,0x5a,0x2c,0x20,0x26,0x77,0x69,0x6e,0x73,0x7a,0x29,0x20,0x3d,0x3d,
+	0x20,0x30,0x20,0x26,0x26,0x0a,0x09,0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x77,
+	0x69,0x6e,0x73,0x7a,0x2e,0x77,0x73,0x5f,0x72,0x6f,0x77,0x20,0x3e,0x20,0x30,0x3b,
+	0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x2a,0x77,0x20,0x3d,0x20,0x77,0x69,0x6e,0x73,0x7a,
+	0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x77,0x69,0x6e,0x73,0x7a,0x5f,
+	0x76,0x61,0x6c,0x69,0x64,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x76,0x6f,0x69,0x64,0x20,0x73,0x61,0x79,0x5f,0x77,0x72,0x69,0x74,0x65,0x28,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x62,0x75,0x66,0x2c,
+	0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x29,0x0a,0x7b,0x0a,0x09,
+	0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6c,0x65,0x6e,0x20,0x3e,0x20,0x30,0x29,0x20,
+	0x7b,0x0a,0x09,0x09,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x20,0x3d,0x20,
+	0x77,0x72,0x69,0x74,0x65,0x28,0x53,0x54,0x44,0x4f,0x55,0x54,0x5f,0x46,0x49,0x4c,
+	0x45,0x4e,0x4f,0x2c,0x20,0x62,0x75,0x66,0x2c,0x20,0x6c,0x65,0x6e,0x29,0x3b,0x0a,
+	0x09,0x09,0x69,0x66,0x20,0x28,0x6e,0x20,0x3c,0x20,0x30,0x29,0x0a,0x09,0x09,0x09,
+	0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,0x09,0x62,0x75,0x66,0x20,0x2b,0x3d,
+	0x20,0x6e,0x3b,0x0a,0x09,0x09,0x6c,0x65,0x6e,0x20,0x2d,0x3d,0x20,0x28,0x73,0x69,
+	0x7a,0x65,0x5f,0x74,0x29,0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,
+	0x20,0x44,0x72,0x61,0x77,0x73,0x20,0x6c,0x65,0x6e,0x20,0x62,0x79,0x74,0x65,0x73,
+	0x20,0x6f,0x66,0x20,0x74,0x65,0x78,0x74,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,
+	0x6c,0x61,0x73,0x74,0x20,0x72,0x6f,0x77,0x2c,0x20,0x6c,0x65,0x61,0x76,0x69,0x6e,
+	0x67,0x20,0x74,0x68,0x65,0x20,0x63,0x75,0x72,0x73,0x6f,0x72,0x20,0x77,0x68,0x65,
+	0x72,0x65,0x20,0x69,0x74,0x20,0x77,0x61,0x73,0x2e,0x0a,0x20,0x2a,0x20,0x54,0x68,
+	0x65,0x20,0x65,0x73,0x63,0x61,0x70,0x65,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,
+	0x65,0x20,0x74,0x65,0x78,0x74,0x20,0x67,0x6f,0x20,0x6f,0x75,0x74,0x20,0x69,0x6e,
+	0x20,0x6f,0x6e,0x65,0x20,0x77,0x72,0x69,0x74,0x65,0x3b,0x20,0x6f,0x6e,0x6c,0x79,
+	0x20,0x74,0x65,0x78,0x74,0x20,0x6c,0x6f,0x6e,0x67,0x65,0x72,0x20,0x74,0x68,0x61,
+	0x6e,0x20,0x61,0x0a,0x20,0x2a,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x20,0x6c,0x69,
+	0x6e,0x65,0x20,0x6e,0x65,0x65,0x64,0x73,0x20,0x61,0x20,0x68,0x65,0x61,0x70,0x20,
+	0x62,0x75,0x66,0x66,0x65,0x72,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,
+	0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x73,0x61,0x79,0x5f,0x73,0x74,0x61,0x74,0x75,
+	0x73,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x77,
+	0x69,0x6e,0x73,0x69,0x7a,0x65,0x20,0x2a,0x77,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x65,0x78,0x74,0x2c,0x20,0x73,0x69,0x7a,
+	0x65,0x5f,0x74,0x20,0x6c,0x65,0x6e,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,
+	0x20,0x73,0x74,0x61,0x63,0x6b,0x5b,0x53,0x41,0x59,0x5f,0x4c,0x49,0x4e,0x45,0x5f,
+	0x4d,0x41,0x58,0x20,0x2b,0x20,0x33,0x32,0x5d,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x62,0x75,0x66,0x20,0x3d,0x20,0x73,0x74,0x61,0x63,0x6b,0x3b,0x0a,0x09,
+	0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x6c,0x65,
+	0x6e,0x20,0x2b,0x20,0x33,0x32,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x6e,0x3b,0x0a,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x73,0x69,0x7a,0x65,0x20,0x3e,0x20,0x73,0x69,0x7a,
+	0x65,0x6f,0x66,0x20,0x73,0x74,0x61,0x63,0x6b,0x29,0x0a,0x09,0x09,0x62,0x75,0x66,
+	0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x69,0x7a,0x65,0x29,
+	0x3b,0x0a,0x09,0x65,0x6c,0x73,0x65,0x0a,0x09,0x09,0x73,0x69,0x7a,0x65,0x20,0x3d,
+	0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x73,0x74,0x61,0x63,0x6b,0x3b,0x0a,0x0a,
+	0x09,0x6e,0x20,0x3d,0x20,0x73,0x6e,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x62,0x75,
+	0x66,0x2c,0x20,0x73,0x69,0x7a,0x65,0x2c,0x20,0x22,0x5c,0x30,0x33,0x33,0x37,0x5c,
+	0x30,0x33,0x33,0x5b,0x25,0x64,0x3b,0x31,0x48,0x5c,0x30,0x33,0x33,0x5b,0x32,0x4b,
+	0x22,0x2c,0x20,0x77,0x2d,0x3e,0x77,0x73,0x5f,0x72,0x6f,0x77,0x29,0x3b,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x6e,0x20,0x3e,0x3d,0x20,0x30,0x20,0x26,0x26,0x20,0x28,0x73,
+	0x69,0x7a,0x65,0x5f,0x74,0x29,0x6e,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x20,0x2b,0x20,
+	0x32,0x20,0x3c,0x20,0x73,0x69,0x7a,0x65,0x29,0x20,0x7b,0x0a,0x09,0x09,0x6d,0x65,
+	0x6d,0x63,0x70,0x79,0x28,0x62,0x75,0x66,0x20,0x2b,0x20,0x6e,0x2c,0x20,0x74,0x65,
+	0x78,0x74,0x2c,0x20,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x09,0x6d,0x65,0x6d,0x63,
+	0x70,0x79,0x28,0x62,0x75,0x66,0x20,0x2b,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,
+	0x29,0x6e,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x2c,0x20,0x22,0x5c,0x30,0x33,0x33,0x38,
+	0x22,0x2c,0x20,0x32,0x29,0x3b,0x0a,0x09,0x09,0x66,0x66,0x6c,0x75,0x73,0x68,0x28,
+	0x73,0x74,0x64,0x6f,0x75,0x74,0x29,0x3b,0x0a,0x09,0x09,0x73,0x61,0x79,0x5f,0x77,
+	0x72,0x69,0x74,0x65,0x28,0x62,0x75,0x66,0x2c,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x29,0x6e,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x32,0x29,0x3b,0x0a,
+	0x09,0x7d,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x62,0x75,0x66,0x20,0x21,0x3d,0x20,
+	0x73,0x74,0x61,0x63,0x6b,0x29,0x0a,0x09,0x09,0x66,0x72,0x65,0x65,0x28,0x62,0x75,
+	0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,
+	0x69,0x64,0x20,0x73,0x61,0x79,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,
+	0x64,0x72,0x61,0x77,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,
+	0x61,0x72,0x20,0x6c,0x69,0x6e,0x65,0x5b,0x53,0x41,0x59,0x5f,0x4c,0x49,0x4e,0x45,
+	0x5f,0x4d,0x41,0x58,0x5d,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x77,
+	0x69,0x6e,0x73,0x69,0x7a,0x65,0x20,0x77,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x20,0x73,0x68,0x6f,0x77,0x6e,0x3b,0x0a,0x09,0x69,0x6e,0x74,0x20,0x6c,0x65,
+	0x6e,0x2c,0x20,0x70,0x65,0x72,0x63,0x65,0x6e,0x74,0x3b,0x0a,0x0a,0x09,0x69,0x66,
+	0x20,0x28,0x21,0x73,0x61,0x79,0x5f,0x77,0x69,0x6e,0x73,0x69,0x7a,0x65,0x28,0x26,
+	0x77,0x29,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x0a,0x09,
+	0x2f,0x2a,0x20,0x41,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x70,0x61,0x73,0x74,0x20,
+	0x74,0x68,0x65,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x69,0x73,0x20,0x73,0x68,0x6f,
+	0x77,0x6e,0x20,0x61,0x73,0x20,0x69,0x74,0x20,0x69,0x73,0x2c,0x20,0x62,0x75,0x74,
+	0x20,0x74,0x68,0x65,0x20,0x62,0x61,0x72,0x20,0x73,0x74,0x6f,0x70,0x73,0x20,0x66,
+	0x75,0x6c,0x6c,0x2e,0x20,0x2a,0x2f,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x70,0x72,
+	0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x74,0x6f,0x74,0x61,0x6c,0x29,0x0a,0x09,0x09,
+	0x70,0x65,0x72,0x63,0x65,0x6e,0x74,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x09,0x65,0x6c,
+	0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,
+	0x64,0x6f,0x6e,0x65,0x20,0x3e,0x3d,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,
+	0x2e,0x74,0x6f,0x74,0x61,0x6c,0x29,0x0a,0x09,0x09,0x70,0x65,0x72,0x63,0x65,0x6e,
+	0x74,0x20,0x3d,0x20,0x31,0x30,0x30,0x3b,0x0a,0x09,0x65,0x6c,0x73,0x65,0x0a,0x09,
+	0x09,0x70,0x65,0x72,0x63,0x65,0x6e,0x74,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,
+	0x28,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x64,0x6f,0x6e,0x65,0x20,0x2a,
+	0x20,0x31,0x30,0x30,0x20,0x2f,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,
+	0x74,0x6f,0x74,0x61,0x6c,0x29,0x3b,0x0a,0x09,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x73,
+	0x6e,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x73,0x69,
+	0x7a,0x65,0x6f,0x66,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x22,0x25,0x73,0x20,0x25,
+	0x7a,0x75,0x2f,0x25,0x7a,0x75,0x20,0x25,0x33,0x64,0x25,0x25,0x20,0x22,0x2c,0x0a,
+	0x09,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,
+	0x73,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x20,0x3f,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,
+	0x73,0x73,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x20,0x3a,0x20,0x22,0x22,0x2c,0x20,0x70,
+	0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x64,0x6f,0x6e,0x65,0x2c,0x0a,0x09,0x09,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,
+	0x74,0x6f,0x74,0x61,0x6c,0x2c,0x20,0x70,0x65,0x72,0x63,0x65,0x6e,0x74,0x29,0x3b,
+	0x0a,0x09,0x69,0x66,0x20,0x28,0x6c,0x65,0x6e,0x20,0x3c,0x20,0x30,0x29,0x0a,0x09,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x0a,0x09,0x69,0x6e,0x74,0x20,0x77,
+	0x69,0x64,0x74,0x68,0x20,0x3d,0x20,0x28,0x77,0x2e,0x77,0x73,0x5f,0x63,0x6f,0x6c,
+	0x20,0x3c,0x20,0x53,0x41,0x59,0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,0x20,
+	0x3f,0x20,0x77,0x2e,0x77,0x73,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x53,0x41,0x59,
+	0x5f,0x4c,0x49,0x4e,0x45,0x5f,0x4d,0x41,0x58,0x20,0x2d,0x20,0x31,0x29,0x20,0x2d,
+	0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x6c,0x65,0x6e,0x20,0x2d,0x20,0x32,0x3b,0x0a,
+	0x09,0x69,0x66,0x20,0x28,0x77,0x69,0x64,0x74,0x68,0x20,0x3e,0x3d,0x20,0x31,0x30,
+	0x20,0x26,0x26,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x6c,0x65,0x6e,0x20,
+	0x2b,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x77,0x69,0x64,0x74,0x68,0x20,
+	0x2b,0x20,0x32,0x20,0x3c,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x6c,0x69,0x6e,
+	0x65,0x29,0x20,0x7b,0x0a,0x09,0x09,0x69,0x6e,0x74,0x20,0x66,0x69,0x6c,0x6c,0x20,
+	0x3d,0x20,0x77,0x69,0x64,0x74,0x68,0x20,0x2a,0x20,0x70,0x65,0x72,0x63,0x65,0x6e,
+	0x74,0x20,0x2f,0x20,0x31,0x30,0x30,0x3b,0x0a,0x09,0x09,0x6c,0x69,0x6e,0x65,0x5b,
+	0x6c,0x65,0x6e,0x2b,0x2b,0x5d,0x20,0x3d,0x20,0x27,0x5b,0x27,0x3b,0x0a,0x09,0x09,
+	0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x6c,0x69,0x6e,0x65,0x20,0x2b,0x20,0x6c,0x65,
+	0x6e,0x2c,0x20,0x27,0x23,0x27,0x2c,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,
+	0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x09,0x09,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,
+	0x6c,0x69,0x6e,0x65,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x20,0x2b,0x20,0x66,0x69,0x6c,
+	0x6c,0x2c,0x20,0x27,0x2e,0x27,0x2c,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,
+	0x28,0x77,0x69,0x64,0x74,0x68,0x20,0x2d,0x20,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,
+	0x0a,0x09,0x09,0x6c,0x65,0x6e,0x20,0x2b,0x3d,0x20,0x77,0x69,0x64,0x74,0x68,0x3b,
+	0x0a,0x09,0x09,0x6c,0x69,0x6e,0x65,0x5b,0x6c,0x65,0x6e,0x2b,0x2b,0x5d,0x20,0x3d,
+	0x20,0x27,0x5d,0x27,0x3b,0x0a,0x09,0x09,0x6c,0x69,0x6e,0x65,0x5b,0x6c,0x65,0x6e,
+	0x5d,0x20,0x3d,0x20,0x27,0x5c,0x30,0x27,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x2f,
+	0x2a,0x20,0x4f,0x6e,0x6c,0x79,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x67,0x72,
+	0x65,0x73,0x73,0x20,0x6c,0x69,0x6e,0x65,0x20,0x69,0x73,0x20,0x63,0x75,0x74,0x20,
+	0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x20,
+	0x77,0x69,0x64,0x74,0x68,0x2e,0x20,0x2a,0x2f,0x0a,0x09,0x73,0x68,0x6f,0x77,0x6e,
+	0x20,0x3d,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,0x6c,0x69,0x6e,0x65,0x29,0x3b,
+	0x0a,0x09,0x73,0x61,0x79,0x5f,0x73,0x74,0x61,0x74,0x75,0x73,0x28,0x26,0x77,0x2c,
+	0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x73,0x68,0x6f,0x77,0x6e,0x20,0x3c,0x20,0x77,
+	0x2e,0x77,0x73,0x5f,0x63,0x6f,0x6c,0x20,0x3f,0x20,0x73,0x68,0x6f,0x77,0x6e,0x20,
+	0x3a,0x20,0x77,0x2e,0x77,0x73,0x5f,0x63,0x6f,0x6c,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x76,0x6f,0x69,0x64,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,0x29,0x0a,0x7b,0x0a,0x09,
+	0x66,0x70,0x75,0x74,0x73,0x28,0x22,0x5c,0x61,0x22,0x2c,0x20,0x73,0x74,0x64,0x65,
+	0x72,0x72,0x29,0x3b,0x0a,0x09,0x66,0x66,0x6c,0x75,0x73,0x68,0x28,0x73,0x74,0x64,
+	0x65,0x72,0x72,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,
+	0x0a,0x0a,0x69,0x6e,0x74,0x20,0x76,0x61,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6d,0x74,0x2c,0x20,
+	0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x29,0x0a,0x7b,0x0a,0x09,0x76,
+	0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x63,0x6f,0x70,0x79,0x3b,0x0a,0x09,0x76,0x61,
+	0x5f,0x63,0x6f,0x70,0x79,0x28,0x63,0x6f,0x70,0x79,0x2c,0x20,0x61,0x70,0x29,0x3b,
+	0x0a,0x09,0x69,0x6e,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x5f,0x77,0x69,0x64,0x74,
+	0x68,0x20,0x3d,0x20,0x76,0x73,0x6e,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x4e,0x55,
+	0x4c,0x4c,0x2c,0x20,0x30,0x2c,0x20,0x66,0x6d,0x74,0x2c,0x20,0x63,0x6f,0x70,0x79,
+	0x29,0x20,0x2b,0x20,0x31,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x63,
+	0x6f,0x70,0x79,0x29,0x3b,0x0a,0x09,0x2a,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,
+	0x20,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x78,0x6d,0x61,0x6c,0x6c,0x6f,0x63,
+	0x28,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x74,0x6f,0x74,0x61,0x6c,0x5f,0x77,
+	0x69,0x64,0x74,0x68,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,
+	0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x2a,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,
+	0x20,0x66,0x6d,0x74,0x2c,0x20,0x61,0x70,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,
+	0x74,0x20,0x61,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x2a,0x62,0x75,0x66,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,
+	0x72,0x20,0x2a,0x66,0x6d,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x0a,0x7b,0x0a,0x09,
+	0x69,0x6e,0x74,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3b,0x0a,0x09,0x76,0x61,0x5f,
+	0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x73,0x74,0x61,
+	0x72,0x74,0x28,0x61,0x70,0x2c,0x20,0x66,0x6d,0x74,0x29,0x3b,0x0a,0x09,0x73,0x74,
+	0x61,0x74,0x75,0x73,0x20,0x3d,0x20,0x76,0x61,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,
+	0x28,0x62,0x75,0x66,0x2c,0x20,0x66,0x6d,0x74,0x2c,0x20,0x61,0x70,0x29,0x3b,0x0a,
+	0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x70,0x29,0x3b,0x0a,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x69,0x6e,0x74,0x20,0x73,0x61,0x79,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x20,0x66,0x6f,0x72,
+	0x6d,0x61,0x74,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x77,0x69,0x6e,0x73,0x69,0x7a,0x65,0x20,0x77,0x3b,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x21,0x73,0x61,0x79,0x5f,0x77,0x69,0x6e,0x73,0x69,0x7a,0x65,
+	0x28,0x26,0x77,0x29,0x29,0x20,0x7b,0x0a,0x09,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,
+	0x74,0x20,0x61,0x72,0x67,0x73,0x3b,0x0a,0x09,0x09,0x76,0x61,0x5f,0x73,0x74,0x61,
+	0x72,0x74,0x28,0x61,0x72,0x67,0x73,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,
+	0x3b,0x0a,0x09,0x09,0x69,0x6e,0x74,0x20,0x72,0x65,0x74,0x20,0x3d,0x20,0x76,0x70,
+	0x72,0x69,0x6e,0x74,0x66,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x61,0x72,
+	0x67,0x73,0x29,0x3b,0x0a,0x09,0x09,0x76,0x61,0x5f,0x65,0x6e,0x64,0x28,0x61,0x72,
+	0x67,0x73,0x29,0x3b,0x0a,0x09,0x09,0x70,0x75,0x74,0x63,0x68,0x61,0x72,0x28,0x27,
+	0x5c,0x6e,0x27,0x29,0x3b,0x0a,0x09,0x09,0x66,0x66,0x6c,0x75,0x73,0x68,0x28,0x73,
+	0x74,0x64,0x6f,0x75,0x74,0x29,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,
+	0x20,0x72,0x65,0x74,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x6c,0x69,0x6e,0x65,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,
+	0x61,0x72,0x67,0x73,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,
+	0x61,0x72,0x67,0x73,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x29,0x3b,0x0a,0x09,
+	0x69,0x6e,0x74,0x20,0x72,0x65,0x74,0x20,0x3d,0x20,0x76,0x61,0x73,0x70,0x72,0x69,
+	0x6e,0x74,0x66,0x28,0x26,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x66,0x6f,0x72,0x6d,0x61,
+	0x74,0x2c,0x20,0x61,0x72,0x67,0x73,0x29,0x3b,0x0a,0x09,0x76,0x61,0x5f,0x65,0x6e,
+	0x64,0x28,0x61,0x72,0x67,0x73,0x29,0x3b,0x0a,0x0a,0x09,0x73,0x61,0x79,0x5f,0x73,
+	0x74,0x61,0x74,0x75,0x73,0x28,0x26,0x77,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,
+	0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,0x6c,0x69,0x6e,0x65,0x29,0x29,0x3b,0x0a,0x09,
+	0x66,0x72,0x65,0x65,0x28,0x6c,0x69,0x6e,0x65,0x29,0x3b,0x0a,0x0a,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+	0x64,0x20,0x73,0x61,0x79,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x28,0x73,
+	0x69,0x7a,0x65,0x5f,0x74,0x20,0x64,0x6f,0x6e,0x65,0x2c,0x20,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x6c,0x61,0x62,0x65,0x6c,0x29,0x0a,0x7b,0x0a,0x09,
+	0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x72,0x65,0x67,0x69,
+	0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,
+	0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x69,0x6d,0x65,0x73,0x70,0x65,0x63,
+	0x20,0x6e,0x6f,0x77,0x3b,0x0a,0x09,0x6c,0x6f,0x6e,0x67,0x20,0x6c,0x6f,0x6e,0x67,
+	0x20,0x65,0x6c,0x61,0x70,0x73,0x65,0x64,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,
+	0x21,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x29,0x0a,0x09,0x09,0x72,
+	0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x3d,0x20,0x61,0x74,0x65,0x78,
+	0x69,0x74,0x28,0x73,0x61,0x79,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,
+	0x65,0x6e,0x64,0x29,0x20,0x3d,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x70,0x72,0x6f,
+	0x67,0x72,0x65,0x73,0x73,0x2e,0x64,0x6f,0x6e,0x65,0x20,0x3d,0x20,0x64,0x6f,0x6e,
+	0x65,0x3b,0x0a,0x09,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x74,0x6f,0x74,
+	0x61,0x6c,0x20,0x3d,0x20,0x74,0x6f,0x74,0x61,0x6c,0x3b,0x0a,0x09,0x70,0x72,0x6f,
+	0x67,0x72,0x65,0x73,0x73,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x20,0x3d,0x20,0x6c,0x61,
+	0x62,0x65,0x6c,0x3b,0x0a,0x09,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x61,
+	0x63,0x74,0x69,0x76,0x65,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x0a,0x09,
+	0x63,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x65,0x74,0x74,0x69,0x6d,0x65,0x28,0x43,0x4c,
+	0x4f,0x43,0x4b,0x5f,0x4d,0x4f,0x4e,0x4f,0x54,0x4f,0x4e,0x49,0x43,0x2c,0x20,0x26,
+	0x6e,0x6f,0x77,0x29,0x3b,0x0a,0x09,0x65,0x6c,0x61,0x70,0x73,0x65,0x64,0x20,0x3d,
+	0x20,0x28,0x6c,0x6f,0x6e,0x67,0x20,0x6c,0x6f,0x6e,0x67,0x29,0x28,0x6e,0x6f,0x77,
+	0x2e,0x74,0x76,0x5f,0x73,0x65,0x63,0x20,0x2d,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,
+	0x73,0x73,0x2e,0x6c,0x61,0x73,0x74,0x2e,0x74,0x76,0x5f,0x73,0x65,0x63,0x29,0x20,
+	0x2a,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x20,0x2b,0x0a,0x09,
+	0x09,0x20,0x20,0x28,0x6e,0x6f,0x77,0x2e,0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,0x20,
+	0x2d,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x6c,0x61,0x73,0x74,0x2e,
+	0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x65,
+	0x6c,0x61,0x70,0x73,0x65,0x64,0x20,0x3c,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x30,0x30,0x30,0x20,0x2f,0x20,0x53,0x41,0x59,0x5f,0x46,0x50,0x53,0x29,0x0a,0x09,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x0a,0x09,0x70,0x72,0x6f,0x67,0x72,
+	0x65,0x73,0x73,0x2e,0x6c,0x61,0x73,0x74,0x20,0x3d,0x20,0x6e,0x6f,0x77,0x3b,0x0a,
+	0x09,0x73,0x61,0x79,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,0x64,0x72,
+	0x61,0x77,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x55,0x70,0x64,0x61,
+	0x74,0x65,0x73,0x20,0x68,0x65,0x6c,0x64,0x20,0x62,0x61,0x63,0x6b,0x20,0x62,0x79,
+	0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x74,0x65,0x20,0x6c,0x69,0x6d,0x69,0x74,0x20,
+	0x61,0x72,0x65,0x20,0x6e,0x65,0x76,0x65,0x72,0x20,0x64,0x72,0x61,0x77,0x6e,0x2c,
+	0x20,0x73,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x6e,0x61,0x6c,0x20,0x63,0x6f,
+	0x75,0x6e,0x74,0x0a,0x20,0x2a,0x20,0x69,0x73,0x20,0x61,0x6c,0x77,0x61,0x79,0x73,
+	0x20,0x70,0x72,0x69,0x6e,0x74,0x65,0x64,0x20,0x68,0x65,0x72,0x65,0x20,0x61,0x73,
+	0x20,0x61,0x6e,0x20,0x6f,0x72,0x64,0x69,0x6e,0x61,0x72,0x79,0x20,0x6c,0x69,0x6e,
+	0x65,0x2e,0x20,0x2a,0x2f,0x0a,0x76,0x6f,0x69,0x64,0x20,0x73,0x61,0x79,0x5f,0x70,
+	0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,0x65,0x6e,0x64,0x28,0x76,0x6f,0x69,0x64,
+	0x29,0x0a,0x7b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x6c,0x61,0x62,0x65,0x6c,0x20,0x3d,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,
+	0x73,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x20,0x3f,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,
+	0x73,0x73,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x20,0x3a,0x20,0x22,0x22,0x3b,0x0a,0x09,
+	0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x77,0x69,0x6e,0x73,0x69,0x7a,0x65,0x20,0x77,
+	0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,
+	0x73,0x2e,0x61,0x63,0x74,0x69,0x76,0x65,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x73,0x61,0x79,0x5f,0x77,0x69,
+	0x6e,0x73,0x69,0x7a,0x65,0x28,0x26,0x77,0x29,0x29,0x0a,0x09,0x09,0x73,0x61,0x79,
+	0x5f,0x73,0x74,0x61,0x74,0x75,0x73,0x28,0x26,0x77,0x2c,0x20,0x22,0x22,0x2c,0x20,
+	0x30,0x29,0x3b,0x0a,0x09,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x73,0x20,
+	0x25,0x7a,0x75,0x2f,0x25,0x7a,0x75,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x61,0x62,0x65,
+	0x6c,0x2c,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x64,0x6f,0x6e,0x65,
+	0x2c,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x2e,0x74,0x6f,0x74,0x61,0x6c,
+	0x29,0x3b,0x0a,0x09,0x66,0x66,0x6c,0x75,0x73,0x68,0x28,0x73,0x74,0x64,0x6f,0x75,
+	0x74,0x29,0x3b,0x0a,0x0a,0x09,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x26,0x70,0x72,
+	0x6f,0x67,0x72,0x65,0x73,0x73,0x2c,0x20,0x30,0x2c,0x20,0x73,0x69,0x7a,0x65,0x6f,
+	0x66,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x5f,0x4e,0x6f,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,0x64,
+	0x69,0x65,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6d,
+	0x73,0x67,0x29,0x0a,0x7b,0x0a,0x09,0x66,0x70,0x75,0x74,0x73,0x28,0x6d,0x73,0x67,
+	0x2c,0x20,0x73,0x74,0x64,0x65,0x72,0x72,0x29,0x3b,0x0a,0x09,0x65,0x78,0x69,0x74,
+	0x28,0x45,0x58,0x49,0x54,0x5f,0x46,0x41,0x49,0x4c,0x55,0x52,0x45,0x29,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,
+	0x65,0x20,0x73,0x61,0x79,0x2e,0x63,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file11[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x73,
+	0x61,0x79,0x20,0x2d,0x20,0x50,0x72,0x6f,0x76,0x69,0x64,0x65,0x73,0x20,0x70,0x72,
+	0x69,0x6e,0x74,0x69,0x6e,0x67,0x20,0x61,0x6e,0x64,0x20,0x73,0x6f,0x6d,0x65,0x20,
+	0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x75,0x74,0x69,0x6c,0x69,0x65,0x73,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x4f,0x4e,0x46,0x49,0x47,0x55,0x52,0x41,
+	0x54,0x49,0x4f,0x4e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,
+	0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x41,0x59,0x5f,0x46,0x50,0x53,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4d,0x61,0x78,0x69,0x6d,
+	0x75,0x6d,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x20,0x6c,0x69,0x6e,0x65,0x20,0x72,
+	0x65,0x64,0x72,0x61,0x77,0x73,0x20,0x70,0x65,0x72,0x20,0x73,0x65,0x63,0x6f,0x6e,
+	0x64,0x20,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x33,0x30,0x29,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,
+	0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,
+	0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,
+	0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,
+	0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,
+	0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,
+	0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,
+	0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,
+	0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,
+	0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,
+	0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,
+	0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,
+	0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,
+	0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+	0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+	0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,
+	0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,
+	0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,
+	0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,
+	0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,
+	0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,
+	0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,
+	0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,
+	0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,
+	0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,
+	0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,
+	0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,
+	0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,
+	0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,
+	0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
+	0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,
+	0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,
+	0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,
+	0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,
+	0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,
+	0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,
+	0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,
+	0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,
+	0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,
+	0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,
+	0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,
+	0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,
+	0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,
+	0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,
+	0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,
+	0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,
+	0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,
+	0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,
+	0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,
+	0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,
+	0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,
+	0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,
+	0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,
+	0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,
+	0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,
+	0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,
+	0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,
+	0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,
+	0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,
+	0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,
+	0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,
+	0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,
+	0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,
+	0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,
+	0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,
+	0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,
+	0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,
+	0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,
+	0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,
+	0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,
+	0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,
+	0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,
+	0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,
+	0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,
+	0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,
+	0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,
+	0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,
+	0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,
+	0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,
+	0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,
+	0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,
+	0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,
+	0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,
+	0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,
+	0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,
+	0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+	0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,
+	0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,
+	0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,
+	0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,
+	0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,
+	0x66,0x6e,0x64,0x65,0x66,0x20,0x53,0x41,0x59,0x5f,0x48,0x0a,0x23,0x64,0x65,0x66,
+	0x69,0x6e,0x65,0x20,0x53,0x41,0x59,0x5f,0x48,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x61,0x72,0x67,0x2e,0x68,0x3e,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x64,0x65,0x66,0x2e,
+	0x68,0x3e,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x61,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,
+	0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x62,0x75,0x66,0x2c,0x20,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6d,0x74,0x2c,0x20,0x2e,0x2e,
+	0x2e,0x29,0x3b,0x0a,0x69,0x6e,0x74,0x20,0x76,0x61,0x73,0x70,0x72,0x69,0x6e,0x74,
+	0x66,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x62,0x75,0x66,0x2c,0x20,0x63,0x6f,
+	0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6d,0x74,0x2c,0x20,0x76,
+	0x61,0x5f,0x6c,0x69,0x73,0x74,0x20,0x61,0x70,0x29,0x3b,0x0a,0x69,0x6e,0x74,0x20,
+	0x73,0x61,0x79,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,
+	0x20,0x2e,0x2e,0x2e,0x29,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x50,0x72,0x6f,0x67,0x72,
+	0x65,0x73,0x73,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x6c,0x61,0x73,0x74,0x20,
+	0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x20,0x72,0x6f,0x77,0x2c,0x20,0x72,0x65,
+	0x64,0x72,0x61,0x77,0x6e,0x20,0x61,0x74,0x20,0x6d,0x6f,0x73,0x74,0x20,0x53,0x41,
+	0x59,0x5f,0x46,0x50,0x53,0x20,0x74,0x69,0x6d,0x65,0x73,0x20,0x61,0x20,0x73,0x65,
+	0x63,0x6f,0x6e,0x64,0x3b,0x0a,0x20,0x2a,0x20,0x6c,0x61,0x62,0x65,0x6c,0x20,0x6d,
+	0x75,0x73,0x74,0x20,0x73,0x74,0x61,0x79,0x20,0x76,0x61,0x6c,0x69,0x64,0x20,0x75,
+	0x6e,0x74,0x69,0x6c,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x78,0x74,0x20,0x63,0x61,
+	0x6c,0x6c,0x2e,0x20,0x73,0x61,0x79,0x5f,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,
+	0x5f,0x65,0x6e,0x64,0x20,0x63,0x6c,0x65,0x61,0x72,0x73,0x20,0x74,0x68,0x65,0x0a,
+	0x20,0x2a,0x20,0x72,0x6f,0x77,0x20,0x61,0x6e,0x64,0x20,0x70,0x72,0x69,0x6e,0x74,
+	0x73,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x6e,0x61,0x6c,0x20,0x63,0x6f,0x75,0x6e,
+	0x74,0x20,0x6f,0x6e,0x63,0x65,0x3b,0x20,0x69,0x74,0x20,0x61,0x6c,0x73,0x6f,0x20,
+	0x72,0x75,0x6e,0x73,0x20,0x61,0x74,0x20,0x65,0x78,0x69,0x74,0x20,0x69,0x66,0x20,
+	0x61,0x20,0x70,0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x0a,0x20,0x2a,0x20,0x6c,0x69,
+	0x6e,0x65,0x20,0x69,0x73,0x20,0x73,0x74,0x69,0x6c,0x6c,0x20,0x6f,0x70,0x65,0x6e,
+	0x2e,0x20,0x2a,0x2f,0x0a,0x76,0x6f,0x69,0x64,0x20,0x73,0x61,0x79,0x5f,0x70,0x72,
+	0x6f,0x67,0x72,0x65,0x73,0x73,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x64,0x6f,
+	0x6e,0x65,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,
+	0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6c,0x61,
+	0x62,0x65,0x6c,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x73,0x61,0x79,0x5f,0x70,
+	0x72,0x6f,0x67,0x72,0x65,0x73,0x73,0x5f,0x65,0x6e,0x64,0x28,0x76,0x6f,0x69,0x64,
+	0x29,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,0x29,
+	0x3b,0x0a,0x0a,0x5f,0x4e,0x6f,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x64,0x69,0x65,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x6d,0x73,0x67,0x29,0x3b,0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,
+	0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,
+	0x73,0x61,0x79,0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file12[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x74,
+	0x65,0x78,0x74,0x63,0x20,0x2d,0x20,0x54,0x65,0x78,0x74,0x20,0x63,0x6f,0x6e,0x74,
+	0x72,0x6f,0x6c,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,
+	0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,
+	0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,
+	0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,
+	0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,
+	0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,
+	0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,
+	0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,
+	0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,
+	0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,
+	0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+	0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,
+	0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,
+	0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,
+	0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+	0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,
+	0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,
+	0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,
+	0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,
+	0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,
+	0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,
+	0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,
+	0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,
+	0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,
+	0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,
+	0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+	0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,
+	0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,
+	0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,
+	0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,
+	0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,
+	0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,
+	0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,
+	0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,
+	0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,
+	0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,
+	0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,
+	0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,
+	0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,
+	0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,
+	0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+	0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,
+	0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,
+	0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+	0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,
+	0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,
+	0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,
+	0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,
+	0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,
+	0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,
+	0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,
+	0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,
+	0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,
+	0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,
+	0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,
+	0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,
+	0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,
+	0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,
+	0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,
+	0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,
+	0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,
+	0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,
+	0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,
+	0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,
+	0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,
+	0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,
+	0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,
+	0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,
+	0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,
+	0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,
+	0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,
+	0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,
+	0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,
+	0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,
+	0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,
+	0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,
+	0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,
+	0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,
+	0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,
+	0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,
+	0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,
+	0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+	0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+	0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,
+	0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,
+	0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,
+	0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,
+	0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,
+	0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,
+	0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,
+	0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,
+	0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,
+	0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,
+	0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,
+	0x2f,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x78,0x6d,0x65,
+	0x6d,0x2e,0x68,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x63,
+	0x74,0x79,0x70,0x65,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+	0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,0x0a,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x74,0x65,0x78,0x74,0x63,0x2e,0x68,0x22,0x0a,
+	0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x74,0x72,0x5f,0x64,0x75,0x70,0x28,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x6e,0x65,0x77,0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,
+	0x74,0x72,0x6c,0x65,0x6e,0x28,0x73,0x29,0x20,0x2b,0x20,0x31,0x29,0x3b,0x0a,0x09,
+	0x73,0x74,0x72,0x63,0x70,0x79,0x28,0x6e,0x65,0x77,0x2c,0x20,0x73,0x29,0x3b,0x0a,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x65,0x77,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x6f,0x73,0x74,0x72,0x75,0x70,0x72,0x28,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x6e,0x65,0x77,0x20,0x3d,0x20,0x73,0x74,0x72,0x5f,0x64,0x75,0x70,0x28,0x73,
+	0x29,0x3b,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,
+	0x20,0x30,0x3b,0x20,0x6e,0x65,0x77,0x5b,0x69,0x5d,0x20,0x21,0x3d,0x20,0x27,0x5c,
+	0x30,0x27,0x3b,0x20,0x2b,0x2b,0x69,0x29,0x0a,0x09,0x09,0x6e,0x65,0x77,0x5b,0x69,
+	0x5d,0x20,0x3d,0x20,0x28,0x63,0x68,0x61,0x72,0x29,0x74,0x6f,0x75,0x70,0x70,0x65,
+	0x72,0x28,0x28,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,
+	0x29,0x6e,0x65,0x77,0x5b,0x69,0x5d,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x6e,0x65,0x77,0x3b,0x0a,0x7d,0x0a,0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x74,0x6f,0x73,0x74,0x72,0x6c,0x77,0x72,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,
+	0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x65,0x77,0x20,0x3d,
+	0x20,0x73,0x74,0x72,0x5f,0x64,0x75,0x70,0x28,0x73,0x29,0x3b,0x0a,0x09,0x66,0x6f,
+	0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x6e,0x65,
+	0x77,0x5b,0x69,0x5d,0x20,0x21,0x3d,0x20,0x27,0x5c,0x30,0x27,0x3b,0x20,0x2b,0x2b,
+	0x69,0x29,0x0a,0x09,0x09,0x6e,0x65,0x77,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x28,0x63,
+	0x68,0x61,0x72,0x29,0x74,0x6f,0x6c,0x6f,0x77,0x65,0x72,0x28,0x28,0x75,0x6e,0x73,
+	0x69,0x67,0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,0x29,0x6e,0x65,0x77,0x5b,0x69,
+	0x5d,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x65,0x77,0x3b,
+	0x0a,0x7d,0x0a,0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x65,0x78,0x74,0x63,0x5f,
+	0x74,0x72,0x69,0x6d,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x0a,0x7b,0x0a,
+	0x09,0x28,0x76,0x6f,0x69,0x64,0x29,0x73,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,
+	0x6e,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x7d,0x0a,0x0a,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x74,0x65,0x78,0x74,0x63,0x5f,0x70,0x61,0x64,0x5f,0x6c,0x65,0x66,0x74,0x28,
+	0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x73,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,0x70,0x61,0x64,0x29,0x0a,0x7b,0x0a,
+	0x09,0x28,0x76,0x6f,0x69,0x64,0x29,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x09,0x28,
+	0x76,0x6f,0x69,0x64,0x29,0x70,0x61,0x64,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3d,0x20,0x78,0x6d,0x61,0x6c,0x6c,0x6f,
+	0x63,0x28,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,0x73,0x29,0x20,0x2b,0x20,0x31,0x29,
+	0x3b,0x0a,0x0a,0x09,0x66,0x72,0x65,0x65,0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,
+	0x3b,0x0a,0x09,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3d,0x20,0x22,0x4e,0x4f,0x54,
+	0x20,0x49,0x4d,0x50,0x4c,0x45,0x4d,0x45,0x4e,0x54,0x45,0x44,0x22,0x3b,0x0a,0x0a,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x3b,0x0a,
+	0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,
+	0x65,0x20,0x74,0x65,0x78,0x74,0x63,0x2e,0x63,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file13[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x74,
+	0x65,0x78,0x74,0x63,0x20,0x2d,0x20,0x54,0x65,0x78,0x74,0x20,0x63,0x6f,0x6e,0x74,
+	0x72,0x6f,0x6c,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,
+	0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,
+	0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,
+	0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,
+	0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,
+	0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,
+	0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,
+	0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,
+	0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,
+	0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,
+	0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+	0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,
+	0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,
+	0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,
+	0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,
+	0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+	0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,
+	0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,
+	0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,
+	0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,
+	0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,
+	0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,
+	0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,
+	0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,
+	0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,
+	0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,
+	0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+	0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,
+	0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,
+	0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,
+	0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,
+	0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,
+	0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,
+	0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,
+	0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,
+	0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,
+	0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,
+	0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,
+	0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,
+	0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,
+	0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,
+	0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,
+	0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+	0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,
+	0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,
+	0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+	0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,
+	0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,
+	0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,
+	0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,
+	0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,
+	0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,
+	0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,
+	0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,
+	0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,
+	0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,
+	0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,
+	0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,
+	0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,
+	0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,
+	0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,
+	0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,
+	0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,
+	0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,
+	0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,
+	0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,
+	0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,
+	0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,
+	0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,
+	0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,
+	0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,
+	0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,
+	0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,
+	0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,
+	0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,
+	0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,
+	0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,
+	0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,
+	0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,
+	0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,
+	0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,
+	0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,
+	0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,
+	0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+	0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+	0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,
+	0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,
+	0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,
+	0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,
+	0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,
+	0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,
+	0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,
+	0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,
+	0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,
+	0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,
+	0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,
+	0x2f,0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x54,0x45,0x58,0x54,0x43,
+	0x5f,0x48,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x54,0x45,0x58,0x54,0x43,
+	0x5f,0x48,0x0a,0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x74,0x72,0x5f,0x64,0x75,
+	0x70,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x3b,0x0a,0x63,0x68,0x61,0x72,
+	0x20,0x2a,0x74,0x6f,0x73,0x74,0x72,0x75,0x70,0x72,0x28,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x73,0x29,0x3b,0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x6f,0x73,0x74,0x72,
+	0x6c,0x77,0x72,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x3b,0x0a,0x0a,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x74,0x65,0x78,0x74,0x63,0x5f,0x74,0x72,0x69,0x6d,0x28,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x3b,0x0a,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x74,0x65,0x78,0x74,0x63,0x5f,0x70,0x61,0x64,0x5f,0x6c,0x65,0x66,0x74,0x28,0x69,
+	0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,
+	0x73,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,0x70,0x61,0x64,0x29,0x3b,0x0a,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x74,0x65,0x78,0x74,0x63,0x5f,0x70,0x61,0x64,0x5f,0x72,0x69,
+	0x67,0x68,0x74,0x28,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x2c,0x20,0x63,
+	0x68,0x61,0x72,0x20,0x2a,0x73,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,0x70,0x61,0x64,
+	0x29,0x3b,0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x2f,0x2a,0x20,0x65,
+	0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x74,0x65,0x78,0x74,0x63,
+	0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file14[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x74,
+	0x72,0x61,0x63,0x65,0x20,0x2d,0x20,0x53,0x70,0x61,0x6e,0x20,0x74,0x72,0x61,0x63,
+	0x69,0x6e,0x67,0x20,0x69,0x6e,0x20,0x43,0x68,0x72,0x6f,0x6d,0x65,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x2d,0x65,0x76,0x65,0x6e,0x74,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,
+	0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x4f,0x4e,0x46,0x49,0x47,0x55,
+	0x52,0x41,0x54,0x49,0x4f,0x4e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,
+	0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x45,0x76,0x65,0x6e,0x74,0x73,0x20,0x6b,0x65,0x70,0x74,
+	0x20,0x70,0x65,0x72,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x2c,0x20,0x61,0x20,0x70,
+	0x6f,0x77,0x65,0x72,0x20,0x6f,0x66,0x20,0x74,0x77,0x6f,0x20,0x28,0x64,0x65,0x66,
+	0x61,0x75,0x6c,0x74,0x20,0x31,0x36,0x33,0x38,0x34,0x29,0x3b,0x20,0x6f,0x6c,0x64,
+	0x65,0x72,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x65,0x76,0x65,0x6e,0x74,0x73,0x20,0x61,0x72,0x65,0x20,0x6f,0x76,0x65,0x72,0x77,
+	0x72,0x69,0x74,0x74,0x65,0x6e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,
+	0x20,0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,
+	0x2d,0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x43,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,
+	0x32,0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,
+	0x75,0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,
+	0x64,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,
+	0x77,0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,
+	0x20,0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,
+	0x20,0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,
+	0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,
+	0x2a,0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,
+	0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,
+	0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,
+	0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,
+	0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,
+	0x2a,0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,
+	0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,
+	0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,
+	0x6c,0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,
+	0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,
+	0x20,0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,
+	0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,
+	0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,
+	0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,
+	0x61,0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,
+	0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,
+	0x74,0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,
+	0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,
+	0x62,0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,
+	0x20,0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,
+	0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,
+	0x65,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,
+	0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,
+	0x20,0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,
+	0x6f,0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,
+	0x69,0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,
+	0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,
+	0x74,0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,
+	0x72,0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,
+	0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,
+	0x48,0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,
+	0x50,0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,
+	0x43,0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,
+	0x53,0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,
+	0x52,0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,
+	0x44,0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,
+	0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+	0x49,0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,
+	0x42,0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,
+	0x54,0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,
+	0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,
+	0x20,0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,
+	0x20,0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,
+	0x20,0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,
+	0x52,0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,
+	0x43,0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,
+	0x56,0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,
+	0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,
+	0x4f,0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,
+	0x42,0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,
+	0x20,0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,
+	0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,
+	0x4c,0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,
+	0x50,0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,
+	0x53,0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,
+	0x45,0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,
+	0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+	0x4f,0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,
+	0x46,0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,
+	0x47,0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,
+	0x53,0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,
+	0x44,0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,
+	0x3b,0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,
+	0x20,0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,
+	0x4f,0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,
+	0x44,0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,
+	0x4f,0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,
+	0x45,0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,
+	0x52,0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,
+	0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,
+	0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,
+	0x47,0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,
+	0x53,0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,
+	0x4e,0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,
+	0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,
+	0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,
+	0x49,0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,
+	0x45,0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,
+	0x20,0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,
+	0x0a,0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x5f,0x47,
+	0x4e,0x55,0x5f,0x53,0x4f,0x55,0x52,0x43,0x45,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x20,0x3c,0x65,0x72,0x72,0x6e,0x6f,0x2e,0x68,0x3e,0x0a,0x23,0x69,
+	0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x66,0x63,0x6e,0x74,0x6c,0x2e,0x68,0x3e,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x67,0x6e,0x61,
+	0x6c,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,
+	0x74,0x64,0x61,0x74,0x6f,0x6d,0x69,0x63,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,
+	0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x62,0x6f,0x6f,0x6c,0x2e,0x68,0x3e,
+	0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6e,
+	0x74,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,
+	0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+	0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x74,0x69,0x6d,0x65,0x2e,0x68,0x3e,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x75,0x6e,0x69,0x73,0x74,0x64,0x2e,
+	0x68,0x3e,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x28,
+	0x5f,0x5f,0x6c,0x69,0x6e,0x75,0x78,0x5f,0x5f,0x29,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+	0x75,0x64,0x65,0x20,0x3c,0x73,0x79,0x73,0x2f,0x73,0x79,0x73,0x63,0x61,0x6c,0x6c,
+	0x2e,0x68,0x3e,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x23,0x69,0x6e,0x63,
+	0x6c,0x75,0x64,0x65,0x20,0x22,0x74,0x72,0x61,0x63,0x65,0x2e,0x68,0x22,0x0a,0x0a,
+	0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,
+	0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+	0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,
+	0x31,0x36,0x33,0x38,0x34,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x23,0x69,
+	0x66,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,
+	0x45,0x20,0x26,0x20,0x28,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,
+	0x53,0x49,0x5a,0x45,0x20,0x2d,0x20,0x31,0x29,0x0a,0x23,0x65,0x72,0x72,0x6f,0x72,
+	0x20,0x22,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,
+	0x45,0x20,0x6d,0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x61,0x20,0x70,0x6f,0x77,0x65,
+	0x72,0x20,0x6f,0x66,0x20,0x74,0x77,0x6f,0x22,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,
+	0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x65,
+	0x76,0x65,0x6e,0x74,0x20,0x7b,0x0a,0x09,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,
+	0x20,0x74,0x73,0x3b,0x20,0x2f,0x2a,0x20,0x43,0x4c,0x4f,0x43,0x4b,0x5f,0x4d,0x4f,
+	0x4e,0x4f,0x54,0x4f,0x4e,0x49,0x43,0x20,0x6e,0x61,0x6e,0x6f,0x73,0x65,0x63,0x6f,
+	0x6e,0x64,0x73,0x20,0x2a,0x2f,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,
+	0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,
+	0x70,0x68,0x61,0x73,0x65,0x3b,0x20,0x2f,0x2a,0x20,0x27,0x42,0x27,0x20,0x6f,0x72,
+	0x20,0x27,0x45,0x27,0x20,0x2a,0x2f,0x0a,0x7d,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x57,
+	0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x79,0x20,0x69,
+	0x74,0x73,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x3b,0x20,0x68,0x65,0x61,0x64,0x20,
+	0x63,0x6f,0x75,0x6e,0x74,0x73,0x20,0x65,0x76,0x65,0x72,0x79,0x20,0x65,0x76,0x65,
+	0x6e,0x74,0x20,0x65,0x76,0x65,0x72,0x20,0x72,0x65,0x63,0x6f,0x72,0x64,0x65,0x64,
+	0x20,0x61,0x6e,0x64,0x20,0x69,0x73,0x0a,0x20,0x2a,0x20,0x70,0x75,0x62,0x6c,0x69,
+	0x73,0x68,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x72,0x65,0x6c,0x65,0x61,0x73,
+	0x65,0x20,0x6f,0x72,0x64,0x65,0x72,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x74,0x68,
+	0x65,0x20,0x65,0x76,0x65,0x6e,0x74,0x20,0x69,0x74,0x20,0x63,0x6f,0x76,0x65,0x72,
+	0x73,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,
+	0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x20,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,
+	0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x6e,0x65,
+	0x78,0x74,0x3b,0x0a,0x09,0x6c,0x6f,0x6e,0x67,0x20,0x74,0x69,0x64,0x3b,0x0a,0x09,
+	0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,0x6e,0x74,0x5f,0x66,0x61,0x73,0x74,
+	0x36,0x34,0x5f,0x74,0x20,0x68,0x65,0x61,0x64,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,
+	0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x65,0x76,0x65,0x6e,0x74,0x20,0x65,
+	0x76,0x65,0x6e,0x74,0x73,0x5b,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,
+	0x5f,0x53,0x49,0x5a,0x45,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+	0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x62,0x75,0x66,0x20,0x7b,0x0a,0x09,
+	0x69,0x6e,0x74,0x20,0x66,0x64,0x3b,0x0a,0x09,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x6c,0x65,0x6e,0x3b,0x0a,0x09,0x63,0x68,0x61,0x72,0x20,0x64,0x61,0x74,0x61,0x5b,
+	0x34,0x30,0x39,0x36,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x2f,0x2a,0x20,0x52,0x69,
+	0x6e,0x67,0x73,0x20,0x61,0x72,0x65,0x20,0x70,0x75,0x73,0x68,0x65,0x64,0x20,0x68,
+	0x65,0x72,0x65,0x20,0x6f,0x6e,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x75,0x73,0x65,
+	0x20,0x61,0x6e,0x64,0x20,0x6e,0x65,0x76,0x65,0x72,0x20,0x66,0x72,0x65,0x65,0x64,
+	0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x65,0x20,0x64,0x75,0x6d,0x70,0x20,0x61,0x6c,
+	0x73,0x6f,0x20,0x73,0x65,0x65,0x73,0x0a,0x20,0x2a,0x20,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x73,0x20,0x74,0x68,0x61,0x74,0x20,0x68,0x61,0x76,0x65,0x20,0x65,0x78,0x69,
+	0x74,0x65,0x64,0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x5f,
+	0x41,0x74,0x6f,0x6d,0x69,0x63,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x29,0x20,0x74,0x72,0x61,0x63,
+	0x65,0x5f,0x72,0x69,0x6e,0x67,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+	0x5f,0x54,0x68,0x72,0x65,0x61,0x64,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x73,0x74,
+	0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x20,
+	0x2a,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x3b,0x0a,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x5f,0x54,0x68,0x72,0x65,0x61,0x64,0x5f,0x6c,0x6f,0x63,0x61,
+	0x6c,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,
+	0x67,0x5f,0x66,0x61,0x69,0x6c,0x65,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x6c,0x61,0x67,0x20,0x74,0x72,0x61,
+	0x63,0x65,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x65,0x64,0x20,0x3d,0x20,0x41,
+	0x54,0x4f,0x4d,0x49,0x43,0x5f,0x46,0x4c,0x41,0x47,0x5f,0x49,0x4e,0x49,0x54,0x3b,
+	0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,
+	0x6c,0x61,0x67,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x64,0x75,0x6d,0x70,0x65,0x64,
+	0x20,0x3d,0x20,0x41,0x54,0x4f,0x4d,0x49,0x43,0x5f,0x46,0x4c,0x41,0x47,0x5f,0x49,
+	0x4e,0x49,0x54,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,
+	0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x74,0x72,0x61,0x63,0x65,0x5f,0x64,0x75,
+	0x6d,0x70,0x5f,0x70,0x61,0x74,0x68,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+	0x20,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,
+	0x6e,0x6f,0x77,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x74,0x69,0x6d,0x65,0x73,0x70,0x65,0x63,0x20,0x74,0x73,0x3b,
+	0x0a,0x0a,0x09,0x63,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x65,0x74,0x74,0x69,0x6d,0x65,
+	0x28,0x43,0x4c,0x4f,0x43,0x4b,0x5f,0x4d,0x4f,0x4e,0x4f,0x54,0x4f,0x4e,0x49,0x43,
+	0x2c,0x20,0x26,0x74,0x73,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x28,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,0x29,0x74,0x73,0x2e,0x74,0x76,0x5f,
+	0x73,0x65,0x63,0x20,0x2a,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x75,0x20,0x2b,0x20,0x28,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,0x29,0x74,0x73,
+	0x2e,0x74,0x76,0x5f,0x6e,0x73,0x65,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+	0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,
+	0x74,0x5f,0x65,0x78,0x69,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,0x0a,0x09,
+	0x69,0x66,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x6c,0x61,0x67,
+	0x5f,0x74,0x65,0x73,0x74,0x5f,0x61,0x6e,0x64,0x5f,0x73,0x65,0x74,0x28,0x26,0x74,
+	0x72,0x61,0x63,0x65,0x5f,0x64,0x75,0x6d,0x70,0x65,0x64,0x29,0x29,0x0a,0x09,0x09,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x64,0x75,0x6d,0x70,0x28,0x74,0x72,0x61,0x63,0x65,
+	0x5f,0x64,0x75,0x6d,0x70,0x5f,0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x72,0x61,0x63,
+	0x65,0x5f,0x6f,0x6e,0x5f,0x73,0x69,0x67,0x6e,0x61,0x6c,0x28,0x69,0x6e,0x74,0x20,
+	0x73,0x69,0x67,0x29,0x0a,0x7b,0x0a,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x74,
+	0x5f,0x65,0x78,0x69,0x74,0x28,0x29,0x3b,0x0a,0x09,0x73,0x69,0x67,0x6e,0x61,0x6c,
+	0x28,0x73,0x69,0x67,0x2c,0x20,0x53,0x49,0x47,0x5f,0x44,0x46,0x4c,0x29,0x3b,0x0a,
+	0x09,0x72,0x61,0x69,0x73,0x65,0x28,0x73,0x69,0x67,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+	0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x72,0x61,0x63,
+	0x65,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,
+	0x7b,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+	0x69,0x6e,0x74,0x20,0x73,0x69,0x67,0x73,0x5b,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x53,
+	0x49,0x47,0x49,0x4e,0x54,0x2c,0x20,0x53,0x49,0x47,0x54,0x45,0x52,0x4d,0x20,0x7d,
+	0x3b,0x0a,0x0a,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x64,0x75,0x6d,0x70,0x5f,0x70,
+	0x61,0x74,0x68,0x20,0x3d,0x20,0x67,0x65,0x74,0x65,0x6e,0x76,0x28,0x22,0x54,0x52,
+	0x41,0x43,0x45,0x5f,0x46,0x49,0x4c,0x45,0x22,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,
+	0x28,0x21,0x74,0x72,0x61,0x63,0x65,0x5f,0x64,0x75,0x6d,0x70,0x5f,0x70,0x61,0x74,
+	0x68,0x20,0x7c,0x7c,0x20,0x21,0x2a,0x74,0x72,0x61,0x63,0x65,0x5f,0x64,0x75,0x6d,
+	0x70,0x5f,0x70,0x61,0x74,0x68,0x29,0x0a,0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,
+	0x64,0x75,0x6d,0x70,0x5f,0x70,0x61,0x74,0x68,0x20,0x3d,0x20,0x22,0x74,0x72,0x61,
+	0x63,0x65,0x2e,0x6a,0x73,0x6f,0x6e,0x22,0x3b,0x0a,0x09,0x61,0x74,0x65,0x78,0x69,
+	0x74,0x28,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x74,0x5f,0x65,0x78,0x69,0x74,0x29,
+	0x3b,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x69,
+	0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,
+	0x20,0x73,0x69,0x67,0x73,0x20,0x2f,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x2a,
+	0x73,0x69,0x67,0x73,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,0x09,0x73,
+	0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x69,0x67,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,
+	0x6f,0x6c,0x64,0x2c,0x20,0x73,0x61,0x20,0x3d,0x20,0x7b,0x20,0x2e,0x73,0x61,0x5f,
+	0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x20,0x3d,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,
+	0x6f,0x6e,0x5f,0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x7d,0x3b,0x0a,0x0a,0x09,0x09,
+	0x73,0x69,0x67,0x65,0x6d,0x70,0x74,0x79,0x73,0x65,0x74,0x28,0x26,0x73,0x61,0x2e,
+	0x73,0x61,0x5f,0x6d,0x61,0x73,0x6b,0x29,0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,
+	0x73,0x69,0x67,0x61,0x63,0x74,0x69,0x6f,0x6e,0x28,0x73,0x69,0x67,0x73,0x5b,0x69,
+	0x5d,0x2c,0x20,0x4e,0x55,0x4c,0x4c,0x2c,0x20,0x26,0x6f,0x6c,0x64,0x29,0x20,0x3d,
+	0x3d,0x20,0x30,0x20,0x26,0x26,0x0a,0x09,0x09,0x20,0x20,0x20,0x20,0x6f,0x6c,0x64,
+	0x2e,0x73,0x61,0x5f,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x20,0x3d,0x3d,0x20,0x53,
+	0x49,0x47,0x5f,0x44,0x46,0x4c,0x29,0x0a,0x09,0x09,0x09,0x73,0x69,0x67,0x61,0x63,
+	0x74,0x69,0x6f,0x6e,0x28,0x73,0x69,0x67,0x73,0x5b,0x69,0x5d,0x2c,0x20,0x26,0x73,
+	0x61,0x2c,0x20,0x4e,0x55,0x4c,0x4c,0x29,0x3b,0x0a,0x09,0x7d,0x0a,0x7d,0x0a,0x0a,
+	0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x74,0x72,0x61,0x63,0x65,0x5f,
+	0x72,0x69,0x6e,0x67,0x5f,0x6e,0x65,0x77,0x28,0x76,0x6f,0x69,0x64,0x29,0x0a,0x7b,
+	0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,
+	0x69,0x6e,0x67,0x20,0x2a,0x72,0x20,0x3d,0x20,0x63,0x61,0x6c,0x6c,0x6f,0x63,0x28,
+	0x31,0x2c,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x2a,0x72,0x29,0x3b,0x0a,0x0a,
+	0x09,0x69,0x66,0x20,0x28,0x21,0x72,0x29,0x20,0x7b,0x0a,0x09,0x09,0x74,0x72,0x61,
+	0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x5f,0x66,0x61,0x69,0x6c,0x65,0x64,0x20,0x3d,
+	0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+	0x4e,0x55,0x4c,0x4c,0x3b,0x0a,0x09,0x7d,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,
+	0x66,0x69,0x6e,0x65,0x64,0x28,0x5f,0x5f,0x6c,0x69,0x6e,0x75,0x78,0x5f,0x5f,0x29,
+	0x0a,0x09,0x72,0x2d,0x3e,0x74,0x69,0x64,0x20,0x3d,0x20,0x73,0x79,0x73,0x63,0x61,
+	0x6c,0x6c,0x28,0x53,0x59,0x53,0x5f,0x67,0x65,0x74,0x74,0x69,0x64,0x29,0x3b,0x0a,
+	0x23,0x65,0x6c,0x73,0x65,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x61,0x74,
+	0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x6e,0x67,0x20,0x6e,0x65,0x78,0x74,0x5f,0x74,
+	0x69,0x64,0x20,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x72,0x2d,0x3e,0x74,0x69,0x64,0x20,
+	0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,0x63,0x68,0x5f,0x61,
+	0x64,0x64,0x28,0x26,0x6e,0x65,0x78,0x74,0x5f,0x74,0x69,0x64,0x2c,0x20,0x31,0x29,
+	0x3b,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x09,0x72,0x2d,0x3e,0x6e,0x65,
+	0x78,0x74,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,
+	0x28,0x26,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x73,0x29,0x3b,0x0a,
+	0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+	0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,0x5f,0x65,0x78,0x63,0x68,0x61,0x6e,0x67,0x65,
+	0x5f,0x77,0x65,0x61,0x6b,0x28,0x26,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,
+	0x67,0x73,0x2c,0x20,0x26,0x72,0x2d,0x3e,0x6e,0x65,0x78,0x74,0x2c,0x20,0x72,0x29,
+	0x29,0x0a,0x09,0x09,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x61,0x74,0x6f,0x6d,
+	0x69,0x63,0x5f,0x66,0x6c,0x61,0x67,0x5f,0x74,0x65,0x73,0x74,0x5f,0x61,0x6e,0x64,
+	0x5f,0x73,0x65,0x74,0x28,0x26,0x74,0x72,0x61,0x63,0x65,0x5f,0x69,0x6e,0x73,0x74,
+	0x61,0x6c,0x6c,0x65,0x64,0x29,0x29,0x0a,0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,
+	0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x28,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x20,0x3d,0x20,
+	0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,
+	0x64,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x28,0x63,
+	0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x2c,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x70,0x68,0x61,0x73,0x65,0x29,0x0a,0x7b,0x0a,0x09,
+	0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,
+	0x67,0x20,0x2a,0x72,0x20,0x3d,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,
+	0x67,0x3b,0x0a,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x72,0x20,0x26,0x26,0x20,0x28,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x69,0x6e,0x67,0x5f,0x66,0x61,0x69,0x6c,0x65,
+	0x64,0x20,0x7c,0x7c,0x20,0x21,0x28,0x72,0x20,0x3d,0x20,0x74,0x72,0x61,0x63,0x65,
+	0x5f,0x72,0x69,0x6e,0x67,0x5f,0x6e,0x65,0x77,0x28,0x29,0x29,0x29,0x29,0x0a,0x09,
+	0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x0a,0x09,0x75,0x69,0x6e,0x74,0x5f,
+	0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x68,0x65,0x61,0x64,0x20,0x3d,0x0a,
+	0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,0x65,0x78,
+	0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x68,0x65,0x61,0x64,0x2c,
+	0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,
+	0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x65,0x76,0x65,0x6e,0x74,0x20,0x2a,0x65,0x20,0x3d,
+	0x20,0x26,0x72,0x2d,0x3e,0x65,0x76,0x65,0x6e,0x74,0x73,0x5b,0x68,0x65,0x61,0x64,
+	0x20,0x26,0x20,0x28,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,
+	0x49,0x5a,0x45,0x20,0x2d,0x20,0x31,0x29,0x5d,0x3b,0x0a,0x09,0x65,0x2d,0x3e,0x74,
+	0x73,0x20,0x3d,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x6e,0x6f,0x77,0x28,0x29,0x3b,
+	0x0a,0x09,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x6e,0x61,0x6d,0x65,
+	0x3b,0x0a,0x09,0x65,0x2d,0x3e,0x70,0x68,0x61,0x73,0x65,0x20,0x3d,0x20,0x70,0x68,
+	0x61,0x73,0x65,0x3b,0x0a,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,
+	0x72,0x65,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,
+	0x68,0x65,0x61,0x64,0x2c,0x20,0x68,0x65,0x61,0x64,0x20,0x2b,0x20,0x31,0x2c,0x20,
+	0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,
+	0x65,0x61,0x73,0x65,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x74,
+	0x72,0x61,0x63,0x65,0x5f,0x62,0x65,0x67,0x69,0x6e,0x28,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x29,0x0a,0x7b,0x0a,0x09,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x28,0x6e,0x61,0x6d,
+	0x65,0x2c,0x20,0x27,0x42,0x27,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+	0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x65,0x6e,0x64,0x28,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,0x65,0x29,0x0a,0x7b,0x0a,0x09,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x72,0x65,0x63,0x6f,0x72,0x64,0x28,0x6e,0x61,0x6d,
+	0x65,0x2c,0x20,0x27,0x45,0x27,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x54,
+	0x68,0x65,0x20,0x64,0x75,0x6d,0x70,0x20,0x72,0x75,0x6e,0x73,0x20,0x66,0x72,0x6f,
+	0x6d,0x20,0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,
+	0x73,0x2c,0x20,0x73,0x6f,0x20,0x69,0x74,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x73,
+	0x20,0x62,0x79,0x20,0x68,0x61,0x6e,0x64,0x20,0x61,0x6e,0x64,0x20,0x6f,0x6e,0x6c,
+	0x79,0x20,0x63,0x61,0x6c,0x6c,0x73,0x0a,0x20,0x2a,0x20,0x6f,0x70,0x65,0x6e,0x2c,
+	0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x61,0x6e,0x64,0x20,0x63,0x6c,0x6f,0x73,0x65,
+	0x2e,0x20,0x2a,0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,
+	0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x62,0x75,0x66,0x20,0x2a,0x62,
+	0x29,0x0a,0x7b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x70,0x20,0x3d,0x20,0x62,0x2d,0x3e,0x64,0x61,0x74,0x61,0x3b,0x0a,0x0a,0x09,
+	0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x3e,0x20,
+	0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x73,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,
+	0x20,0x3d,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x62,0x2d,0x3e,0x66,0x64,0x2c,0x20,
+	0x70,0x2c,0x20,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x29,0x3b,0x0a,0x09,0x09,0x69,0x66,
+	0x20,0x28,0x6e,0x20,0x3c,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x69,0x66,
+	0x20,0x28,0x65,0x72,0x72,0x6e,0x6f,0x20,0x3d,0x3d,0x20,0x45,0x49,0x4e,0x54,0x52,
+	0x29,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,
+	0x09,0x09,0x09,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x09,
+	0x70,0x20,0x2b,0x3d,0x20,0x6e,0x3b,0x0a,0x09,0x09,0x62,0x2d,0x3e,0x6c,0x65,0x6e,
+	0x20,0x2d,0x3d,0x20,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x6e,0x3b,0x0a,0x09,
+	0x7d,0x0a,0x09,0x62,0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x7d,
+	0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,
+	0x72,0x61,0x63,0x65,0x5f,0x62,0x75,0x66,0x20,0x2a,0x62,0x2c,0x20,0x63,0x6f,0x6e,
+	0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x2c,0x20,0x73,0x69,0x7a,0x65,
+	0x5f,0x74,0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x09,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,
+	0x6e,0x20,0x3e,0x20,0x30,0x29,0x20,0x7b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x62,
+	0x2d,0x3e,0x6c,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,
+	0x62,0x2d,0x3e,0x64,0x61,0x74,0x61,0x29,0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,
+	0x65,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x62,0x29,0x3b,0x0a,0x09,0x09,0x73,0x69,
+	0x7a,0x65,0x5f,0x74,0x20,0x6b,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,
+	0x62,0x2d,0x3e,0x64,0x61,0x74,0x61,0x20,0x2d,0x20,0x62,0x2d,0x3e,0x6c,0x65,0x6e,
+	0x3b,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x6b,0x20,0x3e,0x20,0x6e,0x29,0x0a,0x09,
+	0x09,0x09,0x6b,0x20,0x3d,0x20,0x6e,0x3b,0x0a,0x09,0x09,0x6d,0x65,0x6d,0x63,0x70,
+	0x79,0x28,0x62,0x2d,0x3e,0x64,0x61,0x74,0x61,0x20,0x2b,0x20,0x62,0x2d,0x3e,0x6c,
+	0x65,0x6e,0x2c,0x20,0x73,0x2c,0x20,0x6b,0x29,0x3b,0x0a,0x09,0x09,0x62,0x2d,0x3e,
+	0x6c,0x65,0x6e,0x20,0x2b,0x3d,0x20,0x6b,0x3b,0x0a,0x09,0x09,0x73,0x20,0x2b,0x3d,
+	0x20,0x6b,0x3b,0x0a,0x09,0x09,0x6e,0x20,0x2d,0x3d,0x20,0x6b,0x3b,0x0a,0x09,0x7d,
+	0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,0x28,0x73,0x74,0x72,0x75,0x63,
+	0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x62,0x75,0x66,0x20,0x2a,0x62,0x2c,0x20,
+	0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x0a,0x7b,
+	0x0a,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x28,0x62,0x2c,0x20,0x73,
+	0x2c,0x20,0x73,0x74,0x72,0x6c,0x65,0x6e,0x28,0x73,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+	0x0a,0x2f,0x2a,0x20,0x57,0x72,0x69,0x74,0x65,0x73,0x20,0x76,0x20,0x69,0x6e,0x20,
+	0x64,0x65,0x63,0x69,0x6d,0x61,0x6c,0x2c,0x20,0x7a,0x65,0x72,0x6f,0x20,0x70,0x61,
+	0x64,0x64,0x65,0x64,0x20,0x74,0x6f,0x20,0x61,0x74,0x20,0x6c,0x65,0x61,0x73,0x74,
+	0x20,0x77,0x69,0x64,0x74,0x68,0x20,0x64,0x69,0x67,0x69,0x74,0x73,0x2e,0x20,0x2a,
+	0x2f,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x5f,0x75,0x36,0x34,0x28,0x73,0x74,0x72,0x75,
+	0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x62,0x75,0x66,0x20,0x2a,0x62,0x2c,
+	0x20,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,0x20,0x76,0x2c,0x20,0x73,0x69,0x7a,
+	0x65,0x5f,0x74,0x20,0x77,0x69,0x64,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x09,0x63,0x68,
+	0x61,0x72,0x20,0x64,0x69,0x67,0x69,0x74,0x73,0x5b,0x32,0x30,0x5d,0x3b,0x0a,0x09,
+	0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x09,
+	0x64,0x6f,0x20,0x7b,0x0a,0x09,0x09,0x64,0x69,0x67,0x69,0x74,0x73,0x5b,0x73,0x69,
+	0x7a,0x65,0x6f,0x66,0x20,0x64,0x69,0x67,0x69,0x74,0x73,0x20,0x2d,0x20,0x2b,0x2b,
+	0x6e,0x5d,0x20,0x3d,0x20,0x28,0x63,0x68,0x61,0x72,0x29,0x28,0x27,0x30,0x27,0x20,
+	0x2b,0x20,0x76,0x20,0x25,0x20,0x31,0x30,0x29,0x3b,0x0a,0x09,0x09,0x76,0x20,0x2f,
+	0x3d,0x20,0x31,0x30,0x3b,0x0a,0x09,0x7d,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,
+	0x76,0x20,0x7c,0x7c,0x20,0x6e,0x20,0x3c,0x20,0x77,0x69,0x64,0x74,0x68,0x29,0x3b,
+	0x0a,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x28,0x62,0x2c,0x20,0x64,
+	0x69,0x67,0x69,0x74,0x73,0x20,0x2b,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x64,
+	0x69,0x67,0x69,0x74,0x73,0x20,0x2d,0x20,0x6e,0x2c,0x20,0x6e,0x29,0x3b,0x0a,0x7d,
+	0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x5f,0x6a,0x73,0x6f,0x6e,0x28,0x73,0x74,0x72,
+	0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x62,0x75,0x66,0x20,0x2a,0x62,
+	0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,
+	0x0a,0x7b,0x0a,0x09,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x68,0x65,0x78,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x30,
+	0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x61,0x62,0x63,0x64,0x65,0x66,0x22,
+	0x3b,0x0a,0x0a,0x09,0x66,0x6f,0x72,0x20,0x28,0x3b,0x20,0x2a,0x73,0x3b,0x20,0x73,
+	0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,0x09,0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,
+	0x20,0x63,0x68,0x61,0x72,0x20,0x63,0x20,0x3d,0x20,0x28,0x75,0x6e,0x73,0x69,0x67,
+	0x6e,0x65,0x64,0x20,0x63,0x68,0x61,0x72,0x29,0x2a,0x73,0x3b,0x0a,0x0a,0x09,0x09,
+	0x69,0x66,0x20,0x28,0x63,0x20,0x3d,0x3d,0x20,0x27,0x22,0x27,0x20,0x7c,0x7c,0x20,
+	0x63,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x5c,0x27,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,
+	0x63,0x68,0x61,0x72,0x20,0x65,0x73,0x63,0x5b,0x32,0x5d,0x20,0x3d,0x20,0x7b,0x20,
+	0x27,0x5c,0x5c,0x27,0x2c,0x20,0x28,0x63,0x68,0x61,0x72,0x29,0x63,0x20,0x7d,0x3b,
+	0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x28,0x62,0x2c,
+	0x20,0x65,0x73,0x63,0x2c,0x20,0x32,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x20,0x65,0x6c,
+	0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x63,0x20,0x3c,0x20,0x30,0x78,0x32,0x30,0x29,
+	0x20,0x7b,0x0a,0x09,0x09,0x09,0x63,0x68,0x61,0x72,0x20,0x65,0x73,0x63,0x5b,0x36,
+	0x5d,0x20,0x3d,0x20,0x7b,0x20,0x27,0x5c,0x5c,0x27,0x2c,0x20,0x27,0x75,0x27,0x2c,
+	0x20,0x27,0x30,0x27,0x2c,0x20,0x27,0x30,0x27,0x2c,0x20,0x68,0x65,0x78,0x5b,0x63,
+	0x20,0x3e,0x3e,0x20,0x34,0x5d,0x2c,0x0a,0x09,0x09,0x09,0x09,0x09,0x68,0x65,0x78,
+	0x5b,0x63,0x20,0x26,0x20,0x30,0x78,0x66,0x5d,0x20,0x7d,0x3b,0x0a,0x09,0x09,0x09,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x28,0x62,0x2c,0x20,0x65,0x73,0x63,
+	0x2c,0x20,0x36,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,
+	0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x28,0x62,0x2c,
+	0x20,0x73,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x0a,0x09,0x7d,0x0a,0x7d,
+	0x0a,0x0a,0x69,0x6e,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x64,0x75,0x6d,0x70,
+	0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x70,0x61,0x74,
+	0x68,0x29,0x0a,0x7b,0x0a,0x09,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,
+	0x63,0x65,0x5f,0x62,0x75,0x66,0x20,0x62,0x20,0x3d,0x20,0x7b,0x20,0x2e,0x6c,0x65,
+	0x6e,0x20,0x3d,0x20,0x30,0x20,0x7d,0x3b,0x0a,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,
+	0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x65,0x70,0x20,0x3d,0x20,0x22,0x22,0x3b,0x0a,
+	0x09,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,0x20,0x70,0x69,0x64,0x20,0x3d,0x20,
+	0x28,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,0x29,0x67,0x65,0x74,0x70,0x69,0x64,
+	0x28,0x29,0x3b,0x0a,0x0a,0x09,0x62,0x2e,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,0x65,
+	0x6e,0x28,0x70,0x61,0x74,0x68,0x2c,0x20,0x4f,0x5f,0x57,0x52,0x4f,0x4e,0x4c,0x59,
+	0x20,0x7c,0x20,0x4f,0x5f,0x43,0x52,0x45,0x41,0x54,0x20,0x7c,0x20,0x4f,0x5f,0x54,
+	0x52,0x55,0x4e,0x43,0x20,0x7c,0x20,0x4f,0x5f,0x43,0x4c,0x4f,0x45,0x58,0x45,0x43,
+	0x2c,0x20,0x30,0x36,0x36,0x36,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x62,0x2e,
+	0x66,0x64,0x20,0x3d,0x3d,0x20,0x2d,0x31,0x29,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,
+	0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x0a,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,
+	0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,0x22,0x7b,0x5c,0x22,0x74,0x72,0x61,0x63,
+	0x65,0x45,0x76,0x65,0x6e,0x74,0x73,0x5c,0x22,0x3a,0x5b,0x22,0x29,0x3b,0x0a,0x09,
+	0x66,0x6f,0x72,0x20,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,
+	0x65,0x5f,0x72,0x69,0x6e,0x67,0x20,0x2a,0x72,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,
+	0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x28,0x26,0x74,0x72,0x61,0x63,0x65,0x5f,0x72,
+	0x69,0x6e,0x67,0x73,0x29,0x3b,0x20,0x72,0x3b,0x20,0x72,0x20,0x3d,0x20,0x72,0x2d,
+	0x3e,0x6e,0x65,0x78,0x74,0x29,0x20,0x7b,0x0a,0x09,0x09,0x75,0x69,0x6e,0x74,0x5f,
+	0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x68,0x65,0x61,0x64,0x20,0x3d,0x0a,
+	0x09,0x09,0x09,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x6c,0x6f,0x61,0x64,0x5f,0x65,
+	0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x72,0x2d,0x3e,0x68,0x65,0x61,0x64,
+	0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x61,
+	0x63,0x71,0x75,0x69,0x72,0x65,0x29,0x3b,0x0a,0x09,0x09,0x75,0x69,0x6e,0x74,0x5f,
+	0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x3d,
+	0x0a,0x09,0x09,0x09,0x68,0x65,0x61,0x64,0x20,0x3e,0x20,0x54,0x52,0x41,0x43,0x45,
+	0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,0x3f,0x20,0x68,0x65,0x61,
+	0x64,0x20,0x2d,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,
+	0x49,0x5a,0x45,0x20,0x3a,0x20,0x30,0x3b,0x0a,0x0a,0x09,0x09,0x66,0x6f,0x72,0x20,
+	0x28,0x75,0x69,0x6e,0x74,0x5f,0x66,0x61,0x73,0x74,0x36,0x34,0x5f,0x74,0x20,0x69,
+	0x20,0x3d,0x20,0x66,0x69,0x72,0x73,0x74,0x3b,0x20,0x69,0x20,0x3c,0x20,0x68,0x65,
+	0x61,0x64,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x63,0x6f,
+	0x6e,0x73,0x74,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,0x72,0x61,0x63,0x65,
+	0x5f,0x65,0x76,0x65,0x6e,0x74,0x20,0x2a,0x65,0x20,0x3d,0x0a,0x09,0x09,0x09,0x09,
+	0x26,0x72,0x2d,0x3e,0x65,0x76,0x65,0x6e,0x74,0x73,0x5b,0x69,0x20,0x26,0x20,0x28,
+	0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,0x49,0x5a,0x45,0x20,
+	0x2d,0x20,0x31,0x29,0x5d,0x3b,0x0a,0x09,0x09,0x09,0x63,0x68,0x61,0x72,0x20,0x70,
+	0x68,0x61,0x73,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x65,0x2d,0x3e,0x70,0x68,
+	0x61,0x73,0x65,0x2c,0x20,0x27,0x5c,0x30,0x27,0x20,0x7d,0x3b,0x0a,0x0a,0x09,0x09,
+	0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,
+	0x73,0x65,0x70,0x29,0x3b,0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,
+	0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,0x22,0x5c,0x6e,0x7b,0x5c,0x22,0x6e,0x61,
+	0x6d,0x65,0x5c,0x22,0x3a,0x5c,0x22,0x22,0x29,0x3b,0x0a,0x09,0x09,0x09,0x74,0x72,
+	0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x5f,0x6a,0x73,0x6f,0x6e,0x28,0x26,0x62,0x2c,
+	0x20,0x65,0x2d,0x3e,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x09,0x09,0x09,0x74,0x72,
+	0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,0x22,0x5c,0x22,
+	0x2c,0x5c,0x22,0x70,0x68,0x5c,0x22,0x3a,0x5c,0x22,0x22,0x29,0x3b,0x0a,0x09,0x09,
+	0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,
+	0x70,0x68,0x61,0x73,0x65,0x29,0x3b,0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,0x65,
+	0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,0x22,0x5c,0x22,0x2c,0x5c,0x22,
+	0x74,0x73,0x5c,0x22,0x3a,0x22,0x29,0x3b,0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,
+	0x65,0x5f,0x70,0x75,0x74,0x5f,0x75,0x36,0x34,0x28,0x26,0x62,0x2c,0x20,0x65,0x2d,
+	0x3e,0x74,0x73,0x20,0x2f,0x20,0x31,0x30,0x30,0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,
+	0x09,0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,
+	0x2c,0x20,0x22,0x2e,0x22,0x29,0x3b,0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,0x65,
+	0x5f,0x70,0x75,0x74,0x5f,0x75,0x36,0x34,0x28,0x26,0x62,0x2c,0x20,0x65,0x2d,0x3e,
+	0x74,0x73,0x20,0x25,0x20,0x31,0x30,0x30,0x30,0x2c,0x20,0x33,0x29,0x3b,0x0a,0x09,
+	0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,0x2c,
+	0x20,0x22,0x2c,0x5c,0x22,0x70,0x69,0x64,0x5c,0x22,0x3a,0x22,0x29,0x3b,0x0a,0x09,
+	0x09,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x5f,0x75,0x36,0x34,0x28,
+	0x26,0x62,0x2c,0x20,0x70,0x69,0x64,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x09,0x09,0x09,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,0x22,
+	0x2c,0x5c,0x22,0x74,0x69,0x64,0x5c,0x22,0x3a,0x22,0x29,0x3b,0x0a,0x09,0x09,0x09,
+	0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x5f,0x75,0x36,0x34,0x28,0x26,0x62,
+	0x2c,0x20,0x28,0x75,0x69,0x6e,0x74,0x36,0x34,0x5f,0x74,0x29,0x72,0x2d,0x3e,0x74,
+	0x69,0x64,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x09,0x09,0x09,0x74,0x72,0x61,0x63,0x65,
+	0x5f,0x70,0x75,0x74,0x73,0x28,0x26,0x62,0x2c,0x20,0x22,0x7d,0x22,0x29,0x3b,0x0a,
+	0x09,0x09,0x09,0x73,0x65,0x70,0x20,0x3d,0x20,0x22,0x2c,0x22,0x3b,0x0a,0x09,0x09,
+	0x7d,0x0a,0x09,0x7d,0x0a,0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x70,0x75,0x74,0x73,
+	0x28,0x26,0x62,0x2c,0x20,0x22,0x5c,0x6e,0x5d,0x7d,0x5c,0x6e,0x22,0x29,0x3b,0x0a,
+	0x09,0x74,0x72,0x61,0x63,0x65,0x5f,0x66,0x6c,0x75,0x73,0x68,0x28,0x26,0x62,0x29,
+	0x3b,0x0a,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,0x6f,0x73,0x65,
+	0x28,0x62,0x2e,0x66,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x65,0x6e,
+	0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x74,0x72,0x61,0x63,0x65,0x2e,
+	0x63,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file15[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x74,
+	0x72,0x61,0x63,0x65,0x20,0x2d,0x20,0x53,0x70,0x61,0x6e,0x20,0x74,0x72,0x61,0x63,
+	0x69,0x6e,0x67,0x20,0x69,0x6e,0x20,0x43,0x68,0x72,0x6f,0x6d,0x65,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x2d,0x65,0x76,0x65,0x6e,0x74,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,
+	0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x4f,0x4e,0x46,0x49,0x47,0x55,
+	0x52,0x41,0x54,0x49,0x4f,0x4e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x4f,0x4e,
+	0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x6f,
+	0x6d,0x70,0x69,0x6c,0x65,0x20,0x74,0x68,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,
+	0x20,0x6d,0x61,0x63,0x72,0x6f,0x73,0x20,0x69,0x6e,0x3b,0x20,0x77,0x69,0x74,0x68,
+	0x6f,0x75,0x74,0x20,0x69,0x74,0x20,0x74,0x68,0x65,0x79,0x20,0x65,0x78,0x70,0x61,
+	0x6e,0x64,0x20,0x74,0x6f,0x20,0x6e,0x6f,0x74,0x68,0x69,0x6e,0x67,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,0x20,0x74,
+	0x68,0x65,0x69,0x72,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0x20,0x61,
+	0x72,0x65,0x20,0x6e,0x65,0x76,0x65,0x72,0x20,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,
+	0x65,0x64,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,
+	0x69,0x6e,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x52,0x49,0x4e,0x47,0x5f,0x53,
+	0x49,0x5a,0x45,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x45,0x76,0x65,0x6e,0x74,0x73,0x20,0x6b,0x65,0x70,0x74,0x20,0x70,0x65,0x72,
+	0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x2c,0x20,0x61,0x20,0x70,0x6f,0x77,0x65,0x72,
+	0x20,0x6f,0x66,0x20,0x74,0x77,0x6f,0x20,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+	0x20,0x31,0x36,0x33,0x38,0x34,0x29,0x3b,0x20,0x6f,0x6c,0x64,0x65,0x72,0x0a,0x20,
+	0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x76,0x65,0x6e,
+	0x74,0x73,0x20,0x61,0x72,0x65,0x20,0x6f,0x76,0x65,0x72,0x77,0x72,0x69,0x74,0x74,
+	0x65,0x6e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x4c,0x49,
+	0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,0x43,0x6c,0x61,
+	0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x35,0x20,0x47,
+	0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,
+	0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,0x73,0x65,0x20,
+	0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,0x20,0x62,0x69,
+	0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,0x69,0x74,0x68,
+	0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,0x2a,0x20,0x6d,
+	0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x61,0x72,0x65,
+	0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,0x6f,0x76,0x69,
+	0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,
+	0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+	0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,
+	0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,
+	0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x20,0x74,
+	0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,
+	0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x74,0x68,
+	0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,
+	0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+	0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,
+	0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,0x52,0x65,0x64,
+	0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x69,0x6e,0x20,
+	0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x75,0x73,0x74,
+	0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x61,
+	0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6e,
+	0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,
+	0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,
+	0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,0x69,0x6d,0x65,
+	0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+	0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x61,0x6e,0x64,
+	0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,0x65,0x72,0x69,
+	0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x77,0x69,0x74,
+	0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
+	0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,0x4e,0x65,0x69,
+	0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x6f,0x66,
+	0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x68,
+	0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,
+	0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,0x20,0x20,0x20,
+	0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,0x20,0x6d,0x61,
+	0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x65,0x6e,0x64,
+	0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x20,
+	0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,0x76,0x65,0x64,
+	0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,0x68,0x69,0x73,
+	0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,
+	0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,0x69,0x6f,0x72,
+	0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,0x73,
+	0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,0x49,0x53,0x20,
+	0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,
+	0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,
+	0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,0x20,0x41,0x4e,
+	0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x22,
+	0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,0x20,0x41,0x4e,
+	0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,0x49,0x4d,0x50,
+	0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x2c,
+	0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,
+	0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,
+	0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,
+	0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,
+	0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x41,0x4e,0x44,
+	0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,0x41,0x20,0x50,
+	0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,0x50,0x4f,0x53,
+	0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,0x4c,0x41,0x49,
+	0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+	0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,0x50,0x59,0x52,
+	0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,0x52,0x20,0x43,
+	0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,0x45,0x0a,0x20,
+	0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,
+	0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,0x52,0x45,0x43,
+	0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,0x2c,0x20,0x53,
+	0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,0x4c,0x41,0x52,
+	0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,0x45,0x51,0x55,
+	0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x28,
+	0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,0x54,0x20,0x4e,
+	0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,0x2c,0x20,0x50,
+	0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,0x0a,0x20,0x2a,
+	0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,0x4f,0x4f,0x44,
+	0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,0x3b,0x20,0x4c,
+	0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,0x41,0x54,0x41,
+	0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,0x20,0x4f,0x52,
+	0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,0x49,0x4e,0x54,
+	0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,0x57,0x45,0x56,
+	0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,0x20,0x4f,0x4e,
+	0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,0x46,0x20,0x4c,
+	0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,0x45,
+	0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,0x54,
+	0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,
+	0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,0x49,0x4e,0x43,
+	0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,0x45,0x4e,0x43,
+	0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x29,0x0a,
+	0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,0x20,0x41,0x4e,
+	0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,
+	0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,0x53,0x4f,0x46,
+	0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,0x46,0x20,0x41,
+	0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,
+	0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,0x4f,0x46,0x20,
+	0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,0x20,0x2a,0x2f,
+	0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,
+	0x48,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,
+	0x48,0x0a,0x0a,0x2f,0x2a,0x20,0x45,0x61,0x63,0x68,0x20,0x74,0x68,0x72,0x65,0x61,
+	0x64,0x20,0x72,0x65,0x63,0x6f,0x72,0x64,0x73,0x20,0x69,0x6e,0x74,0x6f,0x20,0x69,
+	0x74,0x73,0x20,0x6f,0x77,0x6e,0x20,0x72,0x69,0x6e,0x67,0x2c,0x20,0x73,0x6f,0x20,
+	0x72,0x65,0x63,0x6f,0x72,0x64,0x69,0x6e,0x67,0x20,0x74,0x61,0x6b,0x65,0x73,0x20,
+	0x6e,0x6f,0x20,0x6c,0x6f,0x63,0x6b,0x2e,0x20,0x54,0x68,0x65,0x0a,0x20,0x2a,0x20,
+	0x66,0x69,0x72,0x73,0x74,0x20,0x65,0x76,0x65,0x6e,0x74,0x20,0x69,0x6e,0x73,0x74,
+	0x61,0x6c,0x6c,0x73,0x20,0x61,0x6e,0x20,0x61,0x74,0x65,0x78,0x69,0x74,0x20,0x68,
+	0x61,0x6e,0x64,0x6c,0x65,0x72,0x20,0x61,0x6e,0x64,0x2c,0x20,0x77,0x68,0x65,0x72,
+	0x65,0x20,0x74,0x68,0x65,0x79,0x20,0x61,0x72,0x65,0x20,0x73,0x74,0x69,0x6c,0x6c,
+	0x20,0x61,0x74,0x20,0x74,0x68,0x65,0x69,0x72,0x0a,0x20,0x2a,0x20,0x64,0x65,0x66,
+	0x61,0x75,0x6c,0x74,0x73,0x2c,0x20,0x53,0x49,0x47,0x49,0x4e,0x54,0x20,0x61,0x6e,
+	0x64,0x20,0x53,0x49,0x47,0x54,0x45,0x52,0x4d,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,
+	0x72,0x73,0x20,0x74,0x68,0x61,0x74,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x65,0x76,
+	0x65,0x72,0x79,0x20,0x72,0x69,0x6e,0x67,0x20,0x74,0x6f,0x20,0x24,0x54,0x52,0x41,
+	0x43,0x45,0x5f,0x46,0x49,0x4c,0x45,0x0a,0x20,0x2a,0x20,0x28,0x64,0x65,0x66,0x61,
+	0x75,0x6c,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x2e,0x6a,0x73,0x6f,0x6e,0x29,0x20,
+	0x66,0x6f,0x72,0x20,0x63,0x68,0x72,0x6f,0x6d,0x65,0x3a,0x2f,0x2f,0x74,0x72,0x61,
+	0x63,0x69,0x6e,0x67,0x20,0x6f,0x72,0x20,0x75,0x69,0x2e,0x70,0x65,0x72,0x66,0x65,
+	0x74,0x74,0x6f,0x2e,0x64,0x65,0x76,0x2e,0x20,0x4e,0x61,0x6d,0x65,0x73,0x20,0x6d,
+	0x75,0x73,0x74,0x0a,0x20,0x2a,0x20,0x6f,0x75,0x74,0x6c,0x69,0x76,0x65,0x20,0x74,
+	0x68,0x65,0x20,0x64,0x75,0x6d,0x70,0x3b,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,
+	0x6c,0x69,0x74,0x65,0x72,0x61,0x6c,0x73,0x20,0x64,0x6f,0x2e,0x20,0x2a,0x2f,0x0a,
+	0x76,0x6f,0x69,0x64,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x62,0x65,0x67,0x69,0x6e,
+	0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,0x61,0x6d,
+	0x65,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x65,
+	0x6e,0x64,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6e,
+	0x61,0x6d,0x65,0x29,0x3b,0x0a,0x69,0x6e,0x74,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,
+	0x64,0x75,0x6d,0x70,0x28,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,
+	0x2a,0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x0a,0x23,0x69,0x66,0x20,0x64,0x65,0x66,
+	0x69,0x6e,0x65,0x64,0x28,0x54,0x52,0x41,0x43,0x45,0x5f,0x4f,0x4e,0x29,0x0a,0x23,
+	0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x42,0x45,0x47,
+	0x49,0x4e,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x62,
+	0x65,0x67,0x69,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x29,0x0a,0x23,0x64,0x65,0x66,0x69,
+	0x6e,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x45,0x4e,0x44,0x28,0x6e,0x61,0x6d,
+	0x65,0x29,0x20,0x74,0x72,0x61,0x63,0x65,0x5f,0x65,0x6e,0x64,0x28,0x6e,0x61,0x6d,
+	0x65,0x29,0x0a,0x23,0x65,0x6c,0x73,0x65,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+	0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x42,0x45,0x47,0x49,0x4e,0x28,0x6e,0x61,0x6d,
+	0x65,0x29,0x20,0x28,0x28,0x76,0x6f,0x69,0x64,0x29,0x30,0x29,0x0a,0x23,0x64,0x65,
+	0x66,0x69,0x6e,0x65,0x20,0x54,0x52,0x41,0x43,0x45,0x5f,0x45,0x4e,0x44,0x28,0x6e,
+	0x61,0x6d,0x65,0x29,0x20,0x28,0x28,0x76,0x6f,0x69,0x64,0x29,0x30,0x29,0x0a,0x23,
+	0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,0x2f,
+	0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x74,0x72,
+	0x61,0x63,0x65,0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file16[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x78,
+	0x6d,0x65,0x6d,0x20,0x2d,0x20,0x58,0x70,0x6c,0x6f,0x73,0x69,0x76,0x65,0x20,0x6d,
+	0x65,0x6d,0x6f,0x72,0x79,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,
+	0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,
+	0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,
+	0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,
+	0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,
+	0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,
+	0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,
+	0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,
+	0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,
+	0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+	0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,
+	0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,
+	0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,
+	0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,
+	0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,
+	0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,
+	0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,
+	0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,
+	0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,
+	0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,
+	0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,
+	0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,
+	0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,
+	0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,
+	0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,
+	0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,
+	0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,
+	0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,
+	0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,
+	0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,
+	0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,
+	0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,
+	0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,
+	0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,
+	0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,
+	0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,
+	0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,
+	0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,
+	0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,
+	0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,
+	0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,
+	0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,
+	0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,
+	0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,
+	0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,
+	0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,
+	0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,
+	0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,
+	0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,
+	0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,
+	0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,
+	0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+	0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,
+	0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,
+	0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,
+	0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+	0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,
+	0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,
+	0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,
+	0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,
+	0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,
+	0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,
+	0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,
+	0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,
+	0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,
+	0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,
+	0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,
+	0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,
+	0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,
+	0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,
+	0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,
+	0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,
+	0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,
+	0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,
+	0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,
+	0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,
+	0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,
+	0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,
+	0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,
+	0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,
+	0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,
+	0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,
+	0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,
+	0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,
+	0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,
+	0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,
+	0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,
+	0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,
+	0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,
+	0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,
+	0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,
+	0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,
+	0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,
+	0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+	0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x0a,0x23,0x69,0x6e,
+	0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x65,0x72,0x72,0x2e,0x68,0x22,0x0a,0x0a,0x23,
+	0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x78,0x6d,0x65,0x6d,0x2e,0x68,0x22,
+	0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x2a,0x65,0x6e,0x73,0x75,0x72,0x65,0x5f,0x6e,
+	0x6f,0x6e,0x6e,0x75,0x6c,0x6c,0x28,0x76,0x6f,0x69,0x64,0x20,0x2a,0x70,0x74,0x72,
+	0x29,0x0a,0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x74,0x72,0x20,0x3d,0x3d,0x20,
+	0x4e,0x55,0x4c,0x4c,0x29,0x0a,0x09,0x09,0x66,0x61,0x74,0x61,0x6c,0x66,0x28,0x22,
+	0x6d,0x65,0x6d,0x6f,0x72,0x79,0x20,0x65,0x78,0x68,0x61,0x75,0x73,0x74,0x65,0x64,
+	0x22,0x29,0x3b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x74,0x72,0x3b,
+	0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x2a,0x78,0x6d,0x61,0x6c,0x6c,0x6f,
+	0x63,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,
+	0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,0x6e,0x73,0x75,0x72,0x65,0x5f,
+	0x6e,0x6f,0x6e,0x6e,0x75,0x6c,0x6c,0x28,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,
+	0x69,0x7a,0x65,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x2a,
+	0x78,0x72,0x65,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x76,0x6f,0x69,0x64,0x20,0x2a,0x70,
+	0x74,0x72,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x29,
+	0x0a,0x7b,0x0a,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,0x6e,0x73,0x75,0x72,
+	0x65,0x5f,0x6e,0x6f,0x6e,0x6e,0x75,0x6c,0x6c,0x28,0x72,0x65,0x61,0x6c,0x6c,0x6f,
+	0x63,0x28,0x70,0x74,0x72,0x2c,0x20,0x73,0x69,0x7a,0x65,0x29,0x29,0x3b,0x0a,0x7d,
+	0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x2a,0x78,0x63,0x61,0x6c,0x6c,0x6f,0x63,0x28,
+	0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x6e,0x6d,0x65,0x6d,0x62,0x2c,0x20,0x73,0x69,
+	0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x72,0x65,
+	0x74,0x75,0x72,0x6e,0x20,0x65,0x6e,0x73,0x75,0x72,0x65,0x5f,0x6e,0x6f,0x6e,0x6e,
+	0x75,0x6c,0x6c,0x28,0x63,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x6e,0x6d,0x65,0x6d,0x62,
+	0x2c,0x20,0x73,0x69,0x7a,0x65,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,
+	0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x78,0x6d,0x65,0x6d,
+	0x2e,0x63,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+static const char file17[] = {
+	0x2f,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x67,0x63,0x6b,0x6c,0x69,0x62,0x2e,0x78,
+	0x6d,0x65,0x6d,0x20,0x2d,0x20,0x58,0x70,0x6c,0x6f,0x73,0x69,0x76,0x65,0x20,0x6d,
+	0x65,0x6d,0x6f,0x72,0x79,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,
+	0x20,0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x3a,0x20,0x42,0x53,0x44,0x2d,0x33,0x2d,
+	0x43,0x6c,0x61,0x75,0x73,0x65,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x20,0x20,0x43,
+	0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,
+	0x35,0x20,0x47,0x43,0x4b,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x52,0x65,0x64,0x69,
+	0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6e,0x64,0x20,0x75,
+	0x73,0x65,0x20,0x69,0x6e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x6e,0x64,
+	0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x73,0x2c,0x20,0x77,
+	0x69,0x74,0x68,0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x0a,0x20,
+	0x2a,0x20,0x6d,0x6f,0x64,0x69,0x66,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+	0x61,0x72,0x65,0x20,0x70,0x65,0x72,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x70,0x72,
+	0x6f,0x76,0x69,0x64,0x65,0x64,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,
+	0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,
+	0x69,0x6f,0x6e,0x73,0x20,0x61,0x72,0x65,0x20,0x6d,0x65,0x74,0x3a,0x0a,0x20,0x2a,
+	0x0a,0x20,0x2a,0x20,0x31,0x2e,0x20,0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,
+	0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,
+	0x20,0x63,0x6f,0x64,0x65,0x20,0x6d,0x75,0x73,0x74,0x20,0x72,0x65,0x74,0x61,0x69,
+	0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,
+	0x72,0x69,0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,
+	0x20,0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,
+	0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,
+	0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,
+	0x61,0x69,0x6d,0x65,0x72,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x32,0x2e,0x20,
+	0x52,0x65,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x73,0x20,
+	0x69,0x6e,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,
+	0x75,0x73,0x74,0x20,0x72,0x65,0x70,0x72,0x6f,0x64,0x75,0x63,0x65,0x20,0x74,0x68,
+	0x65,0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x2c,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,
+	0x74,0x68,0x69,0x73,0x20,0x6c,0x69,0x73,0x74,0x20,0x6f,0x66,0x20,0x63,0x6f,0x6e,
+	0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,
+	0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x64,0x69,0x73,0x63,0x6c,0x61,
+	0x69,0x6d,0x65,0x72,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x63,0x75,
+	0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,
+	0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x6f,0x74,0x68,0x65,0x72,0x20,0x6d,0x61,0x74,
+	0x65,0x72,0x69,0x61,0x6c,0x73,0x20,0x70,0x72,0x6f,0x76,0x69,0x64,0x65,0x64,0x20,
+	0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,
+	0x75,0x74,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x33,0x2e,0x20,
+	0x4e,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6e,0x61,0x6d,0x65,
+	0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,0x67,0x68,
+	0x74,0x20,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x6f,0x72,0x20,0x74,0x68,0x65,
+	0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x6f,0x66,0x20,0x69,0x74,0x73,0x0a,0x20,0x2a,
+	0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x6f,0x72,0x73,
+	0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,
+	0x65,0x6e,0x64,0x6f,0x72,0x73,0x65,0x20,0x6f,0x72,0x20,0x70,0x72,0x6f,0x6d,0x6f,
+	0x74,0x65,0x20,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x73,0x20,0x64,0x65,0x72,0x69,
+	0x76,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x0a,0x20,0x2a,0x20,0x20,0x20,0x20,0x74,
+	0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,
+	0x68,0x6f,0x75,0x74,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x20,0x70,0x72,
+	0x69,0x6f,0x72,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,0x70,0x65,0x72,0x6d,
+	0x69,0x73,0x73,0x69,0x6f,0x6e,0x2e,0x0a,0x20,0x2a,0x0a,0x20,0x2a,0x20,0x54,0x48,
+	0x49,0x53,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x20,0x49,0x53,0x20,0x50,
+	0x52,0x4f,0x56,0x49,0x44,0x45,0x44,0x20,0x42,0x59,0x20,0x54,0x48,0x45,0x20,0x43,
+	0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x53,
+	0x20,0x41,0x4e,0x44,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,
+	0x53,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x0a,0x20,0x2a,0x20,0x41,0x4e,0x44,
+	0x20,0x41,0x4e,0x59,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x20,
+	0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,
+	0x45,0x53,0x2c,0x20,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,
+	0x55,0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+	0x4f,0x2c,0x20,0x54,0x48,0x45,0x0a,0x20,0x2a,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,
+	0x44,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,0x49,0x45,0x53,0x20,0x4f,0x46,0x20,
+	0x4d,0x45,0x52,0x43,0x48,0x41,0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,
+	0x41,0x4e,0x44,0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+	0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,0x50,0x55,0x52,
+	0x50,0x4f,0x53,0x45,0x0a,0x20,0x2a,0x20,0x41,0x52,0x45,0x20,0x44,0x49,0x53,0x43,
+	0x4c,0x41,0x49,0x4d,0x45,0x44,0x2e,0x20,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,
+	0x45,0x4e,0x54,0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x20,0x43,0x4f,
+	0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,0x45,0x52,0x20,0x4f,
+	0x52,0x20,0x43,0x4f,0x4e,0x54,0x52,0x49,0x42,0x55,0x54,0x4f,0x52,0x53,0x20,0x42,
+	0x45,0x0a,0x20,0x2a,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,0x20,0x46,0x4f,0x52,0x20,
+	0x41,0x4e,0x59,0x20,0x44,0x49,0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x44,0x49,
+	0x52,0x45,0x43,0x54,0x2c,0x20,0x49,0x4e,0x43,0x49,0x44,0x45,0x4e,0x54,0x41,0x4c,
+	0x2c,0x20,0x53,0x50,0x45,0x43,0x49,0x41,0x4c,0x2c,0x20,0x45,0x58,0x45,0x4d,0x50,
+	0x4c,0x41,0x52,0x59,0x2c,0x20,0x4f,0x52,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x53,
+	0x45,0x51,0x55,0x45,0x4e,0x54,0x49,0x41,0x4c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,
+	0x53,0x20,0x28,0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x2c,0x20,0x42,0x55,
+	0x54,0x20,0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,0x4f,
+	0x2c,0x20,0x50,0x52,0x4f,0x43,0x55,0x52,0x45,0x4d,0x45,0x4e,0x54,0x20,0x4f,0x46,
+	0x0a,0x20,0x2a,0x20,0x53,0x55,0x42,0x53,0x54,0x49,0x54,0x55,0x54,0x45,0x20,0x47,
+	0x4f,0x4f,0x44,0x53,0x20,0x4f,0x52,0x20,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x53,
+	0x3b,0x20,0x4c,0x4f,0x53,0x53,0x20,0x4f,0x46,0x20,0x55,0x53,0x45,0x2c,0x20,0x44,
+	0x41,0x54,0x41,0x2c,0x20,0x4f,0x52,0x20,0x50,0x52,0x4f,0x46,0x49,0x54,0x53,0x3b,
+	0x20,0x4f,0x52,0x20,0x42,0x55,0x53,0x49,0x4e,0x45,0x53,0x53,0x0a,0x20,0x2a,0x20,
+	0x49,0x4e,0x54,0x45,0x52,0x52,0x55,0x50,0x54,0x49,0x4f,0x4e,0x29,0x20,0x48,0x4f,
+	0x57,0x45,0x56,0x45,0x52,0x20,0x43,0x41,0x55,0x53,0x45,0x44,0x20,0x41,0x4e,0x44,
+	0x20,0x4f,0x4e,0x20,0x41,0x4e,0x59,0x20,0x54,0x48,0x45,0x4f,0x52,0x59,0x20,0x4f,
+	0x46,0x20,0x4c,0x49,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,
+	0x54,0x48,0x45,0x52,0x20,0x49,0x4e,0x0a,0x20,0x2a,0x20,0x43,0x4f,0x4e,0x54,0x52,
+	0x41,0x43,0x54,0x2c,0x20,0x53,0x54,0x52,0x49,0x43,0x54,0x20,0x4c,0x49,0x41,0x42,
+	0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x4f,0x52,0x20,0x54,0x4f,0x52,0x54,0x20,0x28,
+	0x49,0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x4e,0x45,0x47,0x4c,0x49,0x47,
+	0x45,0x4e,0x43,0x45,0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x57,0x49,0x53,
+	0x45,0x29,0x0a,0x20,0x2a,0x20,0x41,0x52,0x49,0x53,0x49,0x4e,0x47,0x20,0x49,0x4e,
+	0x20,0x41,0x4e,0x59,0x20,0x57,0x41,0x59,0x20,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,
+	0x54,0x48,0x45,0x20,0x55,0x53,0x45,0x20,0x4f,0x46,0x20,0x54,0x48,0x49,0x53,0x20,
+	0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2c,0x20,0x45,0x56,0x45,0x4e,0x20,0x49,
+	0x46,0x20,0x41,0x44,0x56,0x49,0x53,0x45,0x44,0x20,0x4f,0x46,0x20,0x54,0x48,0x45,
+	0x0a,0x20,0x2a,0x20,0x50,0x4f,0x53,0x53,0x49,0x42,0x49,0x4c,0x49,0x54,0x59,0x20,
+	0x4f,0x46,0x20,0x53,0x55,0x43,0x48,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x2e,0x0a,
+	0x20,0x2a,0x2f,0x0a,0x0a,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x78,0x6d,0x65,
+	0x6d,0x5f,0x48,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x78,0x6d,0x65,0x6d,
+	0x5f,0x48,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,
+	0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x2a,0x78,
+	0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,
+	0x7a,0x65,0x29,0x3b,0x0a,0x76,0x6f,0x69,0x64,0x20,0x2a,0x78,0x72,0x65,0x61,0x6c,
+	0x6c,0x6f,0x63,0x28,0x76,0x6f,0x69,0x64,0x20,0x2a,0x70,0x74,0x72,0x2c,0x20,0x73,
+	0x69,0x7a,0x65,0x5f,0x74,0x20,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x76,0x6f,0x69,
+	0x64,0x20,0x2a,0x78,0x63,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x73,0x69,0x7a,0x65,0x5f,
+	0x74,0x20,0x6e,0x6d,0x65,0x6d,0x62,0x2c,0x20,0x73,0x69,0x7a,0x65,0x5f,0x74,0x20,
+	0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x0a,0x23,0x65,0x6e,0x64,0x69,0x66,0x0a,0x0a,
+	0x2f,0x2a,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x66,0x69,0x6c,0x65,0x20,0x78,
+	0x6d,0x65,0x6d,0x2e,0x68,0x20,0x2a,0x2f,0x0a,
+	0
+};
+
+const struct gcklib_file gcklib_files[] = {
+	{ "err.c", file0, sizeof file0 - 1 },
+	{ "err.h", file1, sizeof file1 - 1 },
+	{ "flag.c", file2, sizeof file2 - 1 },
+	{ "flag.h", file3, sizeof file3 - 1 },
+	{ "fs.c", file4, sizeof file4 - 1 },
+	{ "fs.h", file5, sizeof file5 - 1 },
+	{ "log.c", file6, sizeof file6 - 1 },
+	{ "log.h", file7, sizeof file7 - 1 },
+	{ "proginfo.c", file8, sizeof file8 - 1 },
+	{ "proginfo.h", file9, sizeof file9 - 1 },
+	{ "say.c", file10, sizeof file10 - 1 },
+	{ "say.h", file11, sizeof file11 - 1 },
+	{ "textc.c", file12, sizeof file12 - 1 },
+	{ "textc.h", file13, sizeof file13 - 1 },
+	{ "trace.c", file14, sizeof file14 - 1 },
+	{ "trace.h", file15, sizeof file15 - 1 },
+	{ "xmem.c", file16, sizeof file16 - 1 },
+	{ "xmem.h", file17, sizeof file17 - 1 },
+};
+
+const size_t gcklib_nfiles = sizeof gcklib_files / sizeof *gcklib_files;
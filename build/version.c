@@ -0,0 +1 @@
+const int prog_commit = 60;
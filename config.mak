@@ -0,0 +1,3 @@
+PREFIX=/usr/local
+CFLAGS=-pedantic
+CC=gcc
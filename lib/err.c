@@ -4,6 +4,9 @@
  *   CONFIGURATION
  *       #define NOCOLOR
  *           Force no color when printing
+ *       #define ERR_BUFSIZE
+ *           Size of the per-thread message buffer (default 4096); longer
+ *           messages are truncated
  *
  *
  *   LICENSE: BSD-3-Clause
@@ -37,7 +40,9 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <errno.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -51,6 +56,34 @@
 #define NOTE "\x1B[1;94m"
 #define HINT "\x1B[38;5;166m"
 
+#ifndef ERR_BUFSIZE
+#define ERR_BUFSIZE 4096
+#endif
+
+enum err_level { LEVEL_HINT, LEVEL_NOTE, LEVEL_WARN, LEVEL_ERROR, LEVEL_FATAL };
+
+static const struct {
+	const char *name;
+	const char *color;
+} levels[] = {
+	[LEVEL_HINT] = { "hint", HINT },
+	[LEVEL_NOTE] = { "note", NOTE },
+	[LEVEL_WARN] = { "warning", WARN },
+	[LEVEL_ERROR] = { "error", ERROR },
+	[LEVEL_FATAL] = { "fatal error", ERROR },
+};
+
+struct err_record {
+	char buf[ERR_BUFSIZE];
+	size_t len;
+};
+
+static enum err_format err_format = ERR_TEXT;
+static bool err_batch = false;
+
+/* pending batched records of the calling thread */
+static _Thread_local struct err_record pending;
+
 static bool err_support_color(void)
 {
 #ifdef NOCOLOR
@@ -98,92 +131,215 @@ static bool err_support_color(void)
 #endif
 }
 
-void errorf(const char *format, ...)
+static void err_write(const char *buf, size_t len)
 {
-	va_list args;
-	va_start(args, format);
+	while (len > 0) {
+		ssize_t n = write(STDERR_FILENO, buf, len);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			return;
+		}
+		buf += n;
+		len -= (size_t)n;
+	}
+}
+
+/* Room left for the message, always keeping some for the record trailer. */
+static size_t err_room(const struct err_record *rec)
+{
+	return sizeof rec->buf - 8 - rec->len;
+}
+
+/* Appends at most what fits. */
+static void err_put(struct err_record *rec, const char *s, size_t n)
+{
+	size_t room = err_room(rec);
+	if (n > room)
+		n = room;
+	memcpy(rec->buf + rec->len, s, n);
+	rec->len += n;
+}
+
+static void err_puts(struct err_record *rec, const char *s)
+{
+	err_put(rec, s, strlen(s));
+}
+
+/* Escapes s into a JSON string body. A message too long for the record is
+ * cut before the first escape or UTF-8 sequence that does not fit whole, so
+ * the line stays valid JSON. */
+static void err_put_json(struct err_record *rec, const char *s)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	while (*s) {
+		unsigned char c = (unsigned char)*s;
+		char esc[6] = { '\\', 0 };
+		const char *out = esc;
+		size_t n = 2, skip = 1;
 
-	if (err_support_color()) {
-		fprintf(stderr, "%serror%s: ", ERROR, RESET);
-	} else {
-		fputs("error: ", stderr);
+		switch (c) {
+		case '"':
+		case '\\':
+			esc[1] = (char)c;
+			break;
+		case '\n':
+			esc[1] = 'n';
+			break;
+		case '\t':
+			esc[1] = 't';
+			break;
+		case '\r':
+			esc[1] = 'r';
+			break;
+		default:
+			if (c >= 0x20) {
+				if (c < 0xc0)
+					n = 1;
+				else
+					n = c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4;
+				/* a sequence cut short by vsnprintf */
+				if (memchr(s, '\0', n))
+					return;
+				out = s;
+				skip = n;
+				break;
+			}
+			memcpy(esc + 1, "u00", 3);
+			esc[4] = hex[c >> 4];
+			esc[5] = hex[c & 0xf];
+			n = 6;
+		}
+		if (n > err_room(rec))
+			return;
+		err_put(rec, out, n);
+		s += skip;
 	}
+}
 
-	vfprintf(stderr, format, args);
-	fputc('\n', stderr);
+static void err_format_record(struct err_record *rec, enum err_level level,
+			      const char *msg)
+{
+	rec->len = 0;
 
-	va_end(args);
+	if (err_format == ERR_JSON) {
+		err_puts(rec, "{\"level\":\"");
+		err_puts(rec, levels[level].name);
+		err_puts(rec, "\",\"message\":\"");
+		err_put_json(rec, msg);
+		memcpy(rec->buf + rec->len, "\"}\n", 3);
+		rec->len += 3;
+		return;
+	}
+
+	bool color = err_support_color();
+
+	if (color)
+		err_puts(rec, levels[level].color);
+	err_puts(rec, levels[level].name);
+	if (color && level != LEVEL_HINT)
+		err_puts(rec, RESET);
+	err_puts(rec, ": ");
+	err_puts(rec, msg);
+	if (color && level == LEVEL_HINT)
+		err_puts(rec, RESET);
+	rec->buf[rec->len++] = '\n';
 }
-void fatalf(const char *format, ...)
+
+static void err_emit(enum err_level level, const char *format, va_list ap)
 {
-	va_list args;
-	va_start(args, format);
+	char msg[ERR_BUFSIZE];
+	struct err_record rec;
+
+	vsnprintf(msg, sizeof msg, format, ap);
+	err_format_record(&rec, level, msg);
+
+	if (level == LEVEL_FATAL && err_format == ERR_TEXT) {
+		static const char terminated[] = "program terminated.\n";
+		if (rec.len + sizeof terminated - 1 <= sizeof rec.buf) {
+			memcpy(rec.buf + rec.len, terminated,
+			       sizeof terminated - 1);
+			rec.len += sizeof terminated - 1;
+		}
+	}
+
+	if (pending.len + rec.len > sizeof pending.buf)
+		err_flush();
 
-	if (err_support_color()) {
-		fprintf(stderr, "%sfatal error%s: ", ERROR, RESET);
-	} else {
-		fputs("fatal error: ", stderr);
+	if (pending.len == 0 && !(err_batch && level < LEVEL_ERROR)) {
+		err_write(rec.buf, rec.len);
+		return;
 	}
 
-	vfprintf(stderr, format, args);
-	fputc('\n', stderr);
+	memcpy(pending.buf + pending.len, rec.buf, rec.len);
+	pending.len += rec.len;
 
+	if (!err_batch || level >= LEVEL_ERROR)
+		err_flush();
+}
+
+void err_set_format(enum err_format format)
+{
+	err_format = format;
+}
+
+void err_set_batch(bool batch)
+{
+	static bool registered = false;
+
+	if (batch && !registered) {
+		atexit(err_flush);
+		registered = true;
+	}
+	if (!batch)
+		err_flush();
+	err_batch = batch;
+}
+
+void err_flush(void)
+{
+	if (pending.len == 0)
+		return;
+	err_write(pending.buf, pending.len);
+	pending.len = 0;
+}
+
+void errorf(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	err_emit(LEVEL_ERROR, format, args);
+	va_end(args);
+}
+void fatalf(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	err_emit(LEVEL_FATAL, format, args);
 	va_end(args);
 
-	fputs("program terminated.\n", stderr);
 	exit(EXIT_FAILURE);
 }
 void warnf(const char *format, ...)
 {
 	va_list args;
 	va_start(args, format);
-
-	if (err_support_color()) {
-		fprintf(stderr, "%swarning%s: ", WARN, RESET);
-	} else {
-		fputs("warning: ", stderr);
-	}
-
-	vfprintf(stderr, format, args);
-	fputc('\n', stderr);
-
+	err_emit(LEVEL_WARN, format, args);
 	va_end(args);
 }
 void notef(const char *format, ...)
 {
 	va_list args;
 	va_start(args, format);
-
-	if (err_support_color()) {
-		fprintf(stderr, "%snote%s: ", NOTE, RESET);
-	} else {
-		fputs("note: ", stderr);
-	}
-
-	vfprintf(stderr, format, args);
-	fputc('\n', stderr);
-
+	err_emit(LEVEL_NOTE, format, args);
 	va_end(args);
 }
 void hintf(const char *format, ...)
 {
 	va_list args;
 	va_start(args, format);
-
-	if (err_support_color()) {
-		fprintf(stderr, "%shint: ", HINT);
-	} else {
-		fputs("hint: ", stderr);
-	}
-
-	vfprintf(stderr, format, args);
-
-	if (err_support_color()) {
-		fprintf(stderr, "%s\n", RESET);
-	} else {
-		fputc('\n', stderr);
-	}
-
+	err_emit(LEVEL_HINT, format, args);
 	va_end(args);
 }
 
@@ -4,6 +4,9 @@
  *   CONFIGURATION
  *       #define NOCOLOR
  *           Force no color when printing
+ *       #define ERR_BUFSIZE
+ *           Size of the per-thread message buffer (default 4096); longer
+ *           messages are truncated
  *       #define SHOW_TRACE
  *           Add debug traces to error printing
  *
@@ -42,6 +45,19 @@
 #ifndef ERR_H
 #define ERR_H
 
+#include <stdbool.h>
+
+enum err_format { ERR_TEXT, ERR_JSON };
+
+/* Each message is formatted whole and emitted with a single write(2).
+ * ERR_JSON emits one {"level":...,"message":...} object per line. With
+ * batching on, hints, notes and warnings are held in a per-thread buffer
+ * until it fills, an error is reported or err_flush is called; threads
+ * other than the main one must call err_flush before they exit. */
+void err_set_format(enum err_format format);
+void err_set_batch(bool batch);
+void err_flush(void);
+
 void errorf(const char *format, ...);
 _Noreturn void fatalf(const char *format, ...);
 void notef(const char *format, ...);
@@ -39,14 +39,26 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define _GNU_SOURCE
+
+#include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <stdarg.h>
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
 #include "fs.h"
 
 #include "err.h"
@@ -62,6 +74,56 @@
 #define RETURN(code) fatalfa(code)
 #endif
 
+#define FS_WALK_BUFSIZE 32768
+
+/* A directory descriptor shared by the queued jobs for its subdirectories;
+ * the last one to open its subdirectory closes it. */
+struct fs_walk_parent {
+	int fd;
+	atomic_int refs;
+};
+
+struct fs_walk_job {
+	struct fs_walk_job *next;
+	struct fs_walk_parent *parent; /* NULL for the root */
+	int depth;
+	size_t name; /* offset of the final component in path */
+	char path[];
+};
+
+struct fs_walker {
+	fs_walk_fn fn;
+	void *data;
+	bool parallel;
+	atomic_bool stop;
+	atomic_int error;
+
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	struct fs_walk_job *jobs;
+	size_t busy;
+};
+
+struct fs_walk_state {
+	struct fs_walker *w;
+	struct fs_walk_parent *parent; /* directory being read, parallel only */
+	char *path;
+	size_t len;
+	size_t cap;
+};
+
+#if defined(__linux__)
+struct fs_dirent64 {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+};
+#endif
+
+static int fs_mode_type(mode_t mode);
+
 char *fs_read(const char *path)
 {
 	FILE *fptr = fopen(path, "r");
@@ -100,18 +162,87 @@ char *fs_read(const char *path)
 
 bool fs_exists(const char *path)
 {
-	FILE *fptr;
-	bool exists;
+	return faccessat(AT_FDCWD, path, F_OK, 0) == 0;
+}
 
-	fptr = fopen(path, "r");
-	if (fptr) {
-		exists = true;
-	} else {
-		exists = false;
+static void fs_stat_fallback(const char *path, unsigned int want,
+			     struct fs_stat *out)
+{
+	struct stat sb;
+
+	if (fstatat(AT_FDCWD, path, &sb, AT_SYMLINK_NOFOLLOW) == -1) {
+		out->error = errno;
+		return;
 	}
+	if (want & FS_STAT_TYPE)
+		out->type = fs_mode_type(sb.st_mode);
+	if (want & FS_STAT_MODE)
+		out->mode = sb.st_mode & 07777;
+	if (want & FS_STAT_SIZE)
+		out->size = sb.st_size;
+	if (want & FS_STAT_MTIME)
+		out->mtime = sb.st_mtim;
+}
 
-	fclose(fptr);
-	return exists;
+#if defined(STATX_TYPE)
+static unsigned int fs_statx_mask(unsigned int want)
+{
+	unsigned int mask = 0;
+
+	if (want & FS_STAT_TYPE)
+		mask |= STATX_TYPE;
+	if (want & FS_STAT_MODE)
+		mask |= STATX_MODE;
+	if (want & FS_STAT_SIZE)
+		mask |= STATX_SIZE;
+	if (want & FS_STAT_MTIME)
+		mask |= STATX_MTIME;
+	return mask;
+}
+#endif
+
+size_t fs_stat_many(const char *const *paths, size_t n, unsigned int want,
+		    struct fs_stat *out)
+{
+	size_t found = 0;
+#if defined(STATX_TYPE)
+	static bool no_statx = false;
+	unsigned int mask = fs_statx_mask(want);
+	struct statx stx;
+#endif
+
+	for (size_t i = 0; i < n; i++) {
+		memset(&out[i], 0, sizeof out[i]);
+#if defined(STATX_TYPE)
+		if (!no_statx &&
+		    statx(AT_FDCWD, paths[i],
+			  AT_SYMLINK_NOFOLLOW | AT_STATX_DONT_SYNC, mask,
+			  &stx) == 0) {
+			if (want & FS_STAT_TYPE)
+				out[i].type = fs_mode_type(stx.stx_mode);
+			if (want & FS_STAT_MODE)
+				out[i].mode = stx.stx_mode & 07777;
+			if (want & FS_STAT_SIZE)
+				out[i].size = (off_t)stx.stx_size;
+			if (want & FS_STAT_MTIME) {
+				out[i].mtime.tv_sec = stx.stx_mtime.tv_sec;
+				out[i].mtime.tv_nsec = stx.stx_mtime.tv_nsec;
+			}
+			found++;
+			continue;
+		}
+		if (!no_statx && errno != ENOSYS) {
+			out[i].error = errno;
+			continue;
+		}
+		no_statx = true;
+#endif
+		fs_stat_fallback(paths[i], want, &out[i]);
+		if (!out[i].error)
+			found++;
+	}
+
+	return found;
 }
 
 int fs_append(const char *path, const char *format, ...)
@@ -192,6 +323,85 @@ int fs_write(const char *path, const char *format, ...)
 	return ret;
 }
 
+static int fs_copy_rw(int in, int out)
+{
+	char buf[FS_WALK_BUFSIZE];
+	ssize_t n;
+
+	while ((n = read(in, buf, sizeof buf)) != 0) {
+		if (n == -1) {
+			if (errno == EINTR)
+				continue;
+			return -1;
+		}
+		for (ssize_t off = 0; off < n;) {
+			ssize_t w = write(out, buf + off, (size_t)(n - off));
+			if (w == -1) {
+				if (errno == EINTR)
+					continue;
+				return -1;
+			}
+			off += w;
+		}
+	}
+
+	return 0;
+}
+
+int fs_copy(const char *from, const char *to)
+{
+	struct stat st;
+	int in, out = -1;
+
+	in = open(from, O_RDONLY | O_CLOEXEC);
+	if (in == -1 || fstat(in, &st) == -1)
+		goto fail;
+
+	out = open(to, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+		   st.st_mode & 07777);
+	if (out == -1)
+		goto fail;
+
+#if defined(FICLONE)
+	if (ioctl(out, FICLONE, in) == 0)
+		goto done;
+#endif
+
+#if defined(__linux__)
+	/* Stops short on file systems or kernels that cannot copy between
+	 * these two files; whatever is left goes through read/write. */
+	for (off_t left = st.st_size; left > 0;) {
+		ssize_t n = copy_file_range(in, NULL, out, NULL, (size_t)left,
+					    0);
+		if (n <= 0)
+			break;
+		left -= n;
+	}
+#endif
+
+	if (fs_copy_rw(in, out) == -1)
+		goto fail;
+
+done:
+	close(in);
+	if (close(out) == -1) {
+		out = -1;
+		in = -1;
+		goto fail;
+	}
+	return 0;
+
+fail: {
+	int code = errno;
+	if (in != -1)
+		close(in);
+	if (out != -1)
+		close(out);
+	errno = code;
+	RETURN(errno);
+}
+}
+
 FILE *fs_temp()
 {
 	FILE *fptr = tmpfile();
@@ -208,4 +418,517 @@ FILE *fs_temp()
 	return fptr;
 }
 
+static char *fs_strndup(const char *s, size_t n)
+{
+	size_t len = strnlen(s, n);
+	char *dup = xmalloc(len + 1);
+
+	memcpy(dup, s, len);
+	dup[len] = '\0';
+	return dup;
+}
+
+#define FS_ATOMIC_TRIES 100
+
+/* Writes a fresh ".name.XXXXXX" into tmp, which holds strlen(name) + 16. */
+static void fs_atomic_tmpname(const char *name, char *tmp, size_t size)
+{
+	static atomic_uint counter;
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	unsigned int salt = (unsigned int)ts.tv_nsec ^
+			    (unsigned int)getpid() << 16 ^
+			    atomic_fetch_add(&counter, 1);
+	snprintf(tmp, size, ".%s.%06x", name, salt & 0xffffff);
+}
+
+/* Creates "dir/.name.XXXXXX" exclusively, filling in a unique suffix. */
+static int fs_atomic_mktemp(int dirfd, const char *name, mode_t mode,
+			    char **tmp)
+{
+	size_t size = strlen(name) + 16;
+	int fd;
+
+	*tmp = xmalloc(size);
+	for (int tries = 0; tries < FS_ATOMIC_TRIES; tries++) {
+		fs_atomic_tmpname(name, *tmp, size);
+		fd = openat(dirfd, *tmp,
+			    O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, mode);
+		if (fd != -1 || errno != EEXIST)
+			return fd;
+	}
+
+	return -1;
+}
+
+/* Links the O_TMPFILE behind proc under a fresh ".name.XXXXXX", for a
+ * rename over an existing name; linkat fails with EEXIST on a clash, so the
+ * name is simply drawn again. */
+static int fs_atomic_linktemp(const char *proc, int dirfd, const char *name,
+			      char **tmp)
+{
+	size_t size = strlen(name) + 16;
+
+	*tmp = xmalloc(size);
+	for (int tries = 0; tries < FS_ATOMIC_TRIES; tries++) {
+		fs_atomic_tmpname(name, *tmp, size);
+		if (linkat(AT_FDCWD, proc, dirfd, *tmp, AT_SYMLINK_FOLLOW) == 0)
+			return 0;
+		if (errno != EEXIST)
+			break;
+	}
+
+	int code = errno;
+	free(*tmp);
+	*tmp = NULL;
+	errno = code;
+	return -1;
+}
+
+int fs_atomic_open(struct fs_atomic *file, const char *path, mode_t mode)
+{
+	const char *slash = strrchr(path, '/');
+	char *dir;
+
+	file->fd = -1;
+	file->tmp = NULL;
+	file->name = fs_strndup(slash ? slash + 1 : path, SIZE_MAX);
+
+	if (slash == path)
+		dir = fs_strndup("/", 1);
+	else if (slash)
+		dir = fs_strndup(path, (size_t)(slash - path));
+	else
+		dir = fs_strndup(".", 1);
+
+	file->dirfd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	free(dir);
+	if (file->dirfd == -1)
+		goto fail;
+
+#if defined(O_TMPFILE)
+	file->fd = openat(file->dirfd, ".", O_TMPFILE | O_WRONLY | O_CLOEXEC,
+			  mode);
+	if (file->fd != -1)
+		return 0;
+	if (errno != EOPNOTSUPP && errno != EISDIR && errno != EINVAL)
+		goto fail;
+#endif
+
+	file->fd = fs_atomic_mktemp(file->dirfd, file->name, mode, &file->tmp);
+	if (file->fd != -1)
+		return 0;
+
+fail: {
+	int code = errno;
+	fs_atomic_abort(file);
+	errno = code;
+	RETURN(errno);
+}
+}
+
+int fs_atomic_commit(struct fs_atomic *file)
+{
+	int ret = 0;
+
+	if (!file->tmp) {
+		char proc[64];
+
+		snprintf(proc, sizeof proc, "/proc/self/fd/%d", file->fd);
+		ret = linkat(AT_FDCWD, proc, file->dirfd, file->name,
+			     AT_SYMLINK_FOLLOW);
+		/* linkat cannot replace, so link beside it and rename over */
+		if (ret == -1 && errno == EEXIST)
+			ret = fs_atomic_linktemp(proc, file->dirfd, file->name,
+						 &file->tmp);
+	}
+	if (file->tmp && ret == 0)
+		ret = renameat(file->dirfd, file->tmp, file->dirfd,
+			       file->name);
+
+	if (ret == -1) {
+		int code = errno;
+		fs_atomic_abort(file);
+		errno = code;
+		RETURN(errno);
+	}
+
+	close(file->fd);
+	close(file->dirfd);
+	free(file->tmp);
+	free(file->name);
+	file->fd = file->dirfd = -1;
+	file->tmp = file->name = NULL;
+
+	return 0;
+}
+
+void fs_atomic_abort(struct fs_atomic *file)
+{
+	if (file->tmp && file->dirfd != -1)
+		unlinkat(file->dirfd, file->tmp, 0);
+	if (file->fd != -1)
+		close(file->fd);
+	if (file->dirfd != -1)
+		close(file->dirfd);
+	free(file->tmp);
+	free(file->name);
+	file->fd = file->dirfd = -1;
+	file->tmp = file->name = NULL;
+}
+
+int fs_write_atomic(const char *path, const char *format, ...)
+{
+	struct fs_atomic file;
+
+	if (fs_atomic_open(&file, path, 0666))
+		return -1;
+
+	va_list ap;
+	va_start(ap, format);
+	int ret = vdprintf(file.fd, format, ap);
+	va_end(ap);
+
+	if (ret < 0) {
+		int code = errno;
+		fs_atomic_abort(&file);
+		errno = code;
+		RETURN(-1);
+	}
+
+	if (fs_atomic_commit(&file))
+		return -1;
+
+	return ret;
+}
+
+static int fs_mode_type(mode_t mode)
+{
+	if (S_ISREG(mode))
+		return FS_FILE;
+	if (S_ISDIR(mode))
+		return FS_DIR;
+	if (S_ISLNK(mode))
+		return FS_LINK;
+	return FS_OTHER;
+}
+
+static int fs_dirent_type(unsigned char type)
+{
+	switch (type) {
+	case DT_REG:
+		return FS_FILE;
+	case DT_DIR:
+		return FS_DIR;
+	case DT_LNK:
+		return FS_LINK;
+	case DT_UNKNOWN:
+		return FS_UNKNOWN;
+	default:
+		return FS_OTHER;
+	}
+}
+
+static bool fs_is_dot(const char *name)
+{
+	return name[0] == '.' &&
+	       (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
+
+static void fs_walk_error(struct fs_walker *w, int code)
+{
+	int none = 0;
+	atomic_compare_exchange_strong(&w->error, &none, code);
+}
+
+static void fs_walk_set_path(struct fs_walk_state *st, const char *path,
+			     size_t len)
+{
+	if (len + 1 > st->cap) {
+		st->cap = len + 256;
+		st->path = xrealloc(st->path, st->cap);
+	}
+	memcpy(st->path, path, len);
+	st->path[len] = '\0';
+	st->len = len;
+}
+
+static void fs_walk_push_name(struct fs_walk_state *st, const char *name)
+{
+	size_t n = strlen(name);
+	bool sep = st->len > 0 && st->path[st->len - 1] != '/';
+
+	if (st->len + sep + n + 1 > st->cap) {
+		st->cap = (st->len + sep + n + 1) * 2;
+		st->path = xrealloc(st->path, st->cap);
+	}
+	if (sep)
+		st->path[st->len++] = '/';
+	memcpy(st->path + st->len, name, n + 1);
+	st->len += n;
+}
+
+static void fs_walk_parent_put(struct fs_walk_parent *p)
+{
+	if (p && atomic_fetch_sub(&p->refs, 1) == 1) {
+		close(p->fd);
+		free(p);
+	}
+}
+
+static void fs_walk_enqueue(struct fs_walker *w, struct fs_walk_parent *parent,
+			    const char *path, size_t len, size_t name,
+			    int depth)
+{
+	struct fs_walk_job *job = xmalloc(sizeof *job + len + 1);
+
+	if (parent)
+		atomic_fetch_add(&parent->refs, 1);
+	job->parent = parent;
+	job->depth = depth;
+	job->name = name;
+	memcpy(job->path, path, len + 1);
+
+	pthread_mutex_lock(&w->lock);
+	job->next = w->jobs;
+	w->jobs = job;
+	w->busy++;
+	pthread_cond_signal(&w->cond);
+	pthread_mutex_unlock(&w->lock);
+}
+
+/* Blocks until a job is available, or returns NULL once every queued and
+ * running directory is finished. */
+static struct fs_walk_job *fs_walk_dequeue(struct fs_walker *w)
+{
+	struct fs_walk_job *job;
+
+	pthread_mutex_lock(&w->lock);
+	while (!w->jobs && w->busy > 0)
+		pthread_cond_wait(&w->cond, &w->lock);
+	job = w->jobs;
+	if (job)
+		w->jobs = job->next;
+	pthread_mutex_unlock(&w->lock);
+
+	return job;
+}
+
+static void fs_walk_finish(struct fs_walker *w)
+{
+	pthread_mutex_lock(&w->lock);
+	if (--w->busy == 0)
+		pthread_cond_broadcast(&w->cond);
+	pthread_mutex_unlock(&w->lock);
+}
+
+static void fs_walk_dir(struct fs_walk_state *st, int fd, int depth);
+
+static void fs_walk_visit(struct fs_walk_state *st, int dirfd,
+			  const char *name, int type, int depth)
+{
+	struct fs_walker *w = st->w;
+	struct stat sb;
+	size_t base = st->len;
+	int action, fd;
+
+	fs_walk_push_name(st, name);
+
+	if (type == FS_UNKNOWN &&
+	    fstatat(dirfd, name, &sb, AT_SYMLINK_NOFOLLOW) == 0)
+		type = fs_mode_type(sb.st_mode);
+
+	struct fs_entry entry = {
+		.path = st->path,
+		.name = st->path + st->len - strlen(name),
+		.dirfd = dirfd,
+		.type = type,
+		.depth = depth,
+	};
+
+	action = w->fn(&entry, w->data);
+	if (action == FS_WALK_STOP)
+		atomic_store(&w->stop, true);
+	if (action != FS_WALK_CONTINUE || type != FS_DIR)
+		goto out;
+
+	if (w->parallel) {
+		fs_walk_enqueue(w, st->parent, st->path, st->len,
+				(size_t)(entry.name - st->path), depth + 1);
+		goto out;
+	}
+
+	fd = openat(dirfd, name,
+		    O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+	if (fd == -1) {
+		fs_walk_error(w, errno);
+		goto out;
+	}
+	fs_walk_dir(st, fd, depth + 1);
+	close(fd);
+
+out:
+	st->len = base;
+	st->path[base] = '\0';
+}
+
+#if defined(__linux__)
+static void fs_walk_dir(struct fs_walk_state *st, int fd, int depth)
+{
+	char *buf = xmalloc(FS_WALK_BUFSIZE);
+	long n = 0;
+
+	while (!atomic_load(&st->w->stop) &&
+	       (n = syscall(SYS_getdents64, fd, buf, FS_WALK_BUFSIZE)) > 0) {
+		for (long off = 0; off < n && !atomic_load(&st->w->stop);) {
+			struct fs_dirent64 *d = (void *)(buf + off);
+
+			off += d->d_reclen;
+			if (fs_is_dot(d->d_name))
+				continue;
+			fs_walk_visit(st, fd, d->d_name,
+				      fs_dirent_type(d->d_type), depth);
+		}
+	}
+	if (n < 0)
+		fs_walk_error(st->w, errno);
+
+	free(buf);
+}
+#else
+static void fs_walk_dir(struct fs_walk_state *st, int fd, int depth)
+{
+	struct dirent *d;
+	DIR *dir;
+	int dupfd = dup(fd);
+
+	if (dupfd == -1 || !(dir = fdopendir(dupfd))) {
+		fs_walk_error(st->w, errno);
+		if (dupfd != -1)
+			close(dupfd);
+		return;
+	}
+
+	while (!atomic_load(&st->w->stop) && (d = readdir(dir))) {
+		if (fs_is_dot(d->d_name))
+			continue;
+		fs_walk_visit(st, fd, d->d_name, FS_UNKNOWN, depth);
+	}
+
+	closedir(dir);
+}
+#endif
+
+static void *fs_walk_worker(void *arg)
+{
+	struct fs_walker *w = arg;
+	struct fs_walk_state st = { .w = w };
+	struct fs_walk_job *job;
+	int flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC, fd;
+
+	while ((job = fs_walk_dequeue(w))) {
+		/* Subdirectories are opened relative to their parent, like the
+		 * sequential walk; only the root may be a symbolic link. */
+		fd = -1;
+		if (!atomic_load(&w->stop)) {
+			if (job->parent)
+				fd = openat(job->parent->fd,
+					    job->path + job->name,
+					    flags | O_NOFOLLOW);
+			else
+				fd = open(job->path, flags);
+			if (fd == -1)
+				fs_walk_error(w, errno);
+		}
+		fs_walk_parent_put(job->parent);
+
+		if (fd != -1) {
+			st.parent = xmalloc(sizeof *st.parent);
+			st.parent->fd = fd;
+			atomic_init(&st.parent->refs, 1);
+			fs_walk_set_path(&st, job->path, strlen(job->path));
+			fs_walk_dir(&st, fd, job->depth);
+			fs_walk_parent_put(st.parent);
+			st.parent = NULL;
+		}
+
+		free(job);
+		fs_walk_finish(w);
+	}
+
+	free(st.path);
+	return NULL;
+}
+
+static void fs_walk_parallel(struct fs_walker *w, const char *path)
+{
+	long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+	size_t nthreads = ncpu > 1 ? (size_t)ncpu : 1;
+	pthread_t *threads = xcalloc(nthreads, sizeof *threads);
+	size_t started = 0;
+
+	pthread_mutex_init(&w->lock, NULL);
+	pthread_cond_init(&w->cond, NULL);
+	fs_walk_enqueue(w, NULL, path, strlen(path), 0, 1);
+
+	for (size_t i = 0; i < nthreads; i++) {
+		if (!pthread_create(&threads[started], NULL, fs_walk_worker, w))
+			started++;
+	}
+	if (started == 0)
+		fs_walk_worker(w);
+	for (size_t i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+
+	pthread_cond_destroy(&w->cond);
+	pthread_mutex_destroy(&w->lock);
+	free(threads);
+}
+
+int fs_walk(const char *path, fs_walk_fn fn, void *data, int flags)
+{
+	struct fs_walker w = {
+		.fn = fn,
+		.data = data,
+		.parallel = flags & FS_WALK_PARALLEL,
+	};
+	struct stat sb;
+	int action, fd;
+
+	if (stat(path, &sb) == -1)
+		RETURN(errno);
+
+	struct fs_entry root = {
+		.path = path,
+		.name = path,
+		.dirfd = AT_FDCWD,
+		.type = fs_mode_type(sb.st_mode),
+		.depth = 0,
+	};
+
+	action = fn(&root, data);
+	if (action != FS_WALK_CONTINUE || root.type != FS_DIR)
+		return 0;
+
+	if (w.parallel) {
+		fs_walk_parallel(&w, path);
+	} else {
+		struct fs_walk_state st = { .w = &w };
+
+		fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (fd == -1)
+			RETURN(errno);
+		fs_walk_set_path(&st, path, strlen(path));
+		fs_walk_dir(&st, fd, 1);
+		close(fd);
+		free(st.path);
+	}
+
+	if (atomic_load(&w.error))
+		RETURN(atomic_load(&w.error));
+
+	return 0;
+}
+
 /* end of file fs.c */
@@ -36,20 +36,82 @@
 #ifndef fs_H
 #define fs_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <sys/types.h>
+#include <time.h>
+
+enum { FS_UNKNOWN, FS_FILE, FS_DIR, FS_LINK, FS_OTHER };
+
+/* Callback return values: keep walking, skip this directory's contents, or
+ * end the walk. */
+enum { FS_WALK_CONTINUE, FS_WALK_PRUNE, FS_WALK_STOP };
+
+/* Visit the subdirectories on worker threads; the callback must then be
+ * thread-safe and entries arrive in no particular order. */
+#define FS_WALK_PARALLEL 0x1
+
+struct fs_entry {
+	const char *path; /* root-relative path, valid during the callback */
+	const char *name; /* final component of path */
+	int dirfd; /* open descriptor of the containing directory */
+	int type; /* FS_FILE, FS_DIR, ... symbolic links are not followed */
+	int depth; /* 0 for the root */
+};
+
+typedef int (*fs_walk_fn)(const struct fs_entry *entry, void *data);
+
+/* Fields requested from fs_stat_many; the others are left zeroed. */
+#define FS_STAT_TYPE 0x1
+#define FS_STAT_MODE 0x2
+#define FS_STAT_SIZE 0x4
+#define FS_STAT_MTIME 0x8
+
+struct fs_stat {
+	int error; /* errno for this path, 0 if it was found */
+	int type; /* FS_FILE, FS_DIR, ... symbolic links are not followed */
+	mode_t mode; /* permission bits */
+	off_t size;
+	struct timespec mtime;
+};
 
 char *fs_read(const char *path);
 
 bool fs_exists(const char *path);
+size_t fs_stat_many(const char *const *paths, size_t n, unsigned int want,
+		    struct fs_stat *out);
 
 int fs_append(const char *path, const char *format, ...);
 int fs_del(const char *path);
 int fs_new(const char *path);
 int fs_write(const char *path, const char *format, ...);
 
+/* Copies from to to, creating it with the source's permission bits. On file
+ * systems with reflinks the copy shares the source's extents, otherwise the
+ * kernel copies with copy_file_range; plain read/write is the last resort. */
+int fs_copy(const char *from, const char *to);
+
 FILE *fs_temp();
 
+/* Writes go to an unnamed O_TMPFILE (or a hidden temporary name where that
+ * is unsupported) in the target's directory; commit publishes the finished
+ * file under its final name in one step, so readers never see it partially
+ * written. */
+struct fs_atomic {
+	int fd;
+	int dirfd;
+	char *name;
+	char *tmp;
+};
+
+int fs_atomic_open(struct fs_atomic *file, const char *path, mode_t mode);
+int fs_atomic_commit(struct fs_atomic *file);
+void fs_atomic_abort(struct fs_atomic *file);
+int fs_write_atomic(const char *path, const char *format, ...);
+
+int fs_walk(const char *path, fs_walk_fn fn, void *data, int flags);
+
 #endif
 
 /* end of file fs.h */
@@ -0,0 +1,442 @@
+/*
+ *   gcklib.log - Asynchronous logging
+ *
+ *   CONFIGURATION
+ *       #define LOG_RING_SIZE
+ *           Bytes buffered per producing thread, a power of two (default
+ *           65536); a thread whose ring is full waits for the writer
+ *       #define LOG_LINE_MAX
+ *           Longest message in bytes (default 1024); longer ones are
+ *           truncated
+ *
+ *
+ *   LICENSE: BSD-3-Clause
+ *
+ *   Copyright (c) 2025 GCK
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "log.h"
+
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE 65536
+#endif
+
+#ifndef LOG_LINE_MAX
+#define LOG_LINE_MAX 1024
+#endif
+
+#if LOG_RING_SIZE & (LOG_RING_SIZE - 1)
+#error "LOG_RING_SIZE must be a power of two"
+#endif
+
+#if LOG_LINE_MAX + 4 > LOG_RING_SIZE
+#error "LOG_RING_SIZE must hold at least one LOG_LINE_MAX message"
+#endif
+
+/* how long the writer sleeps when every ring is empty */
+#define LOG_IDLE_NS 10000000
+
+/* Records are a uint32_t length followed by the line, and may wrap around
+ * the end of data. head is written only by the owning thread and tail only
+ * by the writer; each is published with release order. busy is set while
+ * the owner is pushing, so that log_stop can wait for the push to land. */
+struct log_ring {
+	struct log_ring *next;
+	atomic_bool closed;
+	atomic_bool busy;
+	_Alignas(64) atomic_uint_fast64_t head;
+	_Alignas(64) atomic_uint_fast64_t tail;
+	_Alignas(64) char data[LOG_RING_SIZE];
+};
+
+struct log_batch {
+	size_t len;
+	char data[65536];
+};
+
+_Atomic enum log_level log_level = LOG_LEVEL_INFO;
+
+static const struct {
+	const char *prefix;
+	size_t len;
+} log_levels[] = {
+	[LOG_LEVEL_DEBUG] = { "debug: ", 7 },
+	[LOG_LEVEL_INFO] = { "info: ", 6 },
+	[LOG_LEVEL_WARN] = { "warning: ", 9 },
+	[LOG_LEVEL_ERROR] = { "error: ", 7 },
+};
+
+/* Producers only push onto the head; the writer alone unlinks and frees the
+ * rings of exited threads. */
+static _Atomic(struct log_ring *) log_rings;
+static _Thread_local struct log_ring *log_ring;
+static _Thread_local bool log_ring_failed;
+static pthread_once_t log_once = PTHREAD_ONCE_INIT;
+static pthread_key_t log_ring_key;
+static bool log_have_key;
+
+static int log_fd = STDERR_FILENO;
+static atomic_bool log_running;
+static pthread_t log_writer_thread;
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t log_wake;
+static pthread_cond_t log_flushed;
+static bool log_stopping;
+static unsigned long log_flush_req, log_flush_done;
+
+static void log_direct(const char *buf, size_t len)
+{
+	while (len > 0) {
+		ssize_t n = write(log_fd, buf, len);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			return;
+		}
+		buf += n;
+		len -= (size_t)n;
+	}
+}
+
+static void log_ring_close(void *p)
+{
+	struct log_ring *r = p;
+
+	log_ring = NULL;
+	atomic_store_explicit(&r->closed, true, memory_order_release);
+}
+
+/* The conditions are never destroyed: a producer may still be signalling
+ * wake while log_stop returns. */
+static void log_init(void)
+{
+	pthread_condattr_t attr;
+
+	log_have_key = pthread_key_create(&log_ring_key, log_ring_close) == 0;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&log_wake, &attr);
+	pthread_condattr_destroy(&attr);
+	pthread_cond_init(&log_flushed, NULL);
+}
+
+static struct log_ring *log_ring_new(void)
+{
+	struct log_ring *r = aligned_alloc(_Alignof(struct log_ring),
+					   sizeof(struct log_ring));
+
+	if (!r || !log_have_key || pthread_setspecific(log_ring_key, r) != 0) {
+		free(r);
+		log_ring_failed = true;
+		return NULL;
+	}
+	r->closed = false;
+	r->busy = false;
+	r->head = 0;
+	r->tail = 0;
+
+	r->next = atomic_load(&log_rings);
+	while (!atomic_compare_exchange_weak(&log_rings, &r->next, r))
+		;
+	return log_ring = r;
+}
+
+static void log_ring_copy_in(struct log_ring *r, uint_fast64_t at,
+			     const void *src, size_t n)
+{
+	size_t off = at & (LOG_RING_SIZE - 1);
+	size_t k = LOG_RING_SIZE - off < n ? LOG_RING_SIZE - off : n;
+
+	memcpy(r->data + off, src, k);
+	memcpy(r->data, (const char *)src + k, n - k);
+}
+
+static void log_ring_copy_out(const struct log_ring *r, uint_fast64_t at,
+			      void *dst, size_t n)
+{
+	size_t off = at & (LOG_RING_SIZE - 1);
+	size_t k = LOG_RING_SIZE - off < n ? LOG_RING_SIZE - off : n;
+
+	memcpy(dst, r->data + off, k);
+	memcpy((char *)dst + k, r->data, n - k);
+}
+
+/* The writer outlives every busy ring, so waiting for room cannot hang. */
+static void log_push(struct log_ring *r, const char *line, uint32_t len)
+{
+	uint_fast64_t head =
+		atomic_load_explicit(&r->head, memory_order_relaxed);
+	uint_fast64_t need = sizeof len + len;
+	uint_fast64_t used =
+		head - atomic_load_explicit(&r->tail, memory_order_acquire);
+
+	while (LOG_RING_SIZE - used < need) {
+		pthread_cond_signal(&log_wake);
+		sched_yield();
+		used = head -
+		       atomic_load_explicit(&r->tail, memory_order_acquire);
+	}
+
+	log_ring_copy_in(r, head, &len, sizeof len);
+	log_ring_copy_in(r, head + sizeof len, line, len);
+	atomic_store_explicit(&r->head, head + need, memory_order_release);
+
+	/* Wake the writer early once the ring is half full, rather than on
+	 * every message. */
+	if (used < LOG_RING_SIZE / 2 && used + need >= LOG_RING_SIZE / 2)
+		pthread_cond_signal(&log_wake);
+}
+
+void log_write(enum log_level level, const char *format, ...)
+{
+	char line[LOG_LINE_MAX];
+	va_list ap;
+	int n;
+	size_t len;
+
+	if (level < atomic_load_explicit(&log_level, memory_order_relaxed) ||
+	    level >= LOG_LEVEL_OFF)
+		return;
+
+	len = log_levels[level].len;
+	memcpy(line, log_levels[level].prefix, len);
+	va_start(ap, format);
+	n = vsnprintf(line + len, sizeof line - len, format, ap);
+	va_end(ap);
+	if (n < 0)
+		return;
+	len += (size_t)n;
+	if (len > sizeof line - 1)
+		len = sizeof line - 1;
+	if (line[len - 1] != '\n')
+		line[len++] = '\n';
+
+	if (atomic_load_explicit(&log_running, memory_order_relaxed)) {
+		struct log_ring *r = log_ring;
+
+		if (r || (!log_ring_failed && (r = log_ring_new()))) {
+			bool queued = false;
+
+			/* Pairs with log_stop clearing log_running before the
+			 * writer checks busy: one of them sees the other. */
+			atomic_store(&r->busy, true);
+			if (atomic_load(&log_running)) {
+				log_push(r, line, (uint32_t)len);
+				queued = true;
+			}
+			atomic_store_explicit(&r->busy, false,
+					      memory_order_release);
+			if (queued)
+				return;
+		}
+	}
+	log_direct(line, len);
+}
+
+static void log_batch_flush(struct log_batch *b)
+{
+	log_direct(b->data, b->len);
+	b->len = 0;
+}
+
+static size_t log_drain_ring(struct log_ring *r, struct log_batch *b)
+{
+	uint_fast64_t head =
+		atomic_load_explicit(&r->head, memory_order_acquire);
+	uint_fast64_t tail =
+		atomic_load_explicit(&r->tail, memory_order_relaxed);
+	size_t count = 0;
+
+	while (tail != head) {
+		uint32_t len;
+
+		log_ring_copy_out(r, tail, &len, sizeof len);
+		if (sizeof b->data - b->len < len)
+			log_batch_flush(b);
+		log_ring_copy_out(r, tail + sizeof len, b->data + b->len, len);
+		b->len += len;
+		tail += sizeof len + len;
+		count++;
+	}
+	atomic_store_explicit(&r->tail, tail, memory_order_release);
+	return count;
+}
+
+/* Drains every ring into b, writes what is left over, and frees the rings
+ * of exited threads once they are empty. The list head is never unlinked,
+ * since producers may be pushing onto it. */
+static size_t log_drain(struct log_batch *b)
+{
+	struct log_ring *prev = NULL, *r = atomic_load(&log_rings);
+	size_t count = 0;
+
+	while (r) {
+		struct log_ring *next = r->next;
+		bool closed =
+			atomic_load_explicit(&r->closed, memory_order_acquire);
+
+		count += log_drain_ring(r, b);
+		if (closed && prev) {
+			prev->next = next;
+			free(r);
+		} else {
+			prev = r;
+		}
+		r = next;
+	}
+	if (b->len > 0)
+		log_batch_flush(b);
+	return count;
+}
+
+static bool log_any_busy(void)
+{
+	for (struct log_ring *r = atomic_load(&log_rings); r; r = r->next)
+		if (atomic_load(&r->busy))
+			return true;
+	return false;
+}
+
+static void *log_writer(void *arg)
+{
+	struct log_batch *b = arg;
+
+	pthread_mutex_lock(&log_lock);
+	for (;;) {
+		unsigned long want = log_flush_req;
+		bool stop = log_stopping;
+		size_t count;
+
+		pthread_mutex_unlock(&log_lock);
+		count = log_drain(b);
+		pthread_mutex_lock(&log_lock);
+
+		log_flush_done = want;
+		pthread_cond_broadcast(&log_flushed);
+		if (stop) {
+			/* log_running is already false, so no push can start;
+			 * let the ones in flight land and drain them too. */
+			pthread_mutex_unlock(&log_lock);
+			while (log_any_busy()) {
+				log_drain(b);
+				sched_yield();
+			}
+			log_drain(b);
+			pthread_mutex_lock(&log_lock);
+			break;
+		}
+		if (count == 0 && log_flush_req == want && !log_stopping) {
+			struct timespec ts;
+
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			if (ts.tv_nsec < 1000000000 - LOG_IDLE_NS) {
+				ts.tv_nsec += LOG_IDLE_NS;
+			} else {
+				ts.tv_sec++;
+				ts.tv_nsec -= 1000000000 - LOG_IDLE_NS;
+			}
+			pthread_cond_timedwait(&log_wake, &log_lock, &ts);
+		}
+	}
+	pthread_mutex_unlock(&log_lock);
+	free(b);
+	return NULL;
+}
+
+int log_start(int fd)
+{
+	static bool registered;
+	struct log_batch *b;
+	int err;
+
+	if (atomic_load(&log_running))
+		return 0;
+	pthread_once(&log_once, log_init);
+	b = malloc(sizeof *b);
+	if (!b)
+		return -1;
+	b->len = 0;
+
+	log_fd = fd;
+	log_stopping = false;
+	atomic_store(&log_running, true);
+	err = pthread_create(&log_writer_thread, NULL, log_writer, b);
+	if (err != 0) {
+		atomic_store(&log_running, false);
+		free(b);
+		errno = err;
+		return -1;
+	}
+	if (!registered)
+		registered = atexit(log_stop) == 0;
+	return 0;
+}
+
+void log_flush(void)
+{
+	if (!atomic_load(&log_running))
+		return;
+	pthread_mutex_lock(&log_lock);
+	unsigned long want = ++log_flush_req;
+	pthread_cond_signal(&log_wake);
+	while (log_flush_done < want && !log_stopping)
+		pthread_cond_wait(&log_flushed, &log_lock);
+	pthread_mutex_unlock(&log_lock);
+}
+
+/* Every message queued before log_stop returns is written. Messages that
+ * other threads log from the moment it is called go straight to the fd, so
+ * they may appear before older messages still in those threads' rings. */
+void log_stop(void)
+{
+	if (!atomic_exchange(&log_running, false))
+		return;
+	pthread_mutex_lock(&log_lock);
+	log_stopping = true;
+	pthread_cond_signal(&log_wake);
+	pthread_mutex_unlock(&log_lock);
+	pthread_join(log_writer_thread, NULL);
+}
+
+/* end of file log.c */
@@ -0,0 +1,88 @@
+/*
+ *   gcklib.log - Asynchronous logging
+ *
+ *   CONFIGURATION
+ *       #define LOG_RING_SIZE
+ *           Bytes buffered per producing thread, a power of two (default
+ *           65536); a thread whose ring is full waits for the writer
+ *       #define LOG_LINE_MAX
+ *           Longest message in bytes (default 1024); longer ones are
+ *           truncated
+ *
+ *
+ *   LICENSE: BSD-3-Clause
+ *
+ *   Copyright (c) 2025 GCK
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdatomic.h>
+
+enum log_level {
+	LOG_LEVEL_DEBUG,
+	LOG_LEVEL_INFO,
+	LOG_LEVEL_WARN,
+	LOG_LEVEL_ERROR,
+	LOG_LEVEL_OFF
+};
+
+/* Messages below this level are skipped by the log_*f macros with a single
+ * compare, before any argument is evaluated. Defaults to LOG_LEVEL_INFO.
+ * It may be changed at any time while other threads log; they read it with
+ * a relaxed load, so a change shows up without ordering anything else. */
+extern _Atomic enum log_level log_level;
+
+/* Each thread formats into its own single-producer ring; a background
+ * thread started by log_start drains the rings and writes to fd in large
+ * batches. Before log_start, and from the moment log_stop is called,
+ * messages are written directly. log_start registers log_stop with atexit. */
+int log_start(int fd);
+void log_stop(void);
+void log_flush(void);
+
+void log_write(enum log_level level, const char *format, ...)
+	__attribute__((format(printf, 2, 3)));
+
+#define LOG_AT(level, ...)                                                 \
+	do {                                                               \
+		if ((level) >= atomic_load_explicit(&log_level,            \
+						    memory_order_relaxed)) \
+			log_write(level, __VA_ARGS__);                     \
+	} while (0)
+
+#define log_debugf(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define log_infof(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define log_warnf(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define log_errorf(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+
+#endif
+
+/* end of file log.h */
@@ -62,7 +62,7 @@ Copyright (C) %d GCK.\n\
 This is free software: you are free to change and redistribute it.\n\
 There is NO WARRNTY, to the extent permitted by law.\n\
 ",
-	       prog_name, VERSION, COMMIT, YEAR);
+	       prog_name, VERSION, prog_commit, YEAR);
 }
 
 int parse_standard_options(int argc, char **argv, void (*print_help)(),
@@ -73,7 +73,7 @@ int parse_standard_options(int argc, char **argv, void (*print_help)(),
 			print_help();
 			exit(EXIT_SUCCESS);
 		} else if (!strcmp(argv[i], "--version")) {
-			emit_version();
+			print_version();
 			exit(EXIT_SUCCESS);
 		}
 	}
@@ -38,6 +38,10 @@
 
 extern const char *prog_name;
 
+/* Defined in the version.c the build generates, which only changes with the
+ * commit, so nothing else is recompiled for a new commit. */
+extern const int prog_commit;
+
 void set_prog_name(char *name);
 
 void emit_try_help();
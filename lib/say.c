@@ -1,6 +1,10 @@
 /*
  *   gcklib.say - Provides printing and some string utilies
  *
+ *   CONFIGURATION
+ *       #define SAY_FPS
+ *           Maximum status line redraws per second (default 30)
+ *
  *
  *   LICENSE: BSD-3-Clause
  *
@@ -33,17 +37,153 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define _XOPEN_SOURCE 700
+
 #include "say.h"
 
+#include <signal.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "xmem.h"
 
+#ifndef SAY_FPS
+#define SAY_FPS 30
+#endif
+
+#define SAY_LINE_MAX 512
+
+static volatile sig_atomic_t winch_pending = 1;
+static struct sigaction winch_old;
+static struct winsize winsz;
+static bool winsz_valid;
+
+static struct {
+	size_t done;
+	size_t total;
+	const char *label;
+	struct timespec last;
+	bool active;
+} progress;
+
+static void say_winch(int sig, siginfo_t *info, void *ctx)
+{
+	winch_pending = 1;
+	if (winch_old.sa_flags & SA_SIGINFO)
+		winch_old.sa_sigaction(sig, info, ctx);
+	else if (winch_old.sa_handler != SIG_DFL &&
+		 winch_old.sa_handler != SIG_IGN)
+		winch_old.sa_handler(sig);
+}
+
+/* The window size is only queried again after a SIGWINCH. */
+static bool say_winsize(struct winsize *w)
+{
+	static bool installed = false;
+
+	if (!installed) {
+		struct sigaction sa = { 0 };
+		sa.sa_sigaction = say_winch;
+		sigemptyset(&sa.sa_mask);
+		sa.sa_flags = SA_RESTART | SA_SIGINFO;
+		sigaction(SIGWINCH, &sa, &winch_old);
+		installed = true;
+	}
+
+	if (winch_pending) {
+		winch_pending = 0;
+		winsz_valid = ioctl(STDOUT_FILENO, TIOCGWINSZ, &winsz) == 0 &&
+			      winsz.ws_row > 0;
+	}
+
+	*w = winsz;
+	return winsz_valid;
+}
+
+static void say_write(const char *buf, size_t len)
+{
+	while (len > 0) {
+		ssize_t n = write(STDOUT_FILENO, buf, len);
+		if (n < 0)
+			return;
+		buf += n;
+		len -= (size_t)n;
+	}
+}
+
+/* Draws len bytes of text on the last row, leaving the cursor where it was.
+ * The escapes and the text go out in one write; only text longer than a
+ * status line needs a heap buffer. */
+static void say_status(const struct winsize *w, const char *text, size_t len)
+{
+	char stack[SAY_LINE_MAX + 32];
+	char *buf = stack;
+	size_t size = len + 32;
+	int n;
+
+	if (size > sizeof stack)
+		buf = xmalloc(size);
+	else
+		size = sizeof stack;
+
+	n = snprintf(buf, size, "\0337\033[%d;1H\033[2K", w->ws_row);
+	if (n >= 0 && (size_t)n + len + 2 < size) {
+		memcpy(buf + n, text, len);
+		memcpy(buf + (size_t)n + len, "\0338", 2);
+		fflush(stdout);
+		say_write(buf, (size_t)n + len + 2);
+	}
+
+	if (buf != stack)
+		free(buf);
+}
+
+static void say_progress_draw(void)
+{
+	char line[SAY_LINE_MAX];
+	struct winsize w;
+	size_t shown;
+	int len, percent;
+
+	if (!say_winsize(&w))
+		return;
+
+	/* A count past the total is shown as it is, but the bar stops full. */
+	if (!progress.total)
+		percent = 0;
+	else if (progress.done >= progress.total)
+		percent = 100;
+	else
+		percent = (int)(progress.done * 100 / progress.total);
+	len = snprintf(line, sizeof line, "%s %zu/%zu %3d%% ",
+		       progress.label ? progress.label : "", progress.done,
+		       progress.total, percent);
+	if (len < 0)
+		return;
+
+	int width = (w.ws_col < SAY_LINE_MAX ? w.ws_col : SAY_LINE_MAX - 1) -
+		    len - 2;
+	if (width >= 10 && (size_t)len + (size_t)width + 2 < sizeof line) {
+		int fill = width * percent / 100;
+		line[len++] = '[';
+		memset(line + len, '#', (size_t)fill);
+		memset(line + len + fill, '.', (size_t)(width - fill));
+		len += width;
+		line[len++] = ']';
+		line[len] = '\0';
+	}
+
+	/* Only the progress line is cut to the terminal width. */
+	shown = strlen(line);
+	say_status(&w, line, shown < w.ws_col ? shown : w.ws_col);
+}
+
 void alert()
 {
 	fputs("\a", stderr);
@@ -53,8 +193,11 @@ void alert()
 
 int vasprintf(char **result, const char *fmt, va_list ap)
 {
-	int total_width = strlen(fmt) + 1;
-	*result = (char *)xmalloc(total_width);
+	va_list copy;
+	va_copy(copy, ap);
+	int total_width = vsnprintf(NULL, 0, fmt, copy) + 1;
+	va_end(copy);
+	*result = (char *)xmalloc((size_t)total_width);
 	return vsprintf(*result, fmt, ap);
 }
 
@@ -71,7 +214,7 @@ int asprintf(char **buf, const char *fmt, ...)
 int say(const char *restrict format, ...)
 {
 	struct winsize w;
-	if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &w) == -1) {
+	if (!say_winsize(&w)) {
 		va_list args;
 		va_start(args, format);
 		int ret = vprintf(format, args);
@@ -81,22 +224,60 @@ int say(const char *restrict format, ...)
 		return ret;
 	}
 
-	printf("\0337"); // save cursor (ESC 7)
-	printf("\033[%d;1H", w.ws_row); // move to last row
-	printf("\033[2K"); // clear entire line
-
+	char *line;
 	va_list args;
 	va_start(args, format);
-	int ret = vprintf(format, args); // print formatted message
+	int ret = vasprintf(&line, format, args);
 	va_end(args);
 
-	fflush(stdout); // ensure it's visible immediately
-	printf("\0338"); // restore cursor (ESC 8)
-	fflush(stdout);
+	say_status(&w, line, strlen(line));
+	free(line);
 
 	return ret;
 }
 
+void say_progress(size_t done, size_t total, const char *label)
+{
+	static bool registered = false;
+	struct timespec now;
+	long long elapsed;
+
+	if (!registered)
+		registered = atexit(say_progress_end) == 0;
+
+	progress.done = done;
+	progress.total = total;
+	progress.label = label;
+	progress.active = true;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	elapsed = (long long)(now.tv_sec - progress.last.tv_sec) * 1000000000 +
+		  (now.tv_nsec - progress.last.tv_nsec);
+	if (elapsed < 1000000000 / SAY_FPS)
+		return;
+
+	progress.last = now;
+	say_progress_draw();
+}
+
+/* Updates held back by the rate limit are never drawn, so the final count
+ * is always printed here as an ordinary line. */
+void say_progress_end(void)
+{
+	const char *label = progress.label ? progress.label : "";
+	struct winsize w;
+
+	if (!progress.active)
+		return;
+
+	if (say_winsize(&w))
+		say_status(&w, "", 0);
+	printf("%s %zu/%zu\n", label, progress.done, progress.total);
+	fflush(stdout);
+
+	memset(&progress, 0, sizeof progress);
+}
+
 _Noreturn void die(const char *msg)
 {
 	fputs(msg, stderr);
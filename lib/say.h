@@ -1,6 +1,10 @@
 /*
  *   gcklib.say - Provides printing and some string utilies
  *
+ *   CONFIGURATION
+ *       #define SAY_FPS
+ *           Maximum status line redraws per second (default 30)
+ *
  *
  *   LICENSE: BSD-3-Clause
  *
@@ -37,11 +41,19 @@
 #define SAY_H
 
 #include <stdarg.h>
+#include <stddef.h>
 
 int asprintf(char **buf, const char *fmt, ...);
 int vasprintf(char **buf, const char *fmt, va_list ap);
 int say(const char *restrict format, ...);
 
+/* Progress on the last terminal row, redrawn at most SAY_FPS times a second;
+ * label must stay valid until the next call. say_progress_end clears the
+ * row and prints the final count once; it also runs at exit if a progress
+ * line is still open. */
+void say_progress(size_t done, size_t total, const char *label);
+void say_progress_end(void);
+
 void alert();
 
 _Noreturn void die(const char *msg);
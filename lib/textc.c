@@ -50,7 +50,7 @@ char *tostrupr(char *s)
 {
 	char *new = str_dup(s);
 	for (int i = 0; new[i] != '\0'; ++i)
-		new[i] = toupper((unsigned char)new[i]);
+		new[i] = (char)toupper((unsigned char)new[i]);
 	return new;
 }
 
@@ -58,17 +58,20 @@ char *tostrlwr(char *s)
 {
 	char *new = str_dup(s);
 	for (int i = 0; new[i] != '\0'; ++i)
-		new[i] = tolower((unsigned char)new[i]);
+		new[i] = (char)tolower((unsigned char)new[i]);
 	return new;
 }
 
 char *textc_trim(char *s)
 {
+	(void)s;
 	return NULL;
 }
 
 char *textc_pad_left(int count, char *s, char pad)
 {
+	(void)count;
+	(void)pad;
 	char *buffer = xmalloc(strlen(s) + 1);
 
 	free(buffer);
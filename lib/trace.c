@@ -0,0 +1,304 @@
+/*
+ *   gcklib.trace - Span tracing in Chrome trace-event format
+ *
+ *   CONFIGURATION
+ *       #define TRACE_RING_SIZE
+ *           Events kept per thread, a power of two (default 16384); older
+ *           events are overwritten
+ *
+ *
+ *   LICENSE: BSD-3-Clause
+ *
+ *   Copyright (c) 2025 GCK
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include "trace.h"
+
+#ifndef TRACE_RING_SIZE
+#define TRACE_RING_SIZE 16384
+#endif
+
+#if TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)
+#error "TRACE_RING_SIZE must be a power of two"
+#endif
+
+struct trace_event {
+	uint64_t ts; /* CLOCK_MONOTONIC nanoseconds */
+	const char *name;
+	char phase; /* 'B' or 'E' */
+};
+
+/* Written only by its thread; head counts every event ever recorded and is
+ * published with release order after the event it covers. */
+struct trace_ring {
+	struct trace_ring *next;
+	long tid;
+	atomic_uint_fast64_t head;
+	struct trace_event events[TRACE_RING_SIZE];
+};
+
+struct trace_buf {
+	int fd;
+	size_t len;
+	char data[4096];
+};
+
+/* Rings are pushed here on first use and never freed, so the dump also sees
+ * threads that have exited. */
+static _Atomic(struct trace_ring *) trace_rings;
+static _Thread_local struct trace_ring *trace_ring;
+static _Thread_local bool trace_ring_failed;
+static atomic_flag trace_installed = ATOMIC_FLAG_INIT;
+static atomic_flag trace_dumped = ATOMIC_FLAG_INIT;
+static const char *trace_dump_path;
+
+static uint64_t trace_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void trace_at_exit(void)
+{
+	if (!atomic_flag_test_and_set(&trace_dumped))
+		trace_dump(trace_dump_path);
+}
+
+static void trace_on_signal(int sig)
+{
+	trace_at_exit();
+	signal(sig, SIG_DFL);
+	raise(sig);
+}
+
+static void trace_install(void)
+{
+	static const int sigs[] = { SIGINT, SIGTERM };
+
+	trace_dump_path = getenv("TRACE_FILE");
+	if (!trace_dump_path || !*trace_dump_path)
+		trace_dump_path = "trace.json";
+	atexit(trace_at_exit);
+	for (size_t i = 0; i < sizeof sigs / sizeof *sigs; i++) {
+		struct sigaction old, sa = { .sa_handler = trace_on_signal };
+
+		sigemptyset(&sa.sa_mask);
+		if (sigaction(sigs[i], NULL, &old) == 0 &&
+		    old.sa_handler == SIG_DFL)
+			sigaction(sigs[i], &sa, NULL);
+	}
+}
+
+static struct trace_ring *trace_ring_new(void)
+{
+	struct trace_ring *r = calloc(1, sizeof *r);
+
+	if (!r) {
+		trace_ring_failed = true;
+		return NULL;
+	}
+
+#if defined(__linux__)
+	r->tid = syscall(SYS_gettid);
+#else
+	static atomic_long next_tid = 1;
+	r->tid = atomic_fetch_add(&next_tid, 1);
+#endif
+
+	r->next = atomic_load(&trace_rings);
+	while (!atomic_compare_exchange_weak(&trace_rings, &r->next, r))
+		;
+	if (!atomic_flag_test_and_set(&trace_installed))
+		trace_install();
+	return trace_ring = r;
+}
+
+static void trace_record(const char *name, char phase)
+{
+	struct trace_ring *r = trace_ring;
+
+	if (!r && (trace_ring_failed || !(r = trace_ring_new())))
+		return;
+
+	uint_fast64_t head =
+		atomic_load_explicit(&r->head, memory_order_relaxed);
+	struct trace_event *e = &r->events[head & (TRACE_RING_SIZE - 1)];
+	e->ts = trace_now();
+	e->name = name;
+	e->phase = phase;
+	atomic_store_explicit(&r->head, head + 1, memory_order_release);
+}
+
+void trace_begin(const char *name)
+{
+	trace_record(name, 'B');
+}
+
+void trace_end(const char *name)
+{
+	trace_record(name, 'E');
+}
+
+/* The dump runs from signal handlers, so it formats by hand and only calls
+ * open, write and close. */
+static void trace_flush(struct trace_buf *b)
+{
+	const char *p = b->data;
+
+	while (b->len > 0) {
+		ssize_t n = write(b->fd, p, b->len);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		p += n;
+		b->len -= (size_t)n;
+	}
+	b->len = 0;
+}
+
+static void trace_put(struct trace_buf *b, const char *s, size_t n)
+{
+	while (n > 0) {
+		if (b->len == sizeof b->data)
+			trace_flush(b);
+		size_t k = sizeof b->data - b->len;
+		if (k > n)
+			k = n;
+		memcpy(b->data + b->len, s, k);
+		b->len += k;
+		s += k;
+		n -= k;
+	}
+}
+
+static void trace_puts(struct trace_buf *b, const char *s)
+{
+	trace_put(b, s, strlen(s));
+}
+
+/* Writes v in decimal, zero padded to at least width digits. */
+static void trace_put_u64(struct trace_buf *b, uint64_t v, size_t width)
+{
+	char digits[20];
+	size_t n = 0;
+
+	do {
+		digits[sizeof digits - ++n] = (char)('0' + v % 10);
+		v /= 10;
+	} while (v || n < width);
+	trace_put(b, digits + sizeof digits - n, n);
+}
+
+static void trace_put_json(struct trace_buf *b, const char *s)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	for (; *s; s++) {
+		unsigned char c = (unsigned char)*s;
+
+		if (c == '"' || c == '\\') {
+			char esc[2] = { '\\', (char)c };
+			trace_put(b, esc, 2);
+		} else if (c < 0x20) {
+			char esc[6] = { '\\', 'u', '0', '0', hex[c >> 4],
+					hex[c & 0xf] };
+			trace_put(b, esc, 6);
+		} else {
+			trace_put(b, s, 1);
+		}
+	}
+}
+
+int trace_dump(const char *path)
+{
+	struct trace_buf b = { .len = 0 };
+	const char *sep = "";
+	uint64_t pid = (uint64_t)getpid();
+
+	b.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+	if (b.fd == -1)
+		return -1;
+
+	trace_puts(&b, "{\"traceEvents\":[");
+	for (struct trace_ring *r = atomic_load(&trace_rings); r; r = r->next) {
+		uint_fast64_t head =
+			atomic_load_explicit(&r->head, memory_order_acquire);
+		uint_fast64_t first =
+			head > TRACE_RING_SIZE ? head - TRACE_RING_SIZE : 0;
+
+		for (uint_fast64_t i = first; i < head; i++) {
+			const struct trace_event *e =
+				&r->events[i & (TRACE_RING_SIZE - 1)];
+			char phase[] = { e->phase, '\0' };
+
+			trace_puts(&b, sep);
+			trace_puts(&b, "\n{\"name\":\"");
+			trace_put_json(&b, e->name);
+			trace_puts(&b, "\",\"ph\":\"");
+			trace_puts(&b, phase);
+			trace_puts(&b, "\",\"ts\":");
+			trace_put_u64(&b, e->ts / 1000, 1);
+			trace_puts(&b, ".");
+			trace_put_u64(&b, e->ts % 1000, 3);
+			trace_puts(&b, ",\"pid\":");
+			trace_put_u64(&b, pid, 1);
+			trace_puts(&b, ",\"tid\":");
+			trace_put_u64(&b, (uint64_t)r->tid, 1);
+			trace_puts(&b, "}");
+			sep = ",";
+		}
+	}
+	trace_puts(&b, "\n]}\n");
+	trace_flush(&b);
+
+	return close(b.fd);
+}
+
+/* end of file trace.c */
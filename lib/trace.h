@@ -0,0 +1,66 @@
+/*
+ *   gcklib.trace - Span tracing in Chrome trace-event format
+ *
+ *   CONFIGURATION
+ *       #define TRACE_ON
+ *           Compile the TRACE_ macros in; without it they expand to nothing
+ *           and their arguments are never evaluated
+ *       #define TRACE_RING_SIZE
+ *           Events kept per thread, a power of two (default 16384); older
+ *           events are overwritten
+ *
+ *
+ *   LICENSE: BSD-3-Clause
+ *
+ *   Copyright (c) 2025 GCK
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/* Each thread records into its own ring, so recording takes no lock. The
+ * first event installs an atexit handler and, where they are still at their
+ * defaults, SIGINT and SIGTERM handlers that write every ring to $TRACE_FILE
+ * (default trace.json) for chrome://tracing or ui.perfetto.dev. Names must
+ * outlive the dump; string literals do. */
+void trace_begin(const char *name);
+void trace_end(const char *name);
+int trace_dump(const char *path);
+
+#if defined(TRACE_ON)
+#define TRACE_BEGIN(name) trace_begin(name)
+#define TRACE_END(name) trace_end(name)
+#else
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END(name) ((void)0)
+#endif
+
+#endif
+
+/* end of file trace.h */
@@ -0,0 +1,171 @@
+/*
+ *   yait.gcklib - Vendors gcklib into generated projects
+ *
+ *
+ *   LICENSE: BSD-3-Clause
+ *
+ *   Copyright (c) 2025 GCK
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../lib/err.h"
+#include "../lib/fs.h"
+#include "../lib/xmem.h"
+
+#include "gcklib.h"
+
+/* Length of the module name in a file name such as "fs.c". */
+static size_t module_len(const char *name)
+{
+	const char *dot = strrchr(name, '.');
+
+	return dot ? (size_t)(dot - name) : strlen(name);
+}
+
+static bool module_is(const struct gcklib_file *file, const char *name,
+		      size_t len)
+{
+	return module_len(file->name) == len &&
+	       !strncmp(file->name, name, len);
+}
+
+/* Marks every file of the module name[0..len) and returns how many there
+ * were. */
+static size_t mark_module(bool *want, const char *name, size_t len)
+{
+	size_t found = 0;
+
+	for (size_t i = 0; i < gcklib_nfiles; i++) {
+		if (module_is(&gcklib_files[i], name, len)) {
+			want[i] = true;
+			found++;
+		}
+	}
+
+	return found;
+}
+
+/* Pulls in the modules behind each '#include "x.h"' of a wanted file until
+ * nothing new turns up. */
+static void mark_includes(bool *want)
+{
+	bool grew;
+
+	do {
+		grew = false;
+		for (size_t i = 0; i < gcklib_nfiles; i++) {
+			if (!want[i])
+				continue;
+
+			const char *p = gcklib_files[i].data;
+			while ((p = strstr(p, "#include \""))) {
+				p += sizeof "#include \"" - 1;
+				size_t len = strcspn(p, ".\"\n");
+				for (size_t j = 0; j < gcklib_nfiles; j++) {
+					if (!want[j] &&
+					    module_is(&gcklib_files[j], p, len)) {
+						want[j] = true;
+						grew = true;
+					}
+				}
+			}
+		}
+	} while (grew);
+}
+
+size_t gcklib_vendor(const char *dir, const char *modules)
+{
+	bool *want = xcalloc(gcklib_nfiles ? gcklib_nfiles : 1, sizeof *want);
+
+	if (!modules || !strcmp(modules, "all")) {
+		for (size_t i = 0; i < gcklib_nfiles; i++)
+			want[i] = true;
+	} else if (strcmp(modules, "none")) {
+		for (const char *p = modules; *p;) {
+			size_t len = strcspn(p, ",");
+			if (len && !mark_module(want, p, len))
+				fatalf("unknown gcklib module: %.*s", (int)len,
+				       p);
+			p += len + (p[len] == ',');
+		}
+		mark_includes(want);
+	}
+
+	const char *from = getenv("GCKLIB_DIR");
+	if (!from || !*from)
+		from = GCKLIB_DIR;
+
+	size_t *pick = xcalloc(gcklib_nfiles ? gcklib_nfiles : 1, sizeof *pick);
+	size_t n = 0;
+	for (size_t i = 0; i < gcklib_nfiles; i++) {
+		if (want[i])
+			pick[n++] = i;
+	}
+
+	/* One batched stat tells which files the installed copy has, so a
+	 * missing or partial install costs no failed opens. */
+	char **src = xcalloc(n ? n : 1, sizeof *src);
+	struct fs_stat *st = xcalloc(n ? n : 1, sizeof *st);
+	for (size_t k = 0; k < n; k++) {
+		if (asprintf(&src[k], "%s/%s", from,
+			     gcklib_files[pick[k]].name) == -1)
+			fatalfa(errno);
+	}
+	fs_stat_many((const char *const *)src, n, FS_STAT_TYPE, st);
+
+	for (size_t k = 0; k < n; k++) {
+		const struct gcklib_file *file = &gcklib_files[pick[k]];
+		char *to;
+
+		if (asprintf(&to, "%s/%s", dir, file->name) == -1)
+			fatalfa(errno);
+		if (!st[k].error && st[k].type == FS_FILE)
+			fs_copy(src[k], to);
+		else
+			fs_write(to, "%s", file->data);
+
+		free(to);
+		free(src[k]);
+	}
+
+	free(st);
+	free(src);
+	free(pick);
+	free(want);
+	return n;
+}
+
+/* end of file gcklib.c */
@@ -0,0 +1,64 @@
+/*
+ *   yait.gcklib - Vendors gcklib into generated projects
+ *
+ *
+ *   LICENSE: BSD-3-Clause
+ *
+ *   Copyright (c) 2025 GCK
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GCKLIB_H
+#define GCKLIB_H
+
+#include <stddef.h>
+
+#ifndef GCKLIB_DIR
+#define GCKLIB_DIR "/usr/local/share/gcklib"
+#endif
+
+/* The gcklib sources yait was built with, generated by build-aux/embed. */
+struct gcklib_file {
+	const char *name;
+	const char *data;
+	size_t size;
+};
+
+extern const struct gcklib_file gcklib_files[];
+extern const size_t gcklib_nfiles;
+
+/* Populates dir with the gcklib modules named in the comma separated list
+ * modules ("all" or "none" also work) and the modules they include. Files
+ * are cloned from an installed gcklib ($GCKLIB_DIR, else GCKLIB_DIR) when
+ * it has them and written from the embedded copy otherwise. Returns the
+ * number of files written; an unknown module name is fatal. */
+size_t gcklib_vendor(const char *dir, const char *modules);
+
+#endif
+
+/* end of file gcklib.h */
@@ -47,6 +47,7 @@
 #include <config.h>
 #include <errno.h>
 #include <getopt.h>
+#include <limits.h>
 #include <pwd.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -63,15 +64,19 @@
 #include "../lib/say.h"
 #include "../lib/textc.h"
 #include "../lib/xmem.h"
+#include "gcklib.h"
 #include "licence.h"
 
 typedef enum { MIT, GPL, BSD, UNL } licence_t;
 
+enum { GCKLIB_OPTION = CHAR_MAX + 1 };
+
 static const struct option longopts[] = {
 	{ "author", required_argument, 0, 'a' },
 	{ "licence", required_argument, 0, 'l' },
 	{ "quiet", no_argument, 0, 'q' },
 	{ "force", no_argument, 0, 'f' },
+	{ "gcklib", required_argument, 0, GCKLIB_OPTION },
 	{ 0, 0, 0, 0 }
 };
 
@@ -159,6 +164,7 @@ int main(int argc, char **argv)
 	bool force = false;
 	bool editor = false;
 	bool shell = false;
+	const char *gcklib = "all";
 	char *author = get_name();
 	exit_status = EXIT_SUCCESS;
 	int year = get_year();
@@ -207,6 +213,9 @@ int main(int argc, char **argv)
 		case 'S':
 			shell = true;
 			break;
+		case GCKLIB_OPTION:
+			gcklib = optarg;
+			break;
 		default:
 			lose = 1;
 		}
@@ -225,6 +234,10 @@ int main(int argc, char **argv)
 
 	package = str_dup(argv[optind]);
 
+	if (!force && fs_exists(package))
+		fatalf("'%s' already exists, use --force to overwrite it",
+		       package);
+
 	if (shell) {
 		fs_write(package, "\
 #!/bin/sh\n\
@@ -289,20 +302,30 @@ done\n\
 	char *pdir;
 	asprintf(&pdir, "%s/", package);
 
-	fs_new(pdir);
+	if (!fs_exists(pdir))
+		fs_new(pdir);
 	if (chdir(pdir))
 		fatalfa(errno);
 
-	fs_new("doc/");
-	fs_new("src/");
-	fs_new("tools/");
-	fs_new("lib/");
+	static const char *const dirs[] = { "doc/", "src/", "tools/", "lib/",
+					    "bench/" };
+	struct fs_stat dirst[sizeof dirs / sizeof *dirs];
+
+	fs_stat_many(dirs, sizeof dirs / sizeof *dirs, FS_STAT_TYPE, dirst);
+	for (size_t i = 0; i < sizeof dirs / sizeof *dirs; i++) {
+		if (dirst[i].error)
+			fs_new(dirs[i]);
+		else if (dirst[i].type != FS_DIR)
+			fatalf("'%s' exists and is not a directory", dirs[i]);
+	}
+
+	gcklib_vendor("lib", gcklib);
 
 	fs_write("doc/version.texi", "\
-@set UPDATED %s\
-@set UPDATED-MONTH %s\
-@set EDITION 1\
-@set VERSION alpha\
+@set UPDATED %s\n\
+@set UPDATED-MONTH %s\n\
+@set EDITION 1\n\
+@set VERSION alpha\n\
 ",
 		 "1 January 1970", "January 2025");
 
@@ -310,14 +333,14 @@ done\n\
 	asprintf(&texi_buffer, "doc/%s.texi", package);
 	fs_write(texi_buffer, "\
 \\input texinfo @c -*-texinfo-*-\n\
-@c %**start of header\n\
+@c %%**start of header\n\
 @setfilename foo.info\n\
 @include version.texi\n\
 @settitle %s foo @value{VERSION}\n\
 \n\
 @defcodeindex op\n\
 @syncodeindex op cp\n\
-@c %**end of header\n\
+@c %%**end of header\n\
 \n\
 @copying\n\
 This manual is for %s foo (version @value{VERSION}, @value{UPDATED}),\n\
@@ -464,12 +487,6 @@ Patches are welcome, preferably made with @samp{diff -u} and including\n\
 a @file{ChangeLog} entry.\n\
 \n\
 \n\
-@node GNU Free Documentation License\n\
-@appendix GNU Free Documentation License\n\
-\n\
-@include fdl.texi\n\
-\n\
-\n\
 @node Concept index\n\
 @unnumbered Concept index\n\
 \n\
@@ -481,9 +498,53 @@ a @file{ChangeLog} entry.\n\
 		 author, author, author, author, author, author);
 	free(texi_buffer);
 
+	fs_write("doc/Makefile", "\
+PACKAGE := %s\n\
+\n\
+MAKEINFO := $(shell command -v makeinfo 2>/dev/null)\n\
+\n\
+ifeq ($(MAKEINFO),)\n\
+all info html pdf txt:\n\
+	@echo \"makeinfo not found, skipping the manual\"\n\
+else\n\
+all: info\n\
+\n\
+info: $(PACKAGE).info\n\
+html: $(PACKAGE).html\n\
+pdf: $(PACKAGE).pdf\n\
+txt: $(PACKAGE).txt\n\
+\n\
+$(PACKAGE).info: $(PACKAGE).texi version.texi\n\
+	$(MAKEINFO) --no-split $< -o $@\n\
+\n\
+$(PACKAGE).html: $(PACKAGE).texi version.texi\n\
+	$(MAKEINFO) --no-split --html $< -o $@\n\
+\n\
+$(PACKAGE).pdf: $(PACKAGE).texi version.texi\n\
+	$(MAKEINFO) --pdf $< -o $@\n\
+\n\
+$(PACKAGE).txt: $(PACKAGE).texi version.texi\n\
+	$(MAKEINFO) --plaintext $< -o $@\n\
+endif\n\
+\n\
+clean:\n\
+	$(RM) *.aux *.cp *.cps *.fn *.fns *.ky *.kys *.log *.pg *.pgs *.toc *.tp *.tps *.vr *.vrs\n\
+	$(RM) $(PACKAGE).info $(PACKAGE).html $(PACKAGE).pdf $(PACKAGE).txt\n\
+\n\
+.PHONY: all info html pdf txt clean\n\
+",
+		 package);
+
 	char *src_path;
 	asprintf(&src_path, "src/%s.c", package);
-	fs_write(src_path, "typedef int x;");
+	fs_write(src_path, "\
+#include <stdlib.h>\n\
+\n\
+int main(void)\n\
+{\n\
+	return EXIT_SUCCESS;\n\
+}\n\
+");
 	//   fs_write(src_path, "\
 	// /* Copyright (C) %s\n\
 	//  *\n\
@@ -536,7 +597,7 @@ a @file{ChangeLog} entry.\n\
 	// \n\
 	// void print_version()\n\
 	// {\n\
-	// 	printf(\"%%s %%s %%d\\n\", prog_name, VERSION, COMMIT);\n\
+	// 	printf(\"%%s %%s %%d\\n\", prog_name, VERSION, prog_commit);\n\
 	// 	\n\
 	// 	printf(\"Copyright (C) %%d %s.\\n\", YEAR);\n\
 	// 	\n\
@@ -548,6 +609,446 @@ a @file{ChangeLog} entry.\n\
 	//            author, package, package, package, author);
 	free(src_path);
 
+	fs_write("src/pch.h", "\
+/*\n\
+ * Precompiled header for 'configure --pch'. The build includes it ahead of\n\
+ * every translation unit, so list only headers that rarely change: editing\n\
+ * one rebuilds the whole project. Feature test macros belong in the\n\
+ * project's flags (FEATURES in the Makefile), not here.\n\
+ */\n\
+\n\
+#include <errno.h>\n\
+#include <stdarg.h>\n\
+#include <stdbool.h>\n\
+#include <stddef.h>\n\
+#include <stdint.h>\n\
+#include <stdio.h>\n\
+#include <stdlib.h>\n\
+#include <string.h>\n\
+\n\
+#if __has_include(\"lib/err.h\")\n\
+#include \"lib/err.h\"\n\
+#endif\n\
+#if __has_include(\"lib/fs.h\")\n\
+#include \"lib/fs.h\"\n\
+#endif\n\
+#if __has_include(\"lib/proginfo.h\")\n\
+#include \"lib/proginfo.h\"\n\
+#endif\n\
+#if __has_include(\"lib/xmem.h\")\n\
+#include \"lib/xmem.h\"\n\
+#endif\
+");
+
+	fs_write("src/core.h", "\
+#ifndef CORE_H\n\
+#define CORE_H\n\
+\n\
+#include <stddef.h>\n\
+#include <stdint.h>\n\
+\n\
+/* The program's main computation, kept apart from main() and its option\n\
+ * handling so that bench/ can measure it. Replace it with the real work;\n\
+ * for now it is a 64-bit FNV-1a hash of data. */\n\
+uint64_t core(const void *data, size_t len);\n\
+\n\
+#endif\
+");
+
+	fs_write("src/core.c", "\
+#include \"core.h\"\n\
+\n\
+/* Tracing hooks cost nothing until the build defines TRACE_ON (configure\n\
+ * --trace), and compile without the trace module as well. */\n\
+#if __has_include(\"../lib/trace.h\")\n\
+#include \"../lib/trace.h\"\n\
+#else\n\
+#define TRACE_BEGIN(name) ((void)0)\n\
+#define TRACE_END(name) ((void)0)\n\
+#endif\n\
+\n\
+uint64_t core(const void *data, size_t len)\n\
+{\n\
+	const unsigned char *p = data;\n\
+	uint64_t hash = 0xcbf29ce484222325ULL;\n\
+\n\
+	TRACE_BEGIN(\"core\");\n\
+	for (size_t i = 0; i < len; i++) {\n\
+		hash ^= p[i];\n\
+		hash *= 0x100000001b3ULL;\n\
+	}\n\
+	TRACE_END(\"core\");\n\
+\n\
+	return hash;\n\
+}\
+");
+
+	fs_write("bench/bench.h", "\
+/*\n\
+ * Micro-benchmark harness, built and run by 'make bench'.\n\
+ *\n\
+ * A benchmark is a function that performs its operation iters times:\n\
+ *\n\
+ *	BENCH(name)\n\
+ *	{\n\
+ *		for (uint64_t i = 0; i < iters; i++)\n\
+ *			bench_keep(work());\n\
+ *	}\n\
+ *\n\
+ * The harness warms each one up, grows iters until a sample takes long\n\
+ * enough to time reliably, takes BENCH_SAMPLES samples, drops the outliers\n\
+ * and reports the median and median absolute deviation in ns/op.\n\
+ */\n\
+\n\
+#ifndef BENCH_H\n\
+#define BENCH_H\n\
+\n\
+#include <stdint.h>\n\
+\n\
+#define BENCH_SAMPLES 31\n\
+#define BENCH_WARMUP_NS 100000000ULL\n\
+#define BENCH_SAMPLE_NS 10000000ULL\n\
+\n\
+typedef void (*bench_fn)(uint64_t iters);\n\
+\n\
+void bench_register(const char *name, bench_fn fn);\n\
+\n\
+/* Defines a benchmark and registers it before main runs. */\n\
+#define BENCH(name)                                                   \\\n\
+	static void bench_##name(uint64_t iters);                     \\\n\
+	__attribute__((constructor)) static void bench_reg_##name(void) \\\n\
+	{                                                             \\\n\
+		bench_register(#name, bench_##name);                  \\\n\
+	}                                                             \\\n\
+	static void bench_##name(uint64_t iters)\n\
+\n\
+/* Makes the compiler treat value as used, so the work producing it is not\n\
+ * optimised away. */\n\
+static inline void bench_keep(uint64_t value)\n\
+{\n\
+	__asm__ volatile(\"\" : : \"r\"(value) : \"memory\");\n\
+}\n\
+\n\
+#endif\
+");
+
+	fs_write("bench/bench.c", "\
+/*\n\
+ * Micro-benchmark harness: see bench.h.\n\
+ *\n\
+ * Usage: bench [--json=FILE] [FILTER]...\n\
+ * Runs the benchmarks whose names contain one of the FILTERs, or all of them.\n\
+ * --json also writes the results with every sample to FILE, one benchmark\n\
+ * per line, for tools/bench-compare.\n\
+ */\n\
+\n\
+#define _GNU_SOURCE\n\
+\n\
+#include <stdio.h>\n\
+#include <stdlib.h>\n\
+#include <string.h>\n\
+#include <time.h>\n\
+\n\
+#include \"bench.h\"\n\
+\n\
+#define BENCH_MAX 64\n\
+\n\
+#if defined(CLOCK_MONOTONIC_RAW)\n\
+#define BENCH_CLOCK CLOCK_MONOTONIC_RAW\n\
+#else\n\
+#define BENCH_CLOCK CLOCK_MONOTONIC\n\
+#endif\n\
+\n\
+struct bench {\n\
+	const char *name;\n\
+	bench_fn fn;\n\
+};\n\
+\n\
+static struct bench benches[BENCH_MAX];\n\
+static size_t nbenches;\n\
+static FILE *json;\n\
+\n\
+void bench_register(const char *name, bench_fn fn)\n\
+{\n\
+	if (nbenches == BENCH_MAX) {\n\
+		fprintf(stderr, \"bench: more than %%d benchmarks\\n\", BENCH_MAX);\n\
+		exit(EXIT_FAILURE);\n\
+	}\n\
+	benches[nbenches].name = name;\n\
+	benches[nbenches].fn = fn;\n\
+	nbenches++;\n\
+}\n\
+\n\
+static uint64_t now_ns(void)\n\
+{\n\
+	struct timespec ts;\n\
+\n\
+	clock_gettime(BENCH_CLOCK, &ts);\n\
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;\n\
+}\n\
+\n\
+static uint64_t time_ns(bench_fn fn, uint64_t iters)\n\
+{\n\
+	uint64_t start = now_ns();\n\
+\n\
+	fn(iters);\n\
+	return now_ns() - start;\n\
+}\n\
+\n\
+static int cmp_double(const void *a, const void *b)\n\
+{\n\
+	double x = *(const double *)a, y = *(const double *)b;\n\
+\n\
+	return (x > y) - (x < y);\n\
+}\n\
+\n\
+/* Sorts v and returns its median. */\n\
+static double median(double *v, size_t n)\n\
+{\n\
+	qsort(v, n, sizeof *v, cmp_double);\n\
+	return n %% 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;\n\
+}\n\
+\n\
+static double mad(const double *v, size_t n, double med, double *dev)\n\
+{\n\
+	for (size_t i = 0; i < n; i++)\n\
+		dev[i] = v[i] > med ? v[i] - med : med - v[i];\n\
+	return median(dev, n);\n\
+}\n\
+\n\
+static void run(const struct bench *b)\n\
+{\n\
+	double raw[BENCH_SAMPLES], ns[BENCH_SAMPLES], dev[BENCH_SAMPLES];\n\
+	uint64_t iters = 1;\n\
+\n\
+	/* Doubling the count until one sample is long enough also warms up\n\
+	 * caches, branch predictors and the CPU clock; keep going for the\n\
+	 * rest of the warm-up period at that count. */\n\
+	uint64_t start = now_ns();\n\
+	while (time_ns(b->fn, iters) < BENCH_SAMPLE_NS && iters < 1ULL << 40)\n\
+		iters *= 2;\n\
+	while (now_ns() - start < BENCH_WARMUP_NS)\n\
+		b->fn(iters);\n\
+\n\
+	for (size_t i = 0; i < BENCH_SAMPLES; i++)\n\
+		raw[i] = ns[i] = (double)time_ns(b->fn, iters) / (double)iters;\n\
+\n\
+	/* Samples more than 3.5 scaled MADs from the median (a modified\n\
+	 * z-score above 3.5) are interruptions, not the code being measured. */\n\
+	double med = median(ns, BENCH_SAMPLES);\n\
+	double spread = mad(ns, BENCH_SAMPLES, med, dev) * 1.4826;\n\
+	size_t kept = 0;\n\
+	for (size_t i = 0; i < BENCH_SAMPLES; i++) {\n\
+		double d = ns[i] > med ? ns[i] - med : med - ns[i];\n\
+		if (spread == 0 || d <= 3.5 * spread)\n\
+			ns[kept++] = ns[i];\n\
+	}\n\
+\n\
+	med = median(ns, kept);\n\
+	spread = mad(ns, kept, med, dev);\n\
+	printf(\"%%-24s %%12.2f ns/op  +- %%8.2f  (%%zu/%%d samples of %%llu)\\n\",\n\
+	       b->name, med, spread, kept, BENCH_SAMPLES,\n\
+	       (unsigned long long)iters);\n\
+\n\
+	if (json) {\n\
+		static const char *sep = \"\";\n\
+		fprintf(json, \"%%s\\n{\\\"name\\\": \\\"%%s\\\", \\\"iters\\\": %%llu, \"\n\
+			\"\\\"median\\\": %%.3f, \\\"mad\\\": %%.3f, \\\"samples\\\": [\",\n\
+			sep, b->name, (unsigned long long)iters, med, spread);\n\
+		for (size_t i = 0; i < BENCH_SAMPLES; i++)\n\
+			fprintf(json, \"%%s%%.3f\", i ? \", \" : \"\", raw[i]);\n\
+		fputs(\"]}\", json);\n\
+		sep = \",\";\n\
+	}\n\
+}\n\
+\n\
+static int selected(const char *name, int argc, char **argv)\n\
+{\n\
+	if (argc < 2)\n\
+		return 1;\n\
+	for (int i = 1; i < argc; i++) {\n\
+		if (strstr(name, argv[i]))\n\
+			return 1;\n\
+	}\n\
+	return 0;\n\
+}\n\
+\n\
+int main(int argc, char **argv)\n\
+{\n\
+	if (argc > 1 && !strncmp(argv[1], \"--json=\", 7)) {\n\
+		json = fopen(argv[1] + 7, \"w\");\n\
+		if (!json) {\n\
+			perror(argv[1] + 7);\n\
+			return EXIT_FAILURE;\n\
+		}\n\
+		fputs(\"{\\\"benchmarks\\\": [\", json);\n\
+		argv[1] = argv[0];\n\
+		argc--;\n\
+		argv++;\n\
+	}\n\
+\n\
+	printf(\"%%-24s %%18s %%13s\\n\", \"benchmark\", \"median\", \"MAD\");\n\
+	for (size_t i = 0; i < nbenches; i++) {\n\
+		if (selected(benches[i].name, argc, argv))\n\
+			run(&benches[i]);\n\
+	}\n\
+\n\
+	if (json) {\n\
+		fputs(\"\\n]}\\n\", json);\n\
+		if (fclose(json) != 0) {\n\
+			perror(\"bench\");\n\
+			return EXIT_FAILURE;\n\
+		}\n\
+	}\n\
+	return EXIT_SUCCESS;\n\
+}\
+");
+
+	fs_write("bench/core.c", "\
+/* Sample benchmark of core(); add more BENCH() definitions to bench/. */\n\
+\n\
+#include <string.h>\n\
+\n\
+#include \"bench.h\"\n\
+\n\
+#include \"src/core.h\"\n\
+\n\
+BENCH(core_4k)\n\
+{\n\
+	static char buf[4096];\n\
+\n\
+	memset(buf, 'x', sizeof buf);\n\
+	for (uint64_t i = 0; i < iters; i++)\n\
+		bench_keep(core(buf, sizeof buf));\n\
+}\
+");
+
+	fs_write("bench/trace.c", "\
+/* Cost of one span, TRACE_BEGIN plus TRACE_END, with tracing compiled in. */\n\
+\n\
+#define TRACE_ON\n\
+\n\
+#include <stdlib.h>\n\
+\n\
+#include \"bench.h\"\n\
+\n\
+#if __has_include(\"lib/trace.h\")\n\
+#include \"lib/trace.h\"\n\
+\n\
+BENCH(trace_span)\n\
+{\n\
+	/* Keeps the rings' exit dump out of the working directory. */\n\
+	setenv(\"TRACE_FILE\", \"build/bench-trace.json\", 0);\n\
+	for (uint64_t i = 0; i < iters; i++) {\n\
+		TRACE_BEGIN(\"span\");\n\
+		TRACE_END(\"span\");\n\
+	}\n\
+}\n\
+#endif\
+");
+
+	fs_write("bench/log.c", "\
+/*\n\
+ * Logging throughput with 1 to 32 producer threads. Each sample splits iters\n\
+ * messages across the threads and waits until they have been written; the\n\
+ * stdio_ benchmarks do the same through one shared fprintf stream. Both\n\
+ * write to /dev/null, and both pay for creating the threads.\n\
+ */\n\
+\n\
+#include <fcntl.h>\n\
+#include <inttypes.h>\n\
+#include <pthread.h>\n\
+#include <stdio.h>\n\
+#include <stdlib.h>\n\
+\n\
+#include \"bench.h\"\n\
+\n\
+#if __has_include(\"lib/log.h\")\n\
+#include \"lib/log.h\"\n\
+\n\
+#define MAX_THREADS 32\n\
+\n\
+struct producer {\n\
+	uint64_t iters;\n\
+};\n\
+\n\
+static pthread_once_t once = PTHREAD_ONCE_INIT;\n\
+static FILE *null_fp;\n\
+\n\
+static void setup(void)\n\
+{\n\
+	int fd = open(\"/dev/null\", O_WRONLY);\n\
+\n\
+	null_fp = fopen(\"/dev/null\", \"w\");\n\
+	if (fd == -1 || !null_fp || log_start(fd) != 0) {\n\
+		perror(\"bench/log.c: /dev/null\");\n\
+		exit(1);\n\
+	}\n\
+}\n\
+\n\
+static void *log_producer(void *arg)\n\
+{\n\
+	const struct producer *p = arg;\n\
+\n\
+	for (uint64_t i = 0; i < p->iters; i++)\n\
+		log_infof(\"request %%\" PRIu64 \" served in %%d us\", i, 42);\n\
+	return NULL;\n\
+}\n\
+\n\
+static void *stdio_producer(void *arg)\n\
+{\n\
+	const struct producer *p = arg;\n\
+\n\
+	for (uint64_t i = 0; i < p->iters; i++)\n\
+		fprintf(null_fp, \"info: request %%\" PRIu64 \" served in %%d us\\n\",\n\
+			i, 42);\n\
+	return NULL;\n\
+}\n\
+\n\
+static void run(void *(*fn)(void *), unsigned nthreads, uint64_t iters)\n\
+{\n\
+	pthread_t threads[MAX_THREADS];\n\
+	struct producer p[MAX_THREADS];\n\
+\n\
+	pthread_once(&once, setup);\n\
+	for (unsigned i = 0; i < nthreads; i++) {\n\
+		p[i].iters = iters / nthreads + (i < iters %% nthreads);\n\
+		pthread_create(&threads[i], NULL, fn, &p[i]);\n\
+	}\n\
+	for (unsigned i = 0; i < nthreads; i++)\n\
+		pthread_join(threads[i], NULL);\n\
+}\n\
+\n\
+#define LOG_BENCH(n)                             \\\n\
+	BENCH(log_##n##t)                        \\\n\
+	{                                        \\\n\
+		run(log_producer, n, iters);     \\\n\
+		log_flush();                     \\\n\
+	}                                        \\\n\
+	BENCH(stdio_##n##t)                      \\\n\
+	{                                        \\\n\
+		run(stdio_producer, n, iters);   \\\n\
+		fflush(null_fp);                 \\\n\
+	}\n\
+\n\
+LOG_BENCH(1)\n\
+LOG_BENCH(2)\n\
+LOG_BENCH(4)\n\
+LOG_BENCH(8)\n\
+LOG_BENCH(16)\n\
+LOG_BENCH(32)\n\
+\n\
+/* A message below log_level: one compare, arguments never evaluated. */\n\
+BENCH(log_disabled)\n\
+{\n\
+	for (uint64_t i = 0; i < iters; i++) {\n\
+		log_debugf(\"request %%\" PRIu64 \" served in %%d us\", i, 42);\n\
+		bench_keep(i);\n\
+	}\n\
+}\n\
+#endif\
+");
+
 	fs_write("tools/Cleanup", "\
 #!/bin/sh\n\
 # Usage: ./Cleanup\n\
@@ -577,6 +1078,453 @@ echo \"done.\"\
 \n\
 find . -name \"*.c\" -exec clang-format -i --verbose {} \\;\n\
 find . -name \"*.h\" -exec clang-format -i --verbose {} \\;\
+");
+
+	fs_write("tools/bench-compare", "\
+#!/bin/sh\n\
+# Usage: ./tools/bench-compare [-t PERCENT] [-a ALPHA] BASELINE CURRENT\n\
+#\n\
+# Compares two result files written by the benchmark harness (--json). For\n\
+# each benchmark a two-sided Mann-Whitney U test on the samples tells whether\n\
+# the runs differ at all; a benchmark is a regression when they do (p below\n\
+# ALPHA, default 0.01) and its median got more than PERCENT (default 5)\n\
+# slower. Exits 1 if any benchmark regressed.\n\
+\n\
+threshold=5 alpha=0.01\n\
+while [ $# -gt 0 ]; do\n\
+	case $1 in\n\
+	-t) threshold=$2; shift 2 ;;\n\
+	-a) alpha=$2; shift 2 ;;\n\
+	*) break ;;\n\
+	esac\n\
+done\n\
+if [ $# -ne 2 ]; then\n\
+	echo \"usage: $0 [-t PERCENT] [-a ALPHA] BASELINE CURRENT\" >&2\n\
+	exit 2\n\
+fi\n\
+for f in \"$1\" \"$2\"; do\n\
+	[ -r \"$f\" ] || { echo \"bench-compare: cannot read $f\" >&2; exit 2; }\n\
+done\n\
+\n\
+awk -v threshold=\"$threshold\" -v alpha=\"$alpha\" '\n\
+# Complementary error function, Abramowitz and Stegun 7.1.26 (|error| below\n\
+# 1.5e-7), which is plenty for a significance level.\n\
+function erfc(x,   t, y) {\n\
+	t = 1 / (1 + 0.3275911 * x)\n\
+	y = t * (0.254829592 + t * (-0.284496736 + t * (1.421413741 + \\\n\
+		t * (-1.453152027 + t * 1.061405429))))\n\
+	return y * exp(-x * x)\n\
+}\n\
+\n\
+# Two-sided p-value of the Mann-Whitney U test between samples a[1..na] and\n\
+# b[1..nb], by the normal approximation with tie and continuity corrections.\n\
+function mannwhitney(a, na, b, nb,   v, g, n, i, j, k, t, r, r1, ties, u, mu, sd, z) {\n\
+	n = 0\n\
+	for (i = 1; i <= na; i++) { v[++n] = a[i]; g[n] = 1 }\n\
+	for (i = 1; i <= nb; i++) { v[++n] = b[i]; g[n] = 2 }\n\
+	for (i = 2; i <= n; i++) {\n\
+		t = v[i]; k = g[i]\n\
+		for (j = i - 1; j >= 1 && v[j] > t; j--) { v[j + 1] = v[j]; g[j + 1] = g[j] }\n\
+		v[j + 1] = t; g[j + 1] = k\n\
+	}\n\
+	r1 = 0; ties = 0\n\
+	for (i = 1; i <= n; i = j) {\n\
+		for (j = i + 1; j <= n && v[j] == v[i]; j++)\n\
+			;\n\
+		r = (i + j - 1) / 2\n\
+		t = j - i\n\
+		ties += t * t * t - t\n\
+		for (k = i; k < j; k++)\n\
+			if (g[k] == 1)\n\
+				r1 += r\n\
+	}\n\
+	u = r1 - na * (na + 1) / 2\n\
+	mu = na * nb / 2\n\
+	sd = sqrt(na * nb / 12 * ((n + 1) - ties / (n * (n - 1))))\n\
+	if (sd == 0)\n\
+		return 1\n\
+	z = u - mu\n\
+	z = z > 0 ? z - 0.5 : z < 0 ? z + 0.5 : 0\n\
+	z = (z < 0 ? -z : z) / sd\n\
+	return erfc(z / sqrt(2))\n\
+}\n\
+\n\
+# One benchmark per line: {\"name\": \"x\", ..., \"median\": m, ..., \"samples\": [...]}\n\
+function field(line, key,   s) {\n\
+	s = line\n\
+	if (!sub(\".*\\\"\" key \"\\\": *\", \"\", s))\n\
+		return \"\"\n\
+	sub(/[,}].*/, \"\", s)\n\
+	gsub(/\"/, \"\", s)\n\
+	return s\n\
+}\n\
+\n\
+/\"name\":/ {\n\
+	name = field($0, \"name\")\n\
+	s = $0\n\
+	sub(/.*\"samples\": *\\[/, \"\", s)\n\
+	sub(/\\].*/, \"\", s)\n\
+	if (FILENAME == ARGV[1]) {\n\
+		bmed[name] = field($0, \"median\")\n\
+		bs[name] = s\n\
+		border[++nb] = name\n\
+	} else {\n\
+		cmed[name] = field($0, \"median\")\n\
+		cs[name] = s\n\
+		corder[++nc] = name\n\
+	}\n\
+}\n\
+\n\
+END {\n\
+	printf \"%%-24s %%12s %%12s %%8s %%8s\\n\", \"benchmark\", \"baseline\", \"current\", \"change\", \"p\"\n\
+	for (i = 1; i <= nc; i++) {\n\
+		name = corder[i]\n\
+		if (!(name in bmed)) {\n\
+			printf \"%%-24s %%12s %%12.2f %%8s %%8s  new\\n\", name, \"-\", cmed[name], \"\", \"\"\n\
+			continue\n\
+		}\n\
+		na = split(bs[name], a, /, */)\n\
+		nn = split(cs[name], b, /, */)\n\
+		p = mannwhitney(a, na, b, nn)\n\
+		change = (cmed[name] - bmed[name]) / bmed[name] * 100\n\
+		verdict = \"same\"\n\
+		if (p < alpha)\n\
+			verdict = change > 0 ? \"slower\" : \"faster\"\n\
+		if (p < alpha && change > threshold) {\n\
+			verdict = \"REGRESSION\"\n\
+			bad = 1\n\
+		}\n\
+		printf \"%%-24s %%12.2f %%12.2f %%+7.1f%%%% %%8.4f  %%s\\n\", name, bmed[name], cmed[name], change, p, verdict\n\
+	}\n\
+	for (i = 1; i <= nb; i++)\n\
+		if (!(border[i] in cmed))\n\
+			printf \"%%-24s %%12.2f %%12s %%8s %%8s  missing\\n\", border[i], bmed[border[i]], \"-\", \"\", \"\"\n\
+	exit bad\n\
+}' \"$1\" \"$2\"\
+");
+
+	fs_write("tools/flamegraph", "\
+#!/bin/sh\n\
+# Usage: perf script | ./tools/flamegraph collapse > FOLDED\n\
+#        ./tools/flamegraph render [TITLE] < FOLDED > SVG\n\
+#\n\
+# collapse folds the call stacks of 'perf script' output into one line per\n\
+# distinct stack, root first: \"comm;main;f;g COUNT\". render draws folded\n\
+# stacks as an SVG flame graph: each box is a function, as wide as its share\n\
+# of the samples, with its callees stacked above it.\n\
+\n\
+case $1 in\n\
+collapse)\n\
+	exec awk '\n\
+# A sample is a header line (\"comm pid ... event:\") followed by one frame per\n\
+# line, innermost first, and ends at a blank line.\n\
+function flush(   s, i) {\n\
+	if (comm == \"\")\n\
+		return\n\
+	s = comm\n\
+	for (i = n; i >= 1; i--)\n\
+		s = s \";\" frame[i]\n\
+	count[s]++\n\
+	comm = \"\"\n\
+	n = 0\n\
+}\n\
+\n\
+/^[ \\t]*$/ { flush(); next }\n\
+\n\
+/^[^ \\t]/ {\n\
+	flush()\n\
+	comm = $1\n\
+	next\n\
+}\n\
+\n\
+{\n\
+	f = $2\n\
+	if (f == \"[unknown]\" && NF >= 3) {\n\
+		f = $3\n\
+		sub(/^\\(/, \"\", f)\n\
+		sub(/\\)$/, \"\", f)\n\
+		sub(/.*\\//, \"\", f)\n\
+		if (f !~ /^\\[/)\n\
+			f = \"[\" f \"]\"\n\
+	}\n\
+	sub(/\\+0x[0-9a-f]+$/, \"\", f)\n\
+	gsub(/;/, \":\", f)\n\
+	frame[++n] = f\n\
+}\n\
+\n\
+END {\n\
+	flush()\n\
+	for (s in count)\n\
+		print s, count[s]\n\
+}' | sort\n\
+	;;\n\
+render)\n\
+	title=${2:-Flame Graph}\n\
+	sort | awk -v title=\"$title\" '\n\
+function esc(s) {\n\
+	gsub(/&/, \"\\\\&amp;\", s)\n\
+	gsub(/</, \"\\\\&lt;\", s)\n\
+	gsub(/>/, \"\\\\&gt;\", s)\n\
+	gsub(/\"/, \"\\\\&quot;\", s)\n\
+	return s\n\
+}\n\
+\n\
+# Closes frames depth..top at x, recording each as a box.\n\
+function close_to(depth, x,   d) {\n\
+	for (d = top; d >= depth; d--) {\n\
+		nbox++\n\
+		bname[nbox] = stack[d]\n\
+		bdepth[nbox] = d\n\
+		bstart[nbox] = start[d]\n\
+		bend[nbox] = x\n\
+	}\n\
+	top = depth - 1\n\
+}\n\
+\n\
+# Warm colours, stable per function name.\n\
+function colour(name,   h, i) {\n\
+	h = 0\n\
+	for (i = 1; i <= length(name); i++)\n\
+		h = (h * 31 + index(chars, substr(name, i, 1))) %% 65536\n\
+	return sprintf(\"rgb(%%d,%%d,%%d)\", 205 + h %% 50, 80 + int(h / 50) %% 150, \\\n\
+		30 + int(h / 7500) %% 40)\n\
+}\n\
+\n\
+BEGIN {\n\
+	chars = \" !\\\"#$%%&'\\''()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\\\]^_`abcdefghijklmnopqrstuvwxyz{|}~\"\n\
+	top = 0\n\
+	total = 0\n\
+}\n\
+\n\
+NF >= 2 {\n\
+	samples = $NF\n\
+	line = $0\n\
+	sub(/ [0-9]+$/, \"\", line)\n\
+	n = split(line, f, \";\")\n\
+\n\
+	same = 0\n\
+	while (same < n && same < top && f[same + 1] == stack[same + 1])\n\
+		same++\n\
+	close_to(same + 1, total)\n\
+	for (d = same + 1; d <= n; d++) {\n\
+		stack[d] = f[d]\n\
+		start[d] = total\n\
+	}\n\
+	top = n\n\
+	if (n > maxdepth)\n\
+		maxdepth = n\n\
+	total += samples\n\
+}\n\
+\n\
+END {\n\
+	close_to(1, total)\n\
+	width = 1200\n\
+	fh = 16\n\
+	pad = 10\n\
+	height = (maxdepth + 1) * fh + 3 * pad + 20\n\
+	scale = total ? (width - 2 * pad) / total : 0\n\
+\n\
+	printf \"<?xml version=\\\"1.0\\\" standalone=\\\"no\\\"?>\\n\"\n\
+	printf \"<svg version=\\\"1.1\\\" width=\\\"%%d\\\" height=\\\"%%d\\\" \", width, height\n\
+	printf \"viewBox=\\\"0 0 %%d %%d\\\" xmlns=\\\"http://www.w3.org/2000/svg\\\">\\n\", width, height\n\
+	printf \"<rect width=\\\"100%%%%\\\" height=\\\"100%%%%\\\" fill=\\\"#f8f8f8\\\"/>\\n\"\n\
+	printf \"<text x=\\\"%%d\\\" y=\\\"%%d\\\" font-family=\\\"Verdana\\\" font-size=\\\"17\\\" text-anchor=\\\"middle\\\">%%s</text>\\n\", \\\n\
+		width / 2, 24, esc(title)\n\
+	printf \"<g font-family=\\\"Verdana\\\" font-size=\\\"12\\\">\\n\"\n\
+\n\
+	# The whole profile as the bottom box.\n\
+	nbox++\n\
+	bname[nbox] = \"all\"\n\
+	bdepth[nbox] = 0\n\
+	bstart[nbox] = 0\n\
+	bend[nbox] = total\n\
+\n\
+	for (i = 1; i <= nbox; i++) {\n\
+		w = (bend[i] - bstart[i]) * scale\n\
+		if (w < 0.1)\n\
+			continue\n\
+		x = pad + bstart[i] * scale\n\
+		y = height - pad - (bdepth[i] + 1) * fh\n\
+		name = bname[i]\n\
+		printf \"<g><title>%%s (%%d samples, %%.2f%%%%)</title>\", esc(name), \\\n\
+			bend[i] - bstart[i], 100 * (bend[i] - bstart[i]) / total\n\
+		printf \"<rect x=\\\"%%.1f\\\" y=\\\"%%d\\\" width=\\\"%%.1f\\\" height=\\\"%%d\\\" fill=\\\"%%s\\\" rx=\\\"2\\\"/>\", \\\n\
+			x, y, w, fh - 1, colour(name)\n\
+		fit = int((w - 6) / 7)\n\
+		if (fit >= 3) {\n\
+			label = length(name) > fit ? substr(name, 1, fit - 2) \"..\" : name\n\
+			printf \"<text x=\\\"%%.1f\\\" y=\\\"%%d\\\">%%s</text>\", x + 3, y + fh - 4, esc(label)\n\
+		}\n\
+		printf \"</g>\\n\"\n\
+	}\n\
+	printf \"</g>\\n</svg>\\n\"\n\
+}'\n\
+	;;\n\
+*)\n\
+	echo \"usage: $0 collapse | render [TITLE]\" >&2\n\
+	exit 2\n\
+	;;\n\
+esac\
+");
+
+	fs_write("tools/unity", "\
+#!/bin/sh\n\
+# Usage: ./tools/unity CHUNKS OUTDIR SRCDIR SOURCE...\n\
+#        ./tools/unity --self-check\n\
+#\n\
+# Writes OUTDIR/unity1.c .. unityCHUNKS.c, each including a contiguous run of\n\
+# the SOURCEs (paths under SRCDIR). Feature test macros are hoisted to the top\n\
+# of each chunk. A file-scope static or a macro defined by two sources of the\n\
+# same chunk is an error, since one would silently change the other.\n\
+#\n\
+# --self-check runs the collision detection over a few sample sources.\n\
+\n\
+if [ \"$1\" = --self-check ]; then\n\
+	tmp=$(mktemp -d) || exit 1\n\
+	trap 'rm -rf \"$tmp\"' EXIT\n\
+	fail=0\n\
+\n\
+	# expect NAME STATUS MESSAGE A-SOURCE B-SOURCE: runs both sources as\n\
+	# one chunk and checks the exit status and that stderr has MESSAGE.\n\
+	expect() {\n\
+		mkdir -p \"$tmp/$1\"\n\
+		printf '%%s\\n' \"$4\" > \"$tmp/$1/a.c\"\n\
+		printf '%%s\\n' \"$5\" > \"$tmp/$1/b.c\"\n\
+		sh \"$0\" 1 \"$tmp/$1/out\" \"$tmp/$1\" \"$tmp/$1/a.c\" \"$tmp/$1/b.c\" \\\n\
+			2> \"$tmp/$1/err\"\n\
+		status=$?\n\
+		if [ $status -ne $2 ] ||\n\
+		   { [ -n \"$3\" ] && ! grep -qF \"$3\" \"$tmp/$1/err\"; }; then\n\
+			printf 'unity: self-check %%s failed (status %%d)\\n' \\\n\
+				\"$1\" $status\n\
+			cat \"$tmp/$1/err\"\n\
+			fail=1\n\
+		fi\n\
+	}\n\
+\n\
+	expect distinct 0 \"\" \\\n\
+		'static int a_count;' 'static int b_count;'\n\
+	expect static 1 \"count is defined in both a.c and b.c\" \\\n\
+		'static int count;' 'static int count = 1;'\n\
+	expect function 1 \"next is defined in both\" \\\n\
+		'static int next(void);' 'static int next(void) { return 0; }'\n\
+	expect atomic 0 \"\" \\\n\
+		'static _Atomic(struct a_ring *) a_rings;' \\\n\
+		'static _Atomic(struct b_ring *) b_rings;'\n\
+	expect atomic-same 1 \"rings is defined in both\" \\\n\
+		'static _Atomic(struct ring *) rings;' \\\n\
+		'static _Atomic(struct ring *) rings;'\n\
+	expect qualified 1 \"ring is defined in both\" \\\n\
+		'static _Thread_local struct ring *volatile ring;' \\\n\
+		'static const volatile int ring;'\n\
+	expect anonymous 1 \"levels is defined in both\" \\\n\
+		'static const struct {\n\
+	int n;\n\
+} levels[] = { { 1 } };' 'static const char *const levels[] = { \"\" };'\n\
+	expect macro 1 \"LIMIT is defined in both\" \\\n\
+		'#define LIMIT 1' '#define LIMIT 2'\n\
+	expect undef 0 \"\" \\\n\
+		'#define LIMIT 1\n\
+#undef LIMIT' '#define LIMIT 2'\n\
+	[ $fail -eq 0 ] && echo \"unity: self-check passed\"\n\
+	exit $fail\n\
+fi\n\
+\n\
+n=$1 out=$2 srcdir=$3\n\
+shift 3\n\
+mkdir -p \"$out\" || exit 1\n\
+\n\
+awk -v n=\"$n\" -v out=\"$out\" -v srcdir=\"$srcdir\" -v total=$# '\n\
+function own(id) {\n\
+	if ((f, id) in seen)\n\
+		return\n\
+	seen[f, id]\n\
+	if ((c, id) in owner) {\n\
+		printf \"unity: %%s is defined in both %%s and %%s\\n\", \\\n\
+			id, owner[c, id], f > \"/dev/stderr\"\n\
+		bad = 1\n\
+	} else {\n\
+		owner[c, id] = f\n\
+	}\n\
+}\n\
+\n\
+FNR == 1 {\n\
+	f = FILENAME\n\
+	if (index(f, srcdir \"/\") == 1)\n\
+		f = substr(f, length(srcdir) + 2)\n\
+	c = int(nf++ * n / total) + 1\n\
+	inc[c] = inc[c] \"#include \\\"\" f \"\\\"\\n\"\n\
+}\n\
+\n\
+/^[ \\t]*#[ \\t]*define[ \\t]+_[A-Z0-9_]*_SOURCE/ {\n\
+	line = $0\n\
+	sub(/^[ \\t]*#[ \\t]*/, \"#\", line)\n\
+	if (!((c, line) in hoisted)) {\n\
+		hoisted[c, line]\n\
+		top[c] = top[c] line \"\\n\"\n\
+	}\n\
+	next\n\
+}\n\
+\n\
+/^[ \\t]*#[ \\t]*define[ \\t]/ {\n\
+	id = $0\n\
+	sub(/^[ \\t]*#[ \\t]*define[ \\t]+/, \"\", id)\n\
+	sub(/[^A-Za-z0-9_].*/, \"\", id)\n\
+	own(id)\n\
+}\n\
+\n\
+/^[ \\t]*#[ \\t]*undef[ \\t]/ {\n\
+	id = $0\n\
+	sub(/^[ \\t]*#[ \\t]*undef[ \\t]+/, \"\", id)\n\
+	sub(/[^A-Za-z0-9_].*/, \"\", id)\n\
+	if ((c, id) in owner && owner[c, id] == f)\n\
+		delete owner[c, id]\n\
+}\n\
+\n\
+");
+	fs_append("tools/unity", "\
+# The name is the last identifier before any \"(\", \"=\", \"[\", \";\" or \",\",\n\
+# once _Atomic(type) and the qualifiers that may follow it are dropped.\n\
+/^static[ \\t]/ {\n\
+	id = \" \" $0\n\
+	gsub(/_Atomic[ \\t]*\\([^()]*\\)/, \" \", id)\n\
+	sub(/[(=[;,].*/, \"\", id)\n\
+	id = id \" \"\n\
+	for (k = 0; k < 2; k++)\n\
+		gsub(/[^A-Za-z0-9_](const|volatile|_Thread_local)[^A-Za-z0-9_]/, \\\n\
+			\" \", id)\n\
+	sub(/[^A-Za-z0-9_]+$/, \"\", id)\n\
+	sub(/.*[^A-Za-z0-9_]/, \"\", id)\n\
+	if (id == \"struct\" || id == \"union\" || id == \"enum\")\n\
+		anon = 1\n\
+	else\n\
+		own(id)\n\
+}\n\
+\n\
+# The object of an anonymous \"static struct {\" is named on its closing line.\n\
+anon && /^}/ {\n\
+	anon = 0\n\
+	id = $0\n\
+	sub(/^}[ \\t]*/, \"\", id)\n\
+	sub(/[^A-Za-z0-9_].*/, \"\", id)\n\
+	if (id != \"\")\n\
+		own(id)\n\
+}\n\
+\n\
+END {\n\
+	if (bad) {\n\
+		print \"unity: rename them or configure without --unity\" \\\n\
+			> \"/dev/stderr\"\n\
+		exit 1\n\
+	}\n\
+	for (i = 1; i <= n; i++) {\n\
+		file = out \"/unity\" i \".c\"\n\
+		printf \"/* Generated by tools/unity, do not edit. */\\n%%s%%s\", \\\n\
+			top[i], inc[i] > file\n\
+		close(file)\n\
+	}\n\
+}\n\
+' \"$@\"\
 ");
 
 	fs_write(".clang-format", "\
@@ -840,6 +1788,9 @@ See also the AUTHORS file.\n\
 	fs_write("configure", "\
 #!/bin/sh\n\
 \n\
+PACKAGE=%s\n\
+RELEASE_FILES=\"doc src lib tools bench COPYING AUTHORS THANKS README INSTALL TODO Makefile configure config.h\"\n\
+\n\
 usage() {\n\
 cat <<EOF\n\
 Usage: $0 [OPTION]... [VAR=VALUE]...\n\
@@ -847,70 +1798,238 @@ Usage: $0 [OPTION]... [VAR=VALUE]...\n\
 To assign environment variables (e.g., CC, CFLAGS...), specify them as\n\
 VAR=VALUE.\n\
 \n\
-CC              C compiler command [detected]\n\
-CFLAGS          C compiler flags [-g, ...]\n\
-LDFLAGS         C linker flags\n\
+Run configure from another directory (e.g. ../proj/configure from\n\
+build-release/) to build there; each build directory keeps its own\n\
+flavour and objects.\n\
 \n\
---prefix=<path> Set the install path\n\
---debug         Flags for debug build, overrides CFLAGS\n\
+CC              C compiler command [detected]\n\
+CFLAGS          C compiler flags, added after the flavour's flags\n\
+LDFLAGS         C linker flags, added after the flavour's flags\n\
+\n\
+--prefix=<path>         Set the install path\n\
+--flavour=<name>        Build flavour: debug, release, release-lto or\n\
+                        profiling [release]\n\
+--debug                 Same as --flavour=debug\n\
+--profile               Same as --flavour=profiling\n\
+\n\
+--with-ccache[=<path>]  Wrap compiles with ccache or sccache [detected]\n\
+--without-ccache        Never use a compiler cache\n\
+--unity[=<n>]           Compile the sources as <n> generated translation\n\
+                        units [1]\n\
+--pch                   Precompile src/pch.h and include it in every\n\
+                        translation unit\n\
+--ninja                 Also write a build.ninja for this build directory\n\
+--pgo                   Enable the pgo-instrument, pgo-train and pgo-use\n\
+                        targets for the detected compiler\n\
+--trace                 Compile in the TRACE_BEGIN/TRACE_END spans of\n\
+                        lib/trace.h\n\
 \n\
 EOF\n\
 exit 0\n\
 }\n\
 \n\
 cmdexists() { type \"$1\" >/dev/null 2>&1 ; }\n\
+shquote() { printf \"'%%s'\" \"$(printf '%%s' \"$1\" | sed \"s/'/'\\\\\\\\''/g\")\" ; }\n\
+# build.ninja escapes: '$' in any value, and also ':' and ' ' in paths.\n\
+ninja_val() { printf '%%s' \"$1\" | sed 's/\\$/$$/g' ; }\n\
+ninja_path() { printf '%%s' \"$1\" | sed 's/\\$/$$/g; s/:/$:/g; s/ /$ /g' ; }\n\
 trycc() { [ -z \"$CC\" ] && cmdexists \"$1\" && CC=$1 ; }\n\
 \n\
 prefix=/usr/local\n\
-CFLAGS=\"-std=c23\"\n\
+STDFLAGS=\"-std=c2x\"\n\
+CFLAGS=\n\
 LDFLAGS=\n\
 CC=\n\
-\n\
-printf \"checking for C compiler... \"\n\
-trycc gcc\n\
-trycc clang\n\
-trycc cc\n\
-trycc icx\n\
-printf \"%%s\n\" \"$CC\"\n\
-\n\
-DEBUG=false\n\
+FLAVOUR=release\n\
+CCACHE=auto\n\
+PGO=\n\
+PROFDATA=\n\
+UNITY=\n\
+PCH=\n\
+NINJA=\n\
+TRACE=\n\
+\n\
+args=\n\
 for arg; do\n\
+args=\"$args $(shquote \"$arg\")\"\n\
 case \"$arg\" in\n\
 --help|-h) usage ;;\n\
 --prefix=*) prefix=${arg#*=} ;;\n\
---debug) DEBUG=true ;;\n\
+--flavour=*) FLAVOUR=${arg#*=} ;;\n\
+--debug) FLAVOUR=debug ;;\n\
+--profile) FLAVOUR=profiling ;;\n\
+--with-ccache) CCACHE=yes ;;\n\
+--with-ccache=*) CCACHE=${arg#*=} ;;\n\
+--without-ccache) CCACHE=no ;;\n\
+--pgo) PGO=yes ;;\n\
+--trace) TRACE=yes ;;\n\
+--pch) PCH=yes ;;\n\
+--ninja) NINJA=yes ;;\n\
+--unity) UNITY=1 ;;\n\
+--unity=*) UNITY=${arg#*=} ;;\n\
 CFLAGS=*) CFLAGS=${arg#*=} ;;\n\
 LDFLAGS=*) LDFLAGS=${arg#*=} ;;\n\
 CC=*) CC=${arg#*=} ;;\n\
-*) printf \"Unrecognized option %%s\n\" \"$arg\" ;;\n\
+*) printf \"Unrecognized option %%s\\n\" \"$arg\" ;;\n\
+esac\n\
+done\n\
+\n\
+srcdir=$(cd \"$(dirname \"$0\")\" && pwd -P)\n\
+\n\
+case \"$FLAVOUR\" in\n\
+debug|release|release-lto|profiling) ;;\n\
+*) printf \"Unknown flavour %%s\\n\" \"$FLAVOUR\"; exit 1 ;;\n\
+esac\n\
+\n\
+case \"$UNITY\" in\n\
+''|[1-9]|[1-9][0-9]|[1-9][0-9][0-9]) ;;\n\
+*) printf \"Invalid unity chunk count %%s\\n\" \"$UNITY\"; exit 1 ;;\n\
+esac\n\
+\n\
+printf \"checking for C compiler... \"\n\
+if [ -z \"$CC\" ]; then\n\
+trycc gcc\n\
+trycc clang\n\
+trycc cc\n\
+trycc icx\n\
+fi\n\
+printf \"%%s\\n\" \"$CC\"\n\
+\n\
+case \"$($CC --version 2>/dev/null)\" in\n\
+*clang*) CCKIND=clang ;;\n\
+*\"Free Software Foundation\"*) CCKIND=gcc ;;\n\
+*) CCKIND=other ;;\n\
+esac\n\
+\n\
+",
+		 package);
+	fs_append("configure", "\
+GDEBUGCFLAGS=\"-O0 -g3 -Wall -Wextra -Wpedantic -Werror -Wshadow -Wdouble-promotion -Wformat=2 -Wnull-dereference -Wconversion -Wsign-conversion -Wcast-qual -Wcast-align=strict -Wpointer-arith -Wstrict-overflow=5 -Wstrict-aliasing=2 -Wundef -Wunreachable-code -Wswitch-enum -fanalyzer -fsanitize=undefined,address -fstack-protector-strong -D_FORTIFY_SOURCE=3\"\n\
+CDEBUGCFLAGS=\"-O0 -g3 -Wall -Wextra -Wpedantic -Werror -Wshadow -Wdouble-promotion -Wformat=2 -Wnull-dereference -Wconversion -Wsign-conversion -Wcast-qual -Wcast-align -Wpointer-arith -Wstrict-overflow=5 -Wstrict-aliasing=2 -Wundef -Wunreachable-code -Wswitch-enum -fsanitize=undefined,address -fstack-protector-strong -D_FORTIFY_SOURCE=3\"\n\
+RELEASECFLAGS=\"-O2 -DNDEBUG -ffunction-sections -fdata-sections\"\n\
+\n\
+FCFLAGS=\n\
+FLDFLAGS=\n\
+AR=ar\n\
+case \"$FLAVOUR\" in\n\
+debug)\n\
+case \"$CCKIND\" in\n\
+gcc) FCFLAGS=\"$GDEBUGCFLAGS\" ;;\n\
+clang) FCFLAGS=\"$CDEBUGCFLAGS\" ;;\n\
+*) FCFLAGS=\"-O0 -g\" ;;\n\
+esac\n\
+;;\n\
+release|release-lto)\n\
+FCFLAGS=\"$RELEASECFLAGS\"\n\
+;;\n\
+profiling)\n\
+FCFLAGS=\"-O2 -g -fno-omit-frame-pointer\"\n\
+# Leaf functions keep their frame too, so samples taken in them unwind.\n\
+if echo \"typedef int x;\" | $CC -x c -Werror -mno-omit-leaf-frame-pointer \\\n\
+-c -o /dev/null - >/dev/null 2>&1; then\n\
+FCFLAGS=\"$FCFLAGS -mno-omit-leaf-frame-pointer\"\n\
+fi\n\
+;;\n\
 esac\n\
+\n\
+# LTO objects hold compiler IR, so archives of them need the compiler's own\n\
+# archiver wrapper to get a usable symbol index.\n\
+if [ \"$FLAVOUR\" = release-lto ]; then\n\
+printf \"checking for an LTO archiver... \"\n\
+AR=\n\
+case \"$CCKIND\" in\n\
+clang)\n\
+FCFLAGS=\"$FCFLAGS -flto=thin\"\n\
+cmdexists ld.lld && FLDFLAGS=\"$FLDFLAGS -fuse-ld=lld\"\n\
+for c in llvm-ar \"llvm-ar-$($CC -dumpversion | cut -d. -f1)\"; do\n\
+cmdexists \"$c\" && { AR=$c; break; }\n\
 done\n\
+;;\n\
+gcc)\n\
+FCFLAGS=\"$FCFLAGS -flto=auto\"\n\
+cmdexists gcc-ar && AR=gcc-ar\n\
+;;\n\
+*)\n\
+FCFLAGS=\"$FCFLAGS -flto\"\n\
+AR=ar\n\
+;;\n\
+esac\n\
+if [ -z \"$AR\" ]; then\n\
+printf \"no\\nllvm-ar or gcc-ar is needed for the release-lto flavour\\n\"\n\
+exit 1\n\
+fi\n\
+printf \"%%s\\n\" \"$AR\"\n\
+fi\n\
+\n\
+[ -n \"$TRACE\" ] && FCFLAGS=\"$FCFLAGS -DTRACE_ON\"\n\
+\n\
+# 'make bench' measures release code whatever the flavour, but the profiling\n\
+# flavour's frame pointers and debug info stay for 'make profile'.\n\
+BENCHFCFLAGS=$RELEASECFLAGS\n\
+[ \"$FLAVOUR\" = profiling ] && BENCHFCFLAGS=$FCFLAGS\n\
+BENCH_CFLAGS=\"$STDFLAGS $BENCHFCFLAGS${CFLAGS:+ $CFLAGS}\"\n\
+CFLAGS=\"$STDFLAGS $FCFLAGS${CFLAGS:+ $CFLAGS}\"\n\
+LDFLAGS=\"$FLDFLAGS${LDFLAGS:+ $LDFLAGS}\"\n\
 \n\
 printf \"checking whether C compiler works... \"\n\
 tmpc=\"$(mktemp -d)/test.c\"\n\
 echo \"typedef int x;\" > \"$tmpc\"\n\
 if output=$($CC $CFLAGS -c -o /dev/null \"$tmpc\" 2>&1); then\n\
-printf \"yes\n\"\n\
+printf \"yes\\n\"\n\
 else\n\
-printf \"no; %%s\n\" \"$output\"\n\
+printf \"no; %%s\\n\" \"$output\"\n\
 exit 1\n\
 fi\n\
 \n\
-GDEBUGCFLAGS=\"-std=c23 -O0 -g3 -Wall -Wextra -Wpedantic -Werror -Wshadow -Wdouble-promotion -Wformat=2 -Wnull-dereference -Wconversion -Wsign-conversion -Wcast-qual -Wcast-align=strict -Wpointer-arith -Wstrict-overflow=5 -Wstrict-aliasing=2 -Wundef -Wunreachable-code -Wswitch-enum -fanalyzer -fsanitize=undefined,address -fstack-protector-strong -D_FORTIFY_SOURCE=3\"\n\
-CDEBUGCFLAGS=\"-std=gnu2x -O0 -g3 -Wall -Wextra -Wpedantic -Werror -Wshadow -Wdouble-promotion -Wformat=2 -Wnull-dereference -Wconversion -Wsign-conversion -Wcast-qual -Wcast-align=strict -Wpointer-arith -Wstrict-overflow=5 -Wstrict-aliasing=2 -Wundef -Wunreachable-code -Wswitch-enum -fanalyzer -fsanitize=undefined,address -fstack-protector-strong -D_FORTIFY_SOURCE=3\"\n\
+printf \"checking for compiler cache... \"\n\
+case \"$CCACHE\" in\n\
+no) CCACHE= ;;\n\
+auto|yes)\n\
+want=$CCACHE\n\
+CCACHE=\n\
+for c in ccache sccache; do\n\
+cmdexists \"$c\" && { CCACHE=$c; break; }\n\
+done\n\
+if [ -z \"$CCACHE\" ] && [ \"$want\" = yes ]; then\n\
+printf \"no\\nneither ccache nor sccache was found\\n\"\n\
+exit 1\n\
+fi\n\
+;;\n\
+*)\n\
+if ! cmdexists \"$CCACHE\"; then\n\
+printf \"no\\n%%s not found\\n\" \"$CCACHE\"\n\
+exit 1\n\
+fi\n\
+;;\n\
+esac\n\
+printf \"%%s\\n\" \"${CCACHE:-none}\"\n\
 \n\
-if [ \"$DEBUG\" = \"false\" ]; then\n\
-case \"$CC\" in\n\
-gcc) CFLAGS=\"$GDEBUGCFLAGS\";;\n\
-clang) CFLAGS=\"$CDEBUGCFLAGS\";;\n\
-*) ;;\n\
+if [ -n \"$PCH\" ]; then\n\
+printf \"checking for precompiled header support... \"\n\
+case \"$CCKIND\" in\n\
+gcc|clang) PCH=$CCKIND ;;\n\
+*) printf \"no\\n%%s is not gcc or clang\\n\" \"$CC\"; exit 1 ;;\n\
 esac\n\
+printf \"%%s\\n\" \"$PCH\"\n\
+fi\n\
+\n\
+");
+	fs_append("configure", "\
+if [ -n \"$PGO\" ]; then\n\
+printf \"checking for profile-guided optimisation... \"\n\
+if [ \"$CCKIND\" = clang ]; then\n\
+PGO=clang\n\
+for c in llvm-profdata \"llvm-profdata-$($CC -dumpversion | cut -d. -f1)\"; do\n\
+cmdexists \"$c\" && { PROFDATA=$c; break; }\n\
+done\n\
+if [ -z \"$PROFDATA\" ]; then\n\
+printf \"no\\nllvm-profdata is needed to merge clang profiles\\n\"\n\
+exit 1\n\
+fi\n\
 else\n\
-case \"$CC\" in\n\
-gcc) ;;\n\
-clang) ;;\n\
-*) ;;\n\
-esac\n\
+PGO=gcc\n\
+fi\n\
+printf \"%%s\\n\" \"$PGO\"\n\
 fi\n\
 \n\
 case \"$OSTYPE\" in\n\
@@ -920,32 +2039,338 @@ CFLAGS=\"-v $CFLAGS\"\n\
 ;;\n\
 esac\n\
 \n\
+if [ \"$srcdir\" != \"$(pwd -P)\" ]; then\n\
+printf \"creating Makefile for %%s... \" \"$srcdir\"\n\
+printf \"include %%s/Makefile\\n\" \"$srcdir\" > Makefile\n\
+printf \"done\\n\"\n\
+fi\n\
+\n\
+if [ -n \"$NINJA\" ]; then\n\
+printf \"creating build.ninja... \"\n\
+tus=\n\
+nsrc=0\n\
+for f in \"$srcdir\"/src/*.c \"$srcdir\"/lib/*.c; do\n\
+[ -e \"$f\" ] || continue\n\
+tus=\"$tus ${f#\"$srcdir\"/}\"\n\
+nsrc=$((nsrc + 1))\n\
+done\n\
+srcs=$tus\n\
+if [ -n \"$UNITY\" ]; then\n\
+chunks=$UNITY\n\
+[ \"$chunks\" -gt \"$nsrc\" ] && chunks=$nsrc\n\
+tus=\n\
+i=1\n\
+while [ \"$i\" -le \"$chunks\" ]; do\n\
+tus=\"$tus build/unity/unity$i.c\"\n\
+i=$((i + 1))\n\
+done\n\
+fi\n\
+\n\
+flags=\"-I$srcdir -D_GNU_SOURCE=\"\n\
+ccenv=\n\
+if [ -n \"$CCACHE\" ]; then\n\
+ccenv=\"CCACHE_BASEDIR=$srcdir CCACHE_NOHASHDIR=1\"\n\
+flags=\"$flags -fdebug-prefix-map=$srcdir=.\"\n\
+fi\n\
+pchflags=\n\
+pchdep=\n\
+case \"$PCH\" in\n\
+gcc) pchflags=\"-include build/pch/pch.h -Winvalid-pch\"; pchdep=build/pch/pch.h.gch ;;\n\
+clang) pchflags=\"-include-pch build/pch/pch.h.pch\"; pchdep=build/pch/pch.h.pch ;;\n\
+esac\n\
+[ -n \"$PCH\" ] && [ -n \"$CCACHE\" ] && ccenv=\"$ccenv CCACHE_SLOPPINESS=pch_defines,time_macros\"\n\
+\n\
+{\n\
+cat <<NINJA\n\
+# Generated by configure --ninja, do not edit: rerun configure instead.\n\
+ninja_required_version = 1.7\n\
+\n\
+srcdir = $(ninja_val \"$srcdir\")\n\
+cc = $(ninja_val \"$CC\")\n\
+ccache = $(ninja_val \"${CCACHE:+env $ccenv $CCACHE}\")\n\
+flags = $(ninja_val \"$flags\")\n\
+pchflags = $pchflags\n\
+cflags = $(ninja_val \"$CFLAGS\")\n\
+ldflags = $(ninja_val \"$LDFLAGS\")\n\
+ldlibs = -pthread\n\
+ar = $(ninja_val \"$AR\")\n\
+libflags = -ffunction-sections -fdata-sections -fvisibility=hidden\n\
+libldflags = -Wl,--gc-sections\n\
+prefix = $(ninja_val \"$prefix\")\n\
+\n\
+rule cc\n\
+  command = \\$ccache \\$cc \\$flags \\$pchflags \\$cflags -MMD -MF \\$out.d -c \\$in -o \\$out\n\
+  depfile = \\$out.d\n\
+  deps = gcc\n\
+  description = CC \\$out\n\
+\n\
+rule link\n\
+  command = \\$cc \\$cflags \\$ldflags \\$libldflags \\$in -o \\$out \\$ldlibs\n\
+  description = LINK \\$out\n\
+\n\
+rule ar\n\
+  command = rm -f \\$out && \\$ar rcs \\$out \\$in\n\
+  description = AR \\$out\n\
+\n\
+rule configure\n\
+  command = \\$srcdir/configure$(ninja_val \"$args\")\n\
+  generator = 1\n\
+  pool = console\n\
+\n\
+build build.ninja: configure | \\$srcdir/configure \\$srcdir/src \\$srcdir/lib\n\
+\n\
+NINJA\n\
+\n\
+# The stamp is checked on every build, since a branch switch or a move to\n\
+# packed-refs changes which file the commit lives in. It is only rewritten,\n\
+# and version.c only recompiled, when HEAD names another commit.\n\
+if [ -e \"$srcdir/.git\" ]; then\n\
+cat <<NINJA\n\
+rule stamp\n\
+  command = h=\\$\\$(git -C \\$srcdir rev-parse HEAD 2>/dev/null); if [ ! -e \\$out ] || [ \"\\$\\$h\" != \"\\$\\$(cat \\$out.head 2>/dev/null)\" ]; then n=\\$\\$(git -C \\$srcdir rev-list --count --all 2>/dev/null) || n=0; v=\\$\\$(git -C \\$srcdir describe --tags --always --dirty 2>/dev/null) || v=unknown; echo \"\\$\\${n:-0} \\$\\${v:-unknown}\" > \\$out; echo \"\\$\\$h\" > \\$out.head; fi\n\
+  restat = 1\n\
+\n\
+build version.force: phony\n\
+build build/version.stamp: stamp | version.force\n\
+\n\
+NINJA\n\
+else\n\
+cat <<NINJA\n\
+rule stamp\n\
+  command = echo '0 unknown' > \\$out\n\
+\n\
+build build/version.stamp: stamp\n\
+\n\
+NINJA\n\
+fi\n\
+\n\
+");
+	fs_append("configure", "\
+cat <<NINJA\n\
+rule versionc\n\
+  command = printf 'const int prog_commit = %%s;\\\\n' \"\\$\\$(cut -d' ' -f1 \\$in)\" > \\$out.tmp && if cmp -s \\$out.tmp \\$out; then rm \\$out.tmp; else mv \\$out.tmp \\$out; fi\n\
+  restat = 1\n\
+\n\
+build build/version.c: versionc build/version.stamp\n\
+\n\
+NINJA\n\
+\n\
+if [ -n \"$UNITY\" ]; then\n\
+printf \"rule unity\\n  command = sh \\$srcdir/tools/unity %%s build/unity \\$srcdir\" \"$chunks\"\n\
+for f in $srcs; do\n\
+printf \" \\$srcdir/%%s\" \"$(ninja_val \"$f\")\"\n\
+done\n\
+printf \"\\n\\nbuild%%s: unity | \\$srcdir/tools/unity\\n\\n\" \"$tus\"\n\
+fi\n\
+\n\
+if [ -n \"$PCH\" ]; then\n\
+cat <<NINJA\n\
+rule pchwrap\n\
+  command = echo '#include \"src/pch.h\"' > \\$out\n\
+\n\
+rule pch\n\
+  command = \\$cc \\$flags \\$cflags -MMD -MF \\$out.d -x c-header \\$in -o \\$out\n\
+  depfile = \\$out.d\n\
+  deps = gcc\n\
+  description = PCH \\$out\n\
+\n\
+build build/pch/pch.h: pchwrap\n\
+build $pchdep: pch build/pch/pch.h\n\
+\n\
+NINJA\n\
+fi\n\
+\n\
+objs=\n\
+libobjs=\n\
+for f in $tus build/version.c; do\n\
+o=\"build/obj/$(ninja_path \"${f%%.c}\").o\"\n\
+case \"$f\" in\n\
+build/*) in=$f ;;\n\
+*) in=\"\\$srcdir/$(ninja_path \"$f\")\" ;;\n\
+esac\n\
+printf \"build %%s: cc %%s%%s\\n\" \"$o\" \"$in\" \"${pchdep:+ | $pchdep}\"\n\
+case \"$f\" in\n\
+lib/*|build/unity/*) printf \"  flags = \\$flags \\$libflags\\n\" ;;\n\
+esac\n\
+case \"$f\" in\n\
+lib/*) libobjs=\"$libobjs $o\" ;;\n\
+*) objs=\"$objs $o\" ;;\n\
+esac\n\
+done\n\
+\n\
+if [ -n \"$libobjs\" ]; then\n\
+printf \"\\nbuild build/libgck.a: ar%%s\\n\" \"$libobjs\"\n\
+objs=\"$objs build/libgck.a\"\n\
+fi\n\
+\n\
+cat <<NINJA\n\
+\n\
+build bin/$PACKAGE: link$objs\n\
+\n\
+NINJA\n\
+\n\
+if cmdexists makeinfo; then\n\
+cat <<NINJA\n\
+rule makeinfo\n\
+  command = makeinfo --no-split \\$in -o \\$out\n\
+  description = MAKEINFO \\$out\n\
+\n\
+build \\$srcdir/doc/$PACKAGE.info: makeinfo \\$srcdir/doc/$PACKAGE.texi | \\$srcdir/doc/version.texi\n\
+build doc: phony \\$srcdir/doc/$PACKAGE.info\n\
+\n\
+NINJA\n\
+else\n\
+printf \"build doc: phony\\n\\n\"\n\
+fi\n\
+\n\
+cat <<NINJA\n\
+build all: phony bin/$PACKAGE doc\n\
+default all\n\
+\n\
+rule install\n\
+  command = cp \\$in \\$prefix\n\
+  pool = console\n\
+\n\
+build install: install bin/$PACKAGE\n\
+\n\
+rule clean\n\
+  command = rm -rf bin build && rm -f \\$srcdir/doc/$PACKAGE.info\n\
+\n\
+build clean: clean\n\
+\n\
+rule dist\n\
+  command = tar -czf $PACKAGE-\\$\\$(cut -d' ' -f2 build/version.stamp).tar.gz -C \\$srcdir $RELEASE_FILES\n\
+  pool = console\n\
+\n\
+# Ninja rebuilds whatever changed flags or inputs, so a release needs no clean.\n\
+build dist: dist | all build/version.stamp\n\
+build release: phony dist\n\
+NINJA\n\
+} > build.ninja\n\
+printf \"done\\n\"\n\
+fi\n\
+\n\
 printf \"creating config.mak... \"\n\
 {\n\
-printf \"PREFIX=%%s\n\" \"$prefix\"\n\
-printf \"CFLAGS=%%s\n\" \"$CFLAGS\"\n\
-printf \"LDFLAGS=%%s\n\" \"$LDFLAGS\"\n\
-printf \"CC=%%s\n\" \"$CC\"\n\
+printf \"PREFIX=%%s\\n\" \"$prefix\"\n\
+printf \"CFLAGS=%%s\\n\" \"$CFLAGS\"\n\
+printf \"BENCH_CFLAGS=%%s\\n\" \"$BENCH_CFLAGS\"\n\
+printf \"LDFLAGS=%%s\\n\" \"$LDFLAGS\"\n\
+printf \"CC=%%s\\n\" \"$CC\"\n\
+printf \"AR=%%s\\n\" \"$AR\"\n\
+printf \"FLAVOUR=%%s\\n\" \"$FLAVOUR\"\n\
+printf \"CCACHE=%%s\\n\" \"$CCACHE\"\n\
+printf \"PGO=%%s\\n\" \"$PGO\"\n\
+printf \"PROFDATA=%%s\\n\" \"$PROFDATA\"\n\
+printf \"UNITY=%%s\\n\" \"$UNITY\"\n\
+printf \"PCH=%%s\\n\" \"$PCH\"\n\
 } > config.mak\n\
-printf \"done\n\"\
+printf \"done\\n\"\
 ");
 
 	fs_write("Makefile", "\
 PACKAGE := %s\n\
 \n\
-SRCS := $(wildcard src/*.c) $(wildcard lib/*.c)\n\
-OBJS := $(patsubst src/%%.c,build/obj/%%.o,$(SRCS))\n\
+# The directory holding this Makefile. A build directory set up by running\n\
+# configure from elsewhere gets a stub Makefile that includes this one, so\n\
+# sources come from SRCDIR while everything built lands in the current\n\
+# directory.\n\
+SRCDIR := $(patsubst %%/,%%,$(dir $(lastword $(MAKEFILE_LIST))))\n\
+vpath src/%%.c $(SRCDIR)\n\
+vpath lib/%%.c $(SRCDIR)\n\
+vpath bench/%%.c $(SRCDIR)\n\
 \n\
-BIN := bin/$(PACKAGE)\n\
+-include config.mak\n\
 \n\
-COMMIT := $(shell git rev-list --count --all)\n\
-FLAGS := -I. -DCOMMIT=$(COMMIT)\n\
+SRCS := $(patsubst $(SRCDIR)/%%,%%, \\\n\
+	$(wildcard $(SRCDIR)/src/*.c) $(wildcard $(SRCDIR)/lib/*.c))\n\
 \n\
-VERSION := $(shell git describe --tags --always --dirty)\n\
-TARBALL := $(PACKAGE)-$(VERSION).tar.gz\n\
-RELEASE_FILES := doc src lib COPYING AUTHORS README yait.1 INSTALL Makefile configure config.h\n\
+# Unity build (configure --unity[=N]): the sources are compiled as at most N\n\
+# generated translation units, each including a contiguous run of them.\n\
+ifneq ($(UNITY),)\n\
+UNITY_N := $(words $(wordlist 1,$(UNITY),$(SRCS)))\n\
+UNITY_TUS := $(foreach i,$(shell awk 'BEGIN { \\\n\
+	for (i = 1; i <= $(UNITY_N); i++) print i }'),build/unity/unity$(i).c)\n\
+endif\n\
 \n\
--include config.mak\n\
+OBJS := $(patsubst %%.c,build/obj/%%.o,$(or $(UNITY_TUS),$(SRCS))) \\\n\
+	build/obj/build/version.o\n\
+\n\
+# gcklib is archived into build/libgck.a with a section per function and\n\
+# object, so the link only pulls in the members the program references and\n\
+# --gc-sections drops the unused functions within those. Hidden visibility\n\
+# leaves LTO free to internalise them. In a unity build the library has no\n\
+# objects of its own and the chunks are compiled this way instead.\n\
+LIB_OBJS := $(if $(UNITY_TUS),,$(patsubst %%.c,build/obj/%%.o, \\\n\
+	$(filter lib/%%,$(SRCS))))\n\
+LIB := $(if $(LIB_OBJS),build/libgck.a)\n\
+BIN_OBJS := $(filter-out $(LIB_OBJS),$(OBJS))\n\
+LIB_FLAGS := -ffunction-sections -fdata-sections -fvisibility=hidden\n\
+LIB_LDFLAGS := -Wl,--gc-sections\n\
+OBJDIRS := $(patsubst %%/,%%,$(sort $(dir $(OBJS))))\n\
+\n\
+BIN := bin/$(PACKAGE)\n\
+\n\
+# 'make bench' links the harness and benchmarks in bench/ with the sources\n\
+# minus the one holding main(), compiled with the release flags under\n\
+# build/bench whatever the flavour.\n\
+BENCH_SRCS := $(patsubst $(SRCDIR)/%%,%%,$(wildcard $(SRCDIR)/bench/*.c)) \\\n\
+	$(filter-out src/$(PACKAGE).c,$(SRCS)) build/version.c\n\
+BENCH_OBJS := $(patsubst %%.c,build/bench/%%.o,$(BENCH_SRCS))\n\
+BENCH_OBJDIRS := $(patsubst %%/,%%,$(sort $(dir $(BENCH_OBJS))))\n\
+BENCH_BIN := bin/$(PACKAGE)-bench\n\
+\n\
+DEPS := $(OBJS:.o=.d) $(BENCH_OBJS:.o=.d)\n\
+\n\
+# Every translation unit sees the same libc feature set, with or without the\n\
+# precompiled header. The macro is empty so that a source which also defines\n\
+# _GNU_SOURCE itself does not redefine it.\n\
+FEATURES := -D_GNU_SOURCE=\n\
+FLAGS := -I$(SRCDIR) $(FEATURES)\n\
+LDLIBS := -pthread\n\
+DEPFLAGS := -MMD -MP\n\
+COMPILE = $(CC) $(FLAGS) $(PCH_FLAGS) $(CFLAGS) $(DEPFLAGS) -c $< -o $@\n\
+\n\
+comma := ,\n\
+define newline\n\
+\n\
+\n\
+endef\n\
+json_str = \"$(subst $(newline),\\n,$(subst \",\\\",$(subst \\,\\\\,$1)))\"\n\
+cdb_entry = {\"directory\": $(call json_str,$(CURDIR)), \\\n\
+	\"file\": $(call json_str,$1), \"command\": $(call json_str,$(strip $2))}\n\
+# Each fragment is one line. make 4.3 does not always drop the newline that\n\
+# $(file <) reads, so cdb_line removes it itself.\n\
+cdb_line = $(subst $(newline),,$(file <$1))\n\
+cdb_item = $(if $(filter-out $(firstword $2),$1),$(comma))$(newline)$(call cdb_line,$1)\n\
+cdb_join = $(subst } $(comma),}$(comma),$(foreach f,$1,$(call cdb_item,$f,$1)))\n\
+\n\
+",
+		 package);
+	fs_append("Makefile", "\
+# The commit count and 'git describe' output are cached in build/version.stamp,\n\
+# which is only refreshed when HEAD or the ref it names moves. make finds\n\
+# those files without running git: in worktrees and submodules .git is a file\n\
+# whose 'gitdir:' line names the real directory, and a worktree's commondir\n\
+# file points at the shared refs. git only runs in the stamp recipe. When\n\
+# make cannot follow the layout the stamp is refreshed on every build, and\n\
+# outside a git checkout it just says '0 unknown'.\n\
+git_path = $(if $(filter /%%,$(strip $2)),$(strip $2),$1/$(strip $2))\n\
+GIT_FILE := $(if $(wildcard $(SRCDIR)/.git/.),,$(wildcard $(SRCDIR)/.git))\n\
+GIT_REPO := $(strip $(if $(GIT_FILE),$(call git_path,$(SRCDIR), \\\n\
+	$(patsubst gitdir:%%,%%,$(subst gitdir: ,gitdir:,$(file <$(GIT_FILE))))), \\\n\
+	$(wildcard $(SRCDIR)/.git)))\n\
+GIT_HEAD := $(if $(GIT_REPO),$(wildcard $(GIT_REPO)/HEAD))\n\
+GIT_COMMON := $(strip $(if $(wildcard $(GIT_REPO)/commondir),$(call git_path, \\\n\
+	$(GIT_REPO),$(strip $(file <$(GIT_REPO)/commondir))),$(GIT_REPO)))\n\
+GIT_REF := $(if $(GIT_HEAD),$(or \\\n\
+	$(wildcard $(GIT_COMMON)/$(lastword $(file <$(GIT_HEAD)))), \\\n\
+	$(wildcard $(GIT_COMMON)/packed-refs)))\n\
+\n\
+COMMIT = $(or $(word 1,$(file <build/version.stamp)),0)\n\
+VERSION = $(or $(word 2,$(file <build/version.stamp)),unknown)\n\
+TARBALL = $(PACKAGE)-$(VERSION).tar.gz\n\
+RELEASE_FILES := doc src lib tools bench COPYING AUTHORS THANKS README INSTALL TODO Makefile configure config.h\n\
 \n\
 ifeq ($(wildcard config.mak),)\n\
 all:\n\
@@ -953,20 +2378,264 @@ all:\n\
 	@exit 1\n\
 else\n\
 \n\
-all: build $(BIN)\n\
+# Let compiler cache hits survive a checkout in another directory: paths\n\
+# under the tree are hashed relative to it and debug info is rooted at '.'.\n\
+ifneq ($(CCACHE),)\n\
+export CCACHE_BASEDIR := $(abspath $(SRCDIR))\n\
+export CCACHE_NOHASHDIR := 1\n\
+FLAGS += -fdebug-prefix-map=$(abspath $(SRCDIR))=.\n\
+endif\n\
+\n\
+# Profile-guided optimisation (configure --pgo), driven by the pgo-*\n\
+# targets below. Once pgo-train has left profiles in build/pgo, every build\n\
+# of $(BIN) is compiled with them, so a plain make or make install keeps the\n\
+# optimisation; pgo-clean goes back to the normal build.\n\
+PGO_DIR := $(CURDIR)/build/pgo\n\
+ifeq ($(PGO),clang)\n\
+PGO_GEN := -fprofile-generate=$(PGO_DIR)\n\
+PGO_USE := -fprofile-use=$(PGO_DIR)/default.profdata\n\
+PGO_PROFILE := $(wildcard $(PGO_DIR)/default.profdata)\n\
+else ifneq ($(PGO),)\n\
+PGO_GEN := -fprofile-generate=$(PGO_DIR) -fprofile-update=atomic\n\
+PGO_USE := -fprofile-use=$(PGO_DIR) -Wno-missing-profile\n\
+PGO_PROFILE := $(firstword $(wildcard $(PGO_DIR)/*.gcda))\n\
+endif\n\
+PGO_FLAGS ?= $(if $(PGO_PROFILE),$(PGO_USE))\n\
+FLAGS += $(PGO_FLAGS)\n\
+\n\
+# Precompiled header (configure --pch): src/pch.h is compiled once with the\n\
+# project's flags into build/pch and forced ahead of every translation unit.\n\
+ifneq ($(PCH),)\n\
+ifeq ($(PCH),clang)\n\
+PCH_OUT := build/pch/pch.h.pch\n\
+PCH_FLAGS := -include-pch $(PCH_OUT)\n\
+else\n\
+PCH_OUT := build/pch/pch.h.gch\n\
+PCH_FLAGS := -include build/pch/pch.h -Winvalid-pch\n\
+endif\n\
+ifneq ($(CCACHE),)\n\
+export CCACHE_SLOPPINESS := pch_defines,time_macros\n\
+endif\n\
+endif\n\
+\n\
+COMPILE_FLAGS := $(CC) $(FLAGS) $(PCH_FLAGS) $(CFLAGS)\n\
+LINK_FLAGS := $(CC) $(CFLAGS) $(PGO_FLAGS) $(LDFLAGS) $(LIB_LDFLAGS) $(LDLIBS)\n\
+BENCH_FLAGS := $(CC) $(BENCH_CFLAGS) $(LDFLAGS) $(LIB_LDFLAGS) $(LDLIBS)\n\
+\n\
+");
+	fs_append("Makefile", "\
+# Flag fingerprints: each stamp is only rewritten when its flags change, so\n\
+# a flag edit rebuilds exactly the outputs that use those flags.\n\
+$(if $(wildcard build),,$(shell mkdir -p build))\n\
+ifneq ($(COMPILE_FLAGS),$(file <build/cflags.stamp))\n\
+$(file >build/cflags.stamp,$(COMPILE_FLAGS))\n\
+endif\n\
+ifneq ($(LINK_FLAGS),$(file <build/ldflags.stamp))\n\
+$(file >build/ldflags.stamp,$(LINK_FLAGS))\n\
+endif\n\
+ifneq ($(BENCH_FLAGS),$(file <build/bench.stamp))\n\
+$(file >build/bench.stamp,$(BENCH_FLAGS))\n\
+endif\n\
+ifneq ($(UNITY),)\n\
+ifneq ($(UNITY_N) $(SRCS),$(file <build/unity.list))\n\
+$(file >build/unity.list,$(UNITY_N) $(SRCS))\n\
+endif\n\
+endif\n\
+\n\
+all: $(BIN) build/compile_commands.json doc\n\
+\n\
+build/cflags.stamp:\n\
+	$(shell mkdir -p $(@D))$(file >$@,$(COMPILE_FLAGS))\n\
+\n\
+build/ldflags.stamp:\n\
+	$(shell mkdir -p $(@D))$(file >$@,$(LINK_FLAGS))\n\
+\n\
+build/bench.stamp:\n\
+	$(shell mkdir -p $(@D))$(file >$@,$(BENCH_FLAGS))\n\
+\n\
+ifneq ($(UNITY),)\n\
+build/unity.list:\n\
+	$(shell mkdir -p $(@D))$(file >$@,$(UNITY_N) $(SRCS))\n\
+\n\
+# All chunks come from one run; build/unity.list changes with the source list.\n\
+$(UNITY_TUS) &: build/unity.list $(SRCDIR)/tools/unity\n\
+	@sh $(SRCDIR)/tools/unity $(UNITY_N) build/unity $(SRCDIR) \\\n\
+		$(addprefix $(SRCDIR)/,$(SRCS))\n\
+endif\n\
+\n\
+bin $(OBJDIRS):\n\
+	mkdir -p $@\n\
+\n\
+build/obj/%%.o: %%.c build/cflags.stamp | $(OBJDIRS)\n\
+	$(file >$@.json,$(call cdb_entry,$<,$(COMPILE)))\n\
+	$(CCACHE) $(COMPILE)\n\
+\n\
+# Each compile leaves a compilation database fragment next to its object, so\n\
+# the merged database tracks the objects without bear or a rebuild. A unity\n\
+# build also lists every source with the flags of the chunk including it.\n\
+ifneq ($(UNITY),)\n\
+cdb_unity = $(comma)$(newline)$(call cdb_entry,$(SRCDIR)/$1, \\\n\
+	$(CC) $(FLAGS) $(PCH_FLAGS) $(CFLAGS) -c $(SRCDIR)/$1)\n\
+CDB_UNITY = $(subst } $(comma),}$(comma),$(foreach s,$(SRCS),$(call cdb_unity,$s)))\n\
+endif\n\
+\n\
+build/compile_commands.json: $(OBJS)\n\
+	$(file >$@,[$(call cdb_join,$(wildcard $(OBJS:.o=.o.json)))$(CDB_UNITY)$(newline)])\n\
+\n\
+ifneq ($(PCH),)\n\
+$(OBJS): $(PCH_OUT)\n\
+\n\
+build/pch/pch.h:\n\
+	@mkdir -p $(@D)\n\
+	@echo '#include \"src/pch.h\"' > $@\n\
+\n\
+# The dependency file lists every header the PCH pulls in.\n\
+$(PCH_OUT): build/pch/pch.h build/cflags.stamp\n\
+	$(CC) $(FLAGS) $(CFLAGS) -MMD -MP -MF $@.d -x c-header $< -o $@\n\
+\n\
+-include $(PCH_OUT).d\n\
+endif\n\
+\n\
+# private keeps these flags off the prerequisites, so the precompiled header\n\
+# is built with the same flags whichever object asks for it first.\n\
+$(or $(LIB_OBJS),$(UNITY_TUS:%%.c=build/obj/%%.o)): private FLAGS += $(LIB_FLAGS)\n\
+\n\
+$(LIB): $(LIB_OBJS)\n\
+	$(RM) $@\n\
+	$(AR) rcs $@ $^\n\
+\n\
+$(BIN): $(BIN_OBJS) $(LIB) build/ldflags.stamp | bin\n\
+	$(CC) $(CFLAGS) $(PGO_FLAGS) $(LDFLAGS) $(LIB_LDFLAGS) $(BIN_OBJS) $(LIB) \\\n\
+		-o $@ $(LDLIBS)\n\
+\n\
+# Rewritten only when the commit changes, so a new commit recompiles this one\n\
+# file and relinks.\n\
+build/version.c: build/version.stamp\n\
+	@printf 'const int prog_commit = %%s;\\n' '$(COMMIT)' > $@.tmp\n\
+	@if cmp -s $@.tmp $@; then rm $@.tmp; else mv $@.tmp $@; fi\n\
+\n\
+SIZE ?= size\n\
+\n\
+# Section sizes and on-disk size of the binary, labelled with the flavour\n\
+# chosen by configure, so the numbers of several build trees can be compared.\n\
+size: $(BIN)\n\
+	@echo \"flavour: $(FLAVOUR)\"\n\
+	@$(SIZE) $(BIN)\n\
+	@printf '%%s bytes on disk\\n' \"$$(wc -c < $(BIN))\"\n\
+\n\
+$(BENCH_OBJDIRS):\n\
+	mkdir -p $@\n\
+\n\
+build/bench/%%.o: %%.c build/bench.stamp | $(BENCH_OBJDIRS)\n\
+	$(CCACHE) $(CC) -I$(SRCDIR) $(FEATURES) $(BENCH_CFLAGS) $(DEPFLAGS) \\\n\
+		-c $< -o $@\n\
+\n\
+");
+	fs_append("Makefile", "\
+$(BENCH_BIN): $(BENCH_OBJS) build/bench.stamp | bin\n\
+	$(CC) $(BENCH_CFLAGS) $(LDFLAGS) $(LIB_LDFLAGS) $(BENCH_OBJS) -o $@ \\\n\
+		$(LDLIBS)\n\
+\n\
+# BENCH picks benchmarks by name: make bench BENCH=core. The results, every\n\
+# sample included, land in BENCH_JSON; bench-baseline keeps them as the\n\
+# baseline and bench-compare fails when a fresh run is significantly slower\n\
+# than it by more than BENCH_THRESHOLD percent (see tools/bench-compare).\n\
+BENCH_JSON ?= build/bench.json\n\
+BENCH_BASELINE ?= $(SRCDIR)/bench/baseline.json\n\
+BENCH_THRESHOLD ?= 5\n\
+BENCH_ALPHA ?= 0.01\n\
+\n\
+bench: $(BENCH_BIN)\n\
+	./$(BENCH_BIN) --json=$(BENCH_JSON) $(BENCH)\n\
+\n\
+bench-baseline: bench\n\
+	cp $(BENCH_JSON) $(BENCH_BASELINE)\n\
+\n\
+bench-compare: bench\n\
+	sh $(SRCDIR)/tools/bench-compare -t $(BENCH_THRESHOLD) -a $(BENCH_ALPHA) \\\n\
+		$(BENCH_BASELINE) $(BENCH_JSON)\n\
+\n\
+# 'make profile' samples PROFILE_CMD (the benchmarks by default) with perf\n\
+# and draws build/flamegraph.svg with tools/flamegraph. Stacks are unwound\n\
+# through frame pointers, which only the profiling flavour (configure\n\
+# --profile) keeps everywhere. Only the binaries PROFILE_CMD runs are built.\n\
+PERF ?= perf\n\
+PROFILE_CMD ?= ./$(BENCH_BIN) $(BENCH)\n\
+\n\
+profile: $(filter $(BIN) $(BENCH_BIN),$(patsubst ./%%,%%,$(PROFILE_CMD)))\n\
+	@command -v $(PERF) >/dev/null || \\\n\
+		{ echo \"$(PERF) not found, install perf or set PERF\"; exit 1; }\n\
+ifneq ($(FLAVOUR),profiling)\n\
+	@echo \"note: configure --profile for complete stacks\"\n\
+endif\n\
+	$(PERF) record -F 999 -g -o build/perf.data -- $(PROFILE_CMD)\n\
+	$(PERF) script -i build/perf.data | \\\n\
+		sh $(SRCDIR)/tools/flamegraph collapse > build/perf.folded\n\
+	sh $(SRCDIR)/tools/flamegraph render '$(PACKAGE)' < build/perf.folded \\\n\
+		> build/flamegraph.svg\n\
+	@echo \"wrote build/flamegraph.svg\"\n\
+\n\
+# pgo-instrument builds a binary that records profiles in build/pgo,\n\
+# pgo-train runs PGO_TRAIN with it and pgo-use rebuilds from the profiles.\n\
+# PGO_FLAGS is part of the flag fingerprints, so each step recompiles\n\
+# everything. PGO_TRAIN has no default, since the scaffolded main() returns\n\
+# at once and would only record an empty profile: name a representative\n\
+# run, e.g. make pgo-train PGO_TRAIN='./$(BIN) input'.\n\
+PGO_TRAIN ?=\n\
+\n\
+ifeq ($(PGO),)\n\
+pgo-instrument pgo-train pgo-use pgo-clean:\n\
+	@echo \"PGO is not enabled, run configure --pgo\"\n\
+	@exit 1\n\
+else\n\
+\n\
+pgo-instrument:\n\
+	$(RM) -r $(PGO_DIR)\n\
+	$(MAKE) PGO_FLAGS='$(PGO_GEN)' $(BIN)\n\
 \n\
-build:\n\
-	mkdir -p bin\n\
-	mkdir -p build/obj\n\
+pgo-train:\n\
+ifeq ($(strip $(PGO_TRAIN)),)\n\
+	@echo \"PGO_TRAIN is not set, e.g. make pgo-train PGO_TRAIN='./$(BIN) input'\"\n\
+	@exit 1\n\
+else\n\
+	$(PGO_TRAIN)\n\
+ifeq ($(PGO),clang)\n\
+	$(PROFDATA) merge -output=$(PGO_DIR)/default.profdata $(PGO_DIR)/*.profraw\n\
+endif\n\
+endif\n\
+\n\
+pgo-use:\n\
+	@[ -n \"$$(ls -A $(PGO_DIR) 2>/dev/null)\" ] || \\\n\
+		{ echo \"no profiles in build/pgo, run make pgo-train first\"; \\\n\
+		exit 1; }\n\
+	$(MAKE) PGO_FLAGS='$(PGO_USE)' $(BIN)\n\
+\n\
+pgo-clean:\n\
+	$(RM) -r $(PGO_DIR)\n\
 \n\
-build/obj/%%.o: $(SRCS) config.mak\n\
-	$(CC) $(FLAGS) $(CFLAGS) -c $< -o $@\n\
+endif\n\
+\n\
+-include $(DEPS)\n\
 \n\
-$(BIN): $(OBJS) \n\
-	$(CC) $(FLAGS) $(CFLAGS) $^ -o $@\n\
+endif\n\
 \n\
+build/version.stamp: $(or $(GIT_HEAD),$(if $(wildcard $(SRCDIR)/.git),FORCE)) \\\n\
+	$(GIT_REF)\n\
+	@mkdir -p $(@D)\n\
+ifneq ($(wildcard $(SRCDIR)/.git),)\n\
+	@n=$$(git -C $(SRCDIR) rev-list --count --all 2>/dev/null) || n=0; \\\n\
+	v=$$(git -C $(SRCDIR) describe --tags --always --dirty 2>/dev/null) \\\n\
+		|| v=unknown; \\\n\
+	echo \"$${n:-0} $${v:-unknown}\" > $@\n\
+else\n\
+	@echo '0 unknown' > $@\n\
 endif\n\
 \n\
+FORCE:\n\
+\n\
+doc:\n\
+	$(MAKE) -C $(SRCDIR)/doc\n\
+\n\
 install: $(BIN)\n\
 	cp $(BIN) $(PREFIX)\n\
 \n\
@@ -974,19 +2643,28 @@ uninstall:\n\
 	$(RM) $(PREFIX)$(PACKAGE)\n\
 \n\
 clean:\n\
-	$(RM) $(BIN)\n\
+	$(RM) $(BIN) $(BENCH_BIN)\n\
 	$(RM) -r build\n\
+	$(MAKE) -C $(SRCDIR)/doc clean\n\
 \n\
 distclean: clean\n\
 	$(RM) config.mak\n\
-	$(RM) $(TARBALL)\n\
+	$(RM) $(PACKAGE)-*.tar.gz\n\
 \n\
-release: clean all\n\
-	tar -czf $(TARBALL) $(RELEASE_FILES)\n\
-\n\
-.PHONY: all clean distclean install uninstall build release\
-",
-		 package);
+");
+	fs_append("Makefile", "\
+release:\n\
+	$(MAKE) clean\n\
+	$(MAKE) all\n\
+	$(MAKE) dist\n\
+\n\
+dist: build/version.stamp\n\
+	tar -czf $(TARBALL) -C $(SRCDIR) $(RELEASE_FILES)\n\
+\n\
+.PHONY: all clean distclean install uninstall release dist doc size bench \\\n\
+	bench-baseline bench-compare profile pgo-instrument pgo-train pgo-use \\\n\
+	pgo-clean\
+");
 
 	fs_write("TODO", "\
 %s %s- TODO\n\
@@ -1033,6 +2711,15 @@ end of file TODO\
 	if (chmod("tools/Cleanup", mode) != 0) {
 		fatalfa(errno);
 	}
+	if (chmod("tools/unity", mode) != 0) {
+		fatalfa(errno);
+	}
+	if (chmod("tools/bench-compare", mode) != 0) {
+		fatalfa(errno);
+	}
+	if (chmod("tools/flamegraph", mode) != 0) {
+		fatalfa(errno);
+	}
 
 	return exit_status;
 }
@@ -1054,14 +2741,16 @@ Generates an opinionated C project.\n",
       -q, --quiet             Only print required messages\n\
       -f, --force             Overwrite existing files\n\
       --author=NAME           Set the program author (default git username|system username)\n\
-      --licence=LICENCE       Set the program licence (default BSD)\n",
+      --licence=LICENCE       Set the program licence (default BSD)\n\
+      --gcklib=MODULES        Vendor these gcklib modules and their dependencies\n\
+                              into lib/ (default all, or none)\n",
 	      stdout);
 	exit(exit_status);
 }
 
 static void print_version()
 {
-	printf("%s %s %d\n", prog_name, VERSION, COMMIT);
+	printf("%s %s %d\n", prog_name, VERSION, prog_commit);
 
 	printf("Copyright (C) %d GCK.\n", YEAR);
 
@@ -0,0 +1,98 @@
+/*
+ * ERR_JSON records cut at the record size must still be valid JSON: the
+ * message is padded so that every kind of escape and UTF-8 sequence lands
+ * on the truncation boundary.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lib/err.h"
+
+static const char prefix[] = "{\"level\":\"error\",\"message\":\"";
+static const char suffix[] = "\"}\n";
+
+/* Checks the body of a JSON string: escapes, control characters and whole
+ * UTF-8 sequences. */
+static bool valid_body(const unsigned char *p, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		size_t n;
+
+		if (p[i] == '\\') {
+			if (++i == len)
+				return false;
+			if (p[i] == 'u') {
+				if (len - i < 5)
+					return false;
+				i += 4;
+			} else if (!strchr("\"\\/bfnrt", p[i])) {
+				return false;
+			}
+			continue;
+		}
+		if (p[i] == '"' || p[i] < 0x20)
+			return false;
+		if (p[i] < 0x80)
+			continue;
+		if (p[i] < 0xc0)
+			return false;
+		n = p[i] < 0xe0 ? 1 : p[i] < 0xf0 ? 2 : 3;
+		if (len - i - 1 < n)
+			return false;
+		while (n--)
+			if ((p[++i] & 0xc0) != 0x80)
+				return false;
+	}
+	return true;
+}
+
+int main(void)
+{
+	static const char *const tails[] = {
+		"\"", "\\", "\n", "\x01", "\xc3\xa9", "\xe2\x82\xac",
+		"\xf0\x9f\x98\x80",
+	};
+	static char msg[8192], line[8192];
+	int fds[2], failed = 0;
+
+	if (pipe(fds) != 0 || dup2(fds[1], STDERR_FILENO) == -1) {
+		perror("err_json");
+		return EXIT_FAILURE;
+	}
+	err_set_format(ERR_JSON);
+
+	for (size_t t = 0; t < sizeof tails / sizeof *tails; t++) {
+		for (size_t pad = 4000; pad < 4100; pad++) {
+			size_t len = pad;
+			ssize_t got;
+
+			memset(msg, 'a', pad);
+			while (len + strlen(tails[t]) < sizeof msg - 1) {
+				memcpy(msg + len, tails[t], strlen(tails[t]));
+				len += strlen(tails[t]);
+			}
+			msg[len] = '\0';
+
+			errorf("%s", msg);
+			got = read(fds[0], line, sizeof line);
+			if (got < (ssize_t)(sizeof prefix + sizeof suffix - 2) ||
+			    memcmp(line, prefix, sizeof prefix - 1) != 0 ||
+			    memcmp(line + got - (sizeof suffix - 1), suffix,
+				   sizeof suffix - 1) != 0 ||
+			    !valid_body((const unsigned char *)line +
+						sizeof prefix - 1,
+					(size_t)got - (sizeof prefix - 1) -
+						(sizeof suffix - 1))) {
+				printf("err_json: invalid record for tail %zu "
+				       "after %zu bytes\n",
+				       t, pad);
+				failed = 1;
+			}
+		}
+	}
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
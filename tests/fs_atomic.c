@@ -0,0 +1,61 @@
+/*
+ * fs_write_atomic creates a file, then replaces it, and leaves no temporary
+ * names behind in the directory either way.
+ */
+
+#define _GNU_SOURCE
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib/fs.h"
+
+static int failed;
+
+static void expect_only(const char *dir, const char *path, const char *text)
+{
+	char buf[64] = { 0 };
+	FILE *fp = fopen(path, "r");
+	DIR *d = opendir(dir);
+	struct dirent *e;
+	int entries = 0;
+
+	if (!fp || !fread(buf, 1, sizeof buf - 1, fp) || strcmp(buf, text)) {
+		printf("fs_atomic: %s does not hold \"%s\"\n", path, text);
+		failed = 1;
+	}
+	if (fp)
+		fclose(fp);
+	while (d && (e = readdir(d)))
+		if (strcmp(e->d_name, ".") && strcmp(e->d_name, ".."))
+			entries++;
+	if (d)
+		closedir(d);
+	if (entries != 1) {
+		printf("fs_atomic: %d entries left in %s\n", entries, dir);
+		failed = 1;
+	}
+}
+
+int main(void)
+{
+	char dir[] = "/tmp/fs_atomic.XXXXXX", path[64];
+
+	if (!mkdtemp(dir)) {
+		perror("fs_atomic");
+		return EXIT_FAILURE;
+	}
+	snprintf(path, sizeof path, "%s/out", dir);
+
+	fs_write_atomic(path, "first %d", 1);
+	expect_only(dir, path, "first 1");
+	for (int i = 0; i < 100; i++)
+		fs_write_atomic(path, "replaced %d", i);
+	expect_only(dir, path, "replaced 99");
+
+	remove(path);
+	remove(dir);
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
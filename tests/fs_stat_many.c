@@ -0,0 +1,110 @@
+/*
+ * fs_stat_many reports type, mode, size and mtime through statx, and the
+ * fstatat fallback taken once statx fails with ENOSYS gives the same
+ * answers. The statx below stands in for the C library's.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "lib/fs.h"
+
+#define WANT (FS_STAT_TYPE | FS_STAT_MODE | FS_STAT_SIZE | FS_STAT_MTIME)
+
+static bool no_statx;
+static int statx_calls;
+static int failed;
+
+int statx(int dirfd, const char *restrict path, int flags, unsigned int mask,
+	  struct statx *restrict buf)
+{
+	statx_calls++;
+	if (no_statx) {
+		errno = ENOSYS;
+		return -1;
+	}
+	return (int)syscall(SYS_statx, dirfd, path, flags, mask, buf);
+}
+
+static void check(const char *what, const char *const *paths,
+		  const struct fs_stat *st)
+{
+	if (st[0].error || st[0].type != FS_FILE || st[0].mode != 0640 ||
+	    st[0].size != 5 || st[0].mtime.tv_sec != 1000000000 ||
+	    st[0].mtime.tv_nsec != 500) {
+		printf("fs_stat_many: %s: wrong fields for %s\n", what, paths[0]);
+		failed = 1;
+	}
+	if (st[1].error || st[1].type != FS_DIR) {
+		printf("fs_stat_many: %s: %s is not a directory\n", what,
+		       paths[1]);
+		failed = 1;
+	}
+	if (st[2].error || st[2].type != FS_LINK) {
+		printf("fs_stat_many: %s: %s was followed\n", what, paths[2]);
+		failed = 1;
+	}
+	if (st[3].error != ENOENT) {
+		printf("fs_stat_many: %s: %s was found\n", what, paths[3]);
+		failed = 1;
+	}
+}
+
+int main(void)
+{
+	char dir[] = "/tmp/fs_stat_many.XXXXXX";
+	char file[64], link[64], missing[64];
+	const char *paths[4] = { file, dir, link, missing };
+	struct timespec times[2] = { { 1000000000, 500 }, { 1000000000, 500 } };
+	struct fs_stat st[4];
+	size_t found;
+	int fd;
+
+	if (!mkdtemp(dir)) {
+		perror("fs_stat_many");
+		return EXIT_FAILURE;
+	}
+	snprintf(file, sizeof file, "%s/file", dir);
+	snprintf(link, sizeof link, "%s/link", dir);
+	snprintf(missing, sizeof missing, "%s/missing", dir);
+	fd = open(file, O_WRONLY | O_CREAT, 0600);
+	if (fd < 0 || write(fd, "hello", 5) != 5 || fchmod(fd, 0640) ||
+	    futimens(fd, times) || symlink(dir, link)) {
+		perror("fs_stat_many");
+		return EXIT_FAILURE;
+	}
+	close(fd);
+
+	found = fs_stat_many(paths, 4, WANT, st);
+	if (found != 3 || statx_calls != 4) {
+		printf("fs_stat_many: statx: found %zu after %d calls\n", found,
+		       statx_calls);
+		failed = 1;
+	}
+	check("statx", paths, st);
+
+	/* statx is given up on after the first ENOSYS. */
+	no_statx = true;
+	statx_calls = 0;
+	found = fs_stat_many(paths, 4, WANT, st);
+	if (found != 3 || statx_calls != 1) {
+		printf("fs_stat_many: fstatat: found %zu after %d statx calls\n",
+		       found, statx_calls);
+		failed = 1;
+	}
+	check("fstatat", paths, st);
+
+	unlink(file);
+	unlink(link);
+	rmdir(dir);
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
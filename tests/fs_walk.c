@@ -0,0 +1,171 @@
+/*
+ * fs_walk visits every entry once in both modes, reports symbolic links
+ * without following them and honours FS_WALK_PRUNE. A directory above one
+ * that is still to be opened may be swapped for a symbolic link; the walk
+ * must stay in the original tree.
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "lib/fs.h"
+
+#define SEEN_MAX 16
+
+struct seen {
+	pthread_mutex_t lock;
+	size_t root;
+	const char *prune;
+	const char *top; /* root path, set to swap a for a link to outside */
+	const char *outside;
+	size_t n;
+	char path[SEEN_MAX][32];
+	int type[SEEN_MAX];
+};
+
+static int failed;
+
+static int collect(const struct fs_entry *e, void *data)
+{
+	struct seen *s = data;
+	const char *rel = e->path + s->root;
+
+	if (e->depth == 0)
+		return FS_WALK_CONTINUE;
+	if (*rel == '/')
+		rel++;
+
+	pthread_mutex_lock(&s->lock);
+	if (s->n < SEEN_MAX) {
+		snprintf(s->path[s->n], sizeof s->path[s->n], "%s", rel);
+		s->type[s->n] = e->type;
+	}
+	s->n++;
+	pthread_mutex_unlock(&s->lock);
+
+	if (s->prune && !strcmp(rel, s->prune))
+		return FS_WALK_PRUNE;
+	if (s->top && !strcmp(rel, "a/b")) {
+		/* a/b is reported but not opened yet: replace a. */
+		char from[128], to[128];
+
+		snprintf(from, sizeof from, "%s/a", s->top);
+		snprintf(to, sizeof to, "%s/a.moved", s->top);
+		rename(from, to);
+		symlink(s->outside, from);
+	}
+	if (strstr(rel, "secret"))
+		_exit(3);
+	return FS_WALK_CONTINUE;
+}
+
+static int type_of(const struct seen *s, const char *path)
+{
+	for (size_t i = 0; i < s->n && i < SEEN_MAX; i++)
+		if (!strcmp(s->path[i], path))
+			return s->type[i];
+	return -1;
+}
+
+static void walk(const char *root, int flags, const char *prune,
+		 size_t want)
+{
+	struct seen s = { .root = strlen(root), .prune = prune };
+	const char *mode = flags & FS_WALK_PARALLEL ? "parallel" : "sequential";
+
+	pthread_mutex_init(&s.lock, NULL);
+	if (fs_walk(root, collect, &s, flags) != 0 || s.n != want) {
+		printf("fs_walk: %s walk%s saw %zu entries, want %zu\n", mode,
+		       prune ? " with prune" : "", s.n, want);
+		failed = 1;
+	}
+	if (!prune && (type_of(&s, "a/b/y") != FS_FILE ||
+		       type_of(&s, "a/b") != FS_DIR ||
+		       type_of(&s, "link") != FS_LINK)) {
+		printf("fs_walk: %s walk reported the wrong types\n", mode);
+		failed = 1;
+	}
+	pthread_mutex_destroy(&s.lock);
+}
+
+/* The walk runs in a child, as errors are fatal by default; exit status 3
+ * means an entry behind the symbolic link was visited. */
+static void swap(const char *root, const char *outside, int flags)
+{
+	struct seen s = { .root = strlen(root), .top = root,
+			  .outside = outside };
+	const char *mode = flags & FS_WALK_PARALLEL ? "parallel" : "sequential";
+	char from[128], to[128];
+	pid_t pid;
+	int status = 0;
+
+	pthread_mutex_init(&s.lock, NULL);
+	pid = fork();
+	if (pid == 0) {
+		fs_walk(root, collect, &s, flags);
+		_exit(0);
+	}
+	waitpid(pid, &status, 0);
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		printf("fs_walk: %s walk left the tree after a swap\n", mode);
+		failed = 1;
+	}
+
+	snprintf(to, sizeof to, "%s/a", root);
+	snprintf(from, sizeof from, "%s/a.moved", root);
+	unlink(to);
+	rename(from, to);
+	pthread_mutex_destroy(&s.lock);
+}
+
+static void make(const char *root, const char *rel, bool dir)
+{
+	char path[128];
+
+	snprintf(path, sizeof path, "%s/%s", root, rel);
+	if (dir)
+		mkdir(path, 0755);
+	else
+		close(open(path, O_WRONLY | O_CREAT, 0644));
+}
+
+int main(void)
+{
+	char root[] = "/tmp/fs_walk.XXXXXX", outside[] = "/tmp/fs_out.XXXXXX";
+	char path[128], cmd[160];
+
+	if (!mkdtemp(root) || !mkdtemp(outside)) {
+		perror("fs_walk");
+		return EXIT_FAILURE;
+	}
+	make(root, "a", true);
+	make(root, "a/b", true);
+	make(root, "a/x", false);
+	make(root, "a/b/y", false);
+	make(root, "c", false);
+	snprintf(path, sizeof path, "%s/link", root);
+	symlink("a", path);
+	make(outside, "b", true);
+	make(outside, "b/secret", false);
+
+	walk(root, 0, NULL, 6);
+	walk(root, FS_WALK_PARALLEL, NULL, 6);
+	walk(root, 0, "a", 3);
+	walk(root, FS_WALK_PARALLEL, "a", 3);
+	swap(root, outside, 0);
+	swap(root, outside, FS_WALK_PARALLEL);
+
+	snprintf(cmd, sizeof cmd, "rm -rf %s %s", root, outside);
+	if (system(cmd) != 0)
+		failed = 1;
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}